@@ -1 +1,6 @@
-g++ ./src/main.cpp ./src/glslu.cpp ./src/gl_core_4_4.cpp -static-libgcc -static-libstdc++ -L./lib -I./include -lglfw3 -lopengl32  -lgdi32 -o ./RubicksCube.exe -std=c++11
+g++ ./src/main.cpp ./src/glslu.cpp ./src/shaderwatcher.cpp ./src/mappedfile.cpp ./src/cube.cpp ./src/bigcube.cpp ./src/renderer.cpp ./src/animator.cpp ./src/headless.cpp ./src/profiler.cpp ./src/ringbuffer.cpp ./src/gl_core_4_4.cpp -static-libgcc -static-libstdc++ -L./lib -I./include -lglfw3 -lopengl32  -lgdi32 -o ./RubicksCube.exe -std=c++11
+g++ ./src/tools/cubebench.cpp ./src/cube.cpp ./src/cubies.cpp ./src/batch.cpp ./src/bigcube.cpp -O2 -static-libgcc -static-libstdc++ -o ./CubeBench.exe -std=c++11
+g++ ./src/tools/cubecheck.cpp ./src/cube.cpp -O2 -static-libgcc -static-libstdc++ -o ./CubeCheck.exe -std=c++11
+g++ ./src/tools/cubesolve.cpp ./src/cube.cpp ./src/solver.cpp ./src/optimal.cpp ./src/cornerdb.cpp ./src/mappedfile.cpp -O2 -pthread -static-libgcc -static-libstdc++ -o ./CubeSolve.exe -std=c++11
+g++ ./src/tools/cubepdb.cpp ./src/cube.cpp ./src/solver.cpp ./src/cornerdb.cpp ./src/mappedfile.cpp -O2 -pthread -static-libgcc -static-libstdc++ -o ./CubePDB.exe -std=c++11
+g++ ./src/tools/cuberender.cpp ./src/glslu.cpp ./src/ringbuffer.cpp ./src/mappedfile.cpp ./src/cube.cpp ./src/renderer.cpp ./src/headless.cpp ./src/png.cpp ./src/gl_core_4_4.cpp -O2 -pthread -static-libgcc -static-libstdc++ -L./lib -I./include -lglfw3 -lopengl32  -lgdi32 -o ./CubeRender.exe -std=c++11
@@ -0,0 +1,175 @@
+#include "animator.hpp"
+
+#include <glm/vec3.hpp>
+
+using std::vector;
+
+namespace cube
+{
+    namespace AnimatorInfo {
+	// Spend time on the running turn; true once it completes, with the
+	// time left over still in seconds.
+	bool advance(double& progress, double& seconds, double turnsPerSecond)
+	{
+	    double remaining = turnsPerSecond > 0.0 ? (1.0 - progress)/turnsPerSecond : 0.0;
+
+	    if(seconds < remaining) {
+		progress += seconds*turnsPerSecond;
+		return false;
+	    }
+
+	    seconds -= remaining;
+	    progress = 0.0;
+
+	    return true;
+	}
+
+	// Clockwise quarters about a face's normal, eased in and out.
+	glm::quat getRotation(Face face, int turns, double progress)
+	{
+	    int axis[3];
+	    float t = (float)progress;
+
+	    // Clockwise, seen from outside the face, is negative about its normal.
+	    getSlotPosition(FIRST_CENTER_SLOT + face, axis);
+
+	    float quarters = (turns == 3) ? 1.0f : -(float)turns;
+	    glm::quat end = glm::angleAxis(quarters*glm::radians(90.0f), glm::vec3((float)axis[0], (float)axis[1], (float)axis[2]));
+
+	    // Smoothstep: ease in and out of each turn.
+	    return glm::slerp(glm::quat(1.0f, 0.0f, 0.0f, 0.0f), end, t*t*(3.0f - 2.0f*t));
+	}
+    }
+
+    // Constructor
+    Animator::Animator(double turnsPerSecond):
+	turnsPerSecond(turnsPerSecond), current(MOVE_NONE), progress(0.0)
+    {
+    }
+
+    // Rate setter
+    void Animator::setTurnsPerSecond(double turnsPerSecond)
+    {
+	this->turnsPerSecond = turnsPerSecond;
+    }
+
+    // Hard reset
+    void Animator::setState(const State& state)
+    {
+	this->state = state;
+
+	queue.clear();
+	current = MOVE_NONE;
+	progress = 0.0;
+    }
+
+    // Queueing
+    void Animator::queueMove(Move move)
+    {
+	if(current == MOVE_NONE) {
+	    current = move;
+	    progress = 0.0;
+	} else
+	    queue.push_back(move);
+    }
+
+    void Animator::queueMoves(const vector<Move>& moves)
+    {
+	for(size_t move = 0; move < moves.size(); ++move)
+	    queueMove(moves[move]);
+    }
+
+    // Spend the elapsed time on as many turns as it covers
+    void Animator::update(double seconds)
+    {
+	while(current != MOVE_NONE) {
+	    if(!AnimatorInfo::advance(progress, seconds, turnsPerSecond))
+		return;
+
+	    state.apply(current);
+
+	    if(queue.empty())
+		current = MOVE_NONE;
+	    else {
+		current = queue.front();
+		queue.pop_front();
+	    }
+	}
+    }
+
+    // Current layer rotation
+    glm::quat Animator::getTurn(void) const
+    {
+	if(current == MOVE_NONE)
+	    return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+	return AnimatorInfo::getRotation(getMoveFace(current), current % 3 + 1, progress);
+    }
+
+    // Constructor
+    LayerAnimator::LayerAnimator(int size, double turnsPerSecond)
+	throw(CubeException):
+	cube(size), turnsPerSecond(turnsPerSecond), turning(false), progress(0.0)
+    {
+    }
+
+    // Rate setter
+    void LayerAnimator::setTurnsPerSecond(double turnsPerSecond)
+    {
+	this->turnsPerSecond = turnsPerSecond;
+    }
+
+    // Hard reset
+    void LayerAnimator::setCube(const BigCube& cube)
+    {
+	this->cube = cube;
+
+	queue.clear();
+	turning = false;
+	progress = 0.0;
+    }
+
+    // Queueing
+    void LayerAnimator::queueMove(const LayerMove& move)
+    {
+	if(!turning) {
+	    current = move;
+	    turning = true;
+	    progress = 0.0;
+	} else
+	    queue.push_back(move);
+    }
+
+    void LayerAnimator::queueMoves(const vector<LayerMove>& moves)
+    {
+	for(size_t move = 0; move < moves.size(); ++move)
+	    queueMove(moves[move]);
+    }
+
+    // Spend the elapsed time on as many turns as it covers
+    void LayerAnimator::update(double seconds)
+    {
+	while(turning) {
+	    if(!AnimatorInfo::advance(progress, seconds, turnsPerSecond))
+		return;
+
+	    cube.apply(current);
+
+	    if(queue.empty())
+		turning = false;
+	    else {
+		current = queue.front();
+		queue.pop_front();
+	    }
+	}
+    }
+
+    // Current layer rotation
+    glm::quat LayerAnimator::getTurn(void) const
+    {
+	if(!turning)
+	    return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+
+	return AnimatorInfo::getRotation(current.face, current.turns & 3, progress);
+    }
+}
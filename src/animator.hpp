@@ -0,0 +1,102 @@
+#ifndef CUBE_ANIMATOR
+#define CUBE_ANIMATOR
+
+#include <deque>
+#include <vector>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include "cube.hpp"
+#include "bigcube.hpp"
+
+namespace cube
+{
+    // Plays queued face turns at a fixed rate. The state only takes a move
+    // once its turn finishes; until then the renderer draws the state from
+    // before it, with the turning layer rotated by getTurn(), a slerp from
+    // rest to the move's final rotation. Time is consumed exactly, so a
+    // long frame (or a rate above the frame rate) completes several turns
+    // at once instead of falling behind or dropping moves.
+    class Animator
+    {
+    private:
+	State state;
+	std::deque<Move> queue;
+	double turnsPerSecond;
+
+	Move current;
+	double progress;
+
+    public:
+	// Constructor
+	Animator(double turnsPerSecond = 4.0);
+
+	// Turn rate; zero or less finishes every queued turn on the next update.
+	void setTurnsPerSecond(double turnsPerSecond);
+	double getTurnsPerSecond(void) const { return turnsPerSecond; }
+
+	// Jump to a state, dropping any queued or running turn.
+	void setState(const State& state);
+
+	// Queue turns behind whatever is playing.
+	void queueMove(Move move);
+	void queueMoves(const std::vector<Move>& moves);
+
+	// Advance the clock.
+	void update(double seconds);
+
+	// Status functions
+	const State& getState(void) const { return state; }
+	Move getMove(void) const { return current; }
+	bool isIdle(void) const { return current == MOVE_NONE; }
+	size_t getQueueLength(void) const { return queue.size(); }
+
+	// Rotation of getMove()'s layer at the current (eased) progress;
+	// identity when idle.
+	glm::quat getTurn(void) const;
+    };
+
+    // The same for an NxN puzzle's layer turns, with the turning layers'
+    // rotation from getTurn() for BigRenderer.
+    class LayerAnimator
+    {
+    private:
+	BigCube cube;
+	std::deque<LayerMove> queue;
+	double turnsPerSecond;
+
+	bool turning;
+	LayerMove current;
+	double progress;
+
+    public:
+	// Constructor, solved.
+	LayerAnimator(int size, double turnsPerSecond = 4.0) throw (CubeException);
+
+	// Turn rate; zero or less finishes every queued turn on the next update.
+	void setTurnsPerSecond(double turnsPerSecond);
+	double getTurnsPerSecond(void) const { return turnsPerSecond; }
+
+	// Jump to a puzzle of the same size, dropping any queued or running turn.
+	void setCube(const BigCube& cube);
+
+	// Queue turns behind whatever is playing.
+	void queueMove(const LayerMove& move);
+	void queueMoves(const std::vector<LayerMove>& moves);
+
+	// Advance the clock.
+	void update(double seconds);
+
+	// Status functions
+	const BigCube& getCube(void) const { return cube; }
+	const LayerMove* getMove(void) const { return turning ? &current : NULL; }
+	bool isIdle(void) const { return !turning; }
+	size_t getQueueLength(void) const { return queue.size(); }
+
+	// Rotation of getMove()'s layers at the current (eased) progress;
+	// identity when idle.
+	glm::quat getTurn(void) const;
+    };
+}
+
+#endif
@@ -0,0 +1,371 @@
+#include "batch.hpp"
+
+#include <string.h>
+#include <sstream>
+
+using std::stringstream;
+using std::vector;
+
+#if defined(__GNUC__)
+#define BATCH_INLINE inline __attribute__((always_inline))
+#else
+#define BATCH_INLINE inline
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BATCH_VECTORS
+#endif
+
+namespace cube
+{
+    namespace BatchInfo {
+	// A move rewritten over batch rows: row i takes row source[i] plus
+	// delta[i], but only the rows listed in changed actually move.
+	struct RowMove
+	{
+	    uint8_t source[Batch::ROW_COUNT];
+	    uint8_t delta[Batch::ROW_COUNT];
+	    uint8_t changed[8];
+	    int changedCount;
+	};
+
+	struct RowTable
+	{
+	    RowMove moves[MOVE_COUNT];
+	    uint8_t modulus[Batch::ROW_COUNT];
+	};
+
+	RowTable buildRowTable(void)
+	{
+	    RowTable table;
+
+	    for(int move = 0; move < MOVE_COUNT; ++move) {
+		const MoveDefinition& definition = getMoveDefinition((Move)move);
+		RowMove& rowMove = table.moves[move];
+
+		for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+		    rowMove.source[slot] = definition.edgePermutation[slot];
+		    rowMove.delta[slot] = (uint8_t)(definition.edgeOrientation[slot] << 4);
+		}
+
+		for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+		    rowMove.source[EDGE_COUNT + slot] = (uint8_t)(EDGE_COUNT + definition.cornerPermutation[slot]);
+		    rowMove.delta[EDGE_COUNT + slot] = (uint8_t)(definition.cornerOrientation[slot] << 4);
+		}
+
+		// A face turn moves four edges and four corners.
+		rowMove.changedCount = 0;
+
+		for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		    if(rowMove.source[row] != row || rowMove.delta[row] != 0)
+			rowMove.changed[rowMove.changedCount++] = (uint8_t)row;
+	    }
+
+	    for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		table.modulus[row] = (uint8_t)((row < EDGE_COUNT ? 2 : 3) << 4);
+
+	    return table;
+	}
+
+	const RowTable& getRowTable(void)
+	{
+	    static const RowTable table = buildRowTable();
+
+	    return table;
+	}
+
+	// Lane helpers, written for both plain bytes and GCC vector types so
+	// the same kernel serves every width.
+	template<typename V>
+	BATCH_INLINE void load(V& value, const uint8_t* source)
+	{
+	    memcpy(&value, source, sizeof(V));
+	}
+
+	template<typename V>
+	BATCH_INLINE void store(uint8_t* destination, const V& value)
+	{
+	    memcpy(destination, &value, sizeof(V));
+	}
+
+	// Orientation wrap, x - m only stays below x when it did not underflow.
+	template<typename V>
+	BATCH_INLINE void wrap(V& value, uint8_t modulus)
+	{
+	    V reduced = value - modulus;
+	    value = (reduced < value) ? reduced : value;
+	}
+
+	// Same sequence on every cube, sizeof(V) cubes at a time.
+	template<typename V>
+	BATCH_INLINE void applySequence(uint8_t* rows, size_t stride, const Move* moves, size_t moveCount)
+	{
+	    const RowTable& table = getRowTable();
+
+	    for(size_t column = 0; column < stride; column += sizeof(V)) {
+		V lanes[2][Batch::ROW_COUNT];
+		V* current = lanes[0];
+		V* next = lanes[1];
+
+		for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		    load<V>(current[row], rows + row*stride + column);
+
+		for(size_t move = 0; move < moveCount; ++move) {
+		    const RowMove& rowMove = table.moves[moves[move]];
+
+		    for(int row = 0; row < Batch::ROW_COUNT; ++row) {
+			next[row] = current[rowMove.source[row]] + rowMove.delta[row];
+			wrap<V>(next[row], table.modulus[row]);
+		    }
+
+		    V* swap = current;
+		    current = next;
+		    next = swap;
+		}
+
+		for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		    store<V>(rows + row*stride + column, current[row]);
+	    }
+	}
+
+	// Different move per cube per step, steps laid out stride bytes apart.
+	// Each move present in a group of lanes is applied under a lane mask.
+	template<typename V>
+	BATCH_INLINE void applyLockstep(uint8_t* rows, size_t stride, const uint8_t* steps, size_t stepCount)
+	{
+	    const RowTable& table = getRowTable();
+
+	    for(size_t column = 0; column < stride; column += sizeof(V)) {
+		V current[Batch::ROW_COUNT];
+		V next[Batch::ROW_COUNT];
+
+		for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		    load<V>(current[row], rows + row*stride + column);
+
+		for(size_t step = 0; step < stepCount; ++step) {
+		    const uint8_t* stepMoves = steps + step*stride + column;
+		    V laneMoves;
+		    uint32_t present = 0;
+
+		    load<V>(laneMoves, stepMoves);
+
+		    for(size_t lane = 0; lane < sizeof(V); ++lane)
+			present |= 1u << stepMoves[lane];
+
+		    present &= (1u << MOVE_COUNT) - 1;
+
+		    if(present == 0)
+			continue;
+
+		    for(int row = 0; row < Batch::ROW_COUNT; ++row)
+			next[row] = current[row];
+
+		    for(int move = 0; present != 0; ++move, present >>= 1) {
+			if(!(present & 1))
+			    continue;
+
+			const RowMove& rowMove = table.moves[move];
+
+			for(int index = 0; index < rowMove.changedCount; ++index) {
+			    int row = rowMove.changed[index];
+			    V moved = current[rowMove.source[row]] + rowMove.delta[row];
+
+			    wrap<V>(moved, table.modulus[row]);
+
+			    next[row] = (laneMoves == (uint8_t)move) ? moved : next[row];
+			}
+		    }
+
+		    for(int row = 0; row < Batch::ROW_COUNT; ++row)
+			current[row] = next[row];
+		}
+
+		for(int row = 0; row < Batch::ROW_COUNT; ++row)
+		    store<V>(rows + row*stride + column, current[row]);
+	    }
+	}
+
+	void applySequenceScalar(uint8_t* rows, size_t stride, const Move* moves, size_t moveCount)
+	{
+	    applySequence<uint8_t>(rows, stride, moves, moveCount);
+	}
+
+	void applyLockstepScalar(uint8_t* rows, size_t stride, const uint8_t* steps, size_t stepCount)
+	{
+	    applyLockstep<uint8_t>(rows, stride, steps, stepCount);
+	}
+
+#ifdef BATCH_VECTORS
+	typedef uint8_t vec16 __attribute__((vector_size(16)));
+	typedef uint8_t vec32 __attribute__((vector_size(32)));
+
+	__attribute__((target("sse2")))
+	void applySequenceSSE(uint8_t* rows, size_t stride, const Move* moves, size_t moveCount)
+	{
+	    applySequence<vec16>(rows, stride, moves, moveCount);
+	}
+
+	__attribute__((target("sse2")))
+	void applyLockstepSSE(uint8_t* rows, size_t stride, const uint8_t* steps, size_t stepCount)
+	{
+	    applyLockstep<vec16>(rows, stride, steps, stepCount);
+	}
+
+	__attribute__((target("avx2")))
+	void applySequenceAVX2(uint8_t* rows, size_t stride, const Move* moves, size_t moveCount)
+	{
+	    applySequence<vec32>(rows, stride, moves, moveCount);
+	}
+
+	__attribute__((target("avx2")))
+	void applyLockstepAVX2(uint8_t* rows, size_t stride, const uint8_t* steps, size_t stepCount)
+	{
+	    applyLockstep<vec32>(rows, stride, steps, stepCount);
+	}
+#endif
+    }
+
+    // Constructor
+    Batch::Batch(size_t count):
+	count(count), stride((count + ALIGNMENT - 1)/ALIGNMENT*ALIGNMENT), kernel(getBestKernel()),
+	rows(ROW_COUNT*stride)
+    {
+	reset();
+    }
+
+    // Set every cube, padding included, back to solved.
+    void Batch::reset(void)
+    {
+	for(int row = 0; row < ROW_COUNT; ++row) {
+	    int cubie = (row < EDGE_COUNT) ? row : row - EDGE_COUNT;
+
+	    memset(&rows[row*stride], cubie, stride);
+	}
+    }
+
+    // Kernel mutator
+    void Batch::setKernel(Kernel kernel)
+    {
+	this->kernel = isKernelSupported(kernel) ? kernel : KERNEL_SCALAR;
+    }
+
+    // Scatter one state into its column
+    void Batch::set(size_t cube, const State& state)
+    {
+	Cubies cubies(state);
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    rows[slot*stride + cube] = cubies.edges[slot];
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    rows[(EDGE_COUNT + slot)*stride + cube] = cubies.corners[slot];
+    }
+
+    // Gather one state from its column
+    State Batch::get(size_t cube) const
+    {
+	Cubies cubies;
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    cubies.edges[slot] = rows[slot*stride + cube];
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    cubies.corners[slot] = rows[(EDGE_COUNT + slot)*stride + cube];
+
+	return cubies.toState();
+    }
+
+    // Count cubes that are solved
+    size_t Batch::countSolved(void) const
+    {
+	size_t solved = 0;
+
+	for(size_t cube = 0; cube < count; ++cube) {
+	    bool matches = true;
+
+	    for(int row = 0; row < ROW_COUNT && matches; ++row)
+		matches = rows[row*stride + cube] == ((row < EDGE_COUNT) ? row : row - EDGE_COUNT);
+
+	    if(matches)
+		++solved;
+	}
+
+	return solved;
+    }
+
+    // Same move for every cube
+    void Batch::apply(Move move)
+    {
+	apply(vector<Move>(1, move));
+    }
+
+    // Same sequence for every cube
+    void Batch::apply(const vector<Move>& sequence)
+    {
+	if(sequence.empty() || stride == 0) return;
+
+	switch(kernel) {
+#ifdef BATCH_VECTORS
+	case KERNEL_AVX2:  BatchInfo::applySequenceAVX2(&rows[0], stride, &sequence[0], sequence.size()); break;
+	case KERNEL_SSSE3: BatchInfo::applySequenceSSE(&rows[0], stride, &sequence[0], sequence.size()); break;
+#endif
+	default:           BatchInfo::applySequenceScalar(&rows[0], stride, &sequence[0], sequence.size()); break;
+	}
+    }
+
+    // One move per cube
+    void Batch::apply(const uint8_t* moves)
+    {
+	if(stride == 0) return;
+
+	// The kernels shift by the move, so anything past MOVE_NONE idles too.
+	steps.assign(stride, MOVE_NONE);
+
+	for(size_t cube = 0; cube < count; ++cube)
+	    steps[cube] = moves[cube] < MOVE_NONE ? moves[cube] : (uint8_t)MOVE_NONE;
+
+	switch(kernel) {
+#ifdef BATCH_VECTORS
+	case KERNEL_AVX2:  BatchInfo::applyLockstepAVX2(&rows[0], stride, &steps[0], 1); break;
+	case KERNEL_SSSE3: BatchInfo::applyLockstepSSE(&rows[0], stride, &steps[0], 1); break;
+#endif
+	default:           BatchInfo::applyLockstepScalar(&rows[0], stride, &steps[0], 1); break;
+	}
+    }
+
+    // One sequence per cube
+    void Batch::apply(const vector<vector<Move> >& sequences)
+	throw(CubeException)
+    {
+	if(sequences.size() != count) {
+	    stringstream buffer;
+
+	    buffer << "Expected " << count << " move sequences, got " << sequences.size() << "!";
+
+	    throw CubeException(buffer.str());
+	}
+
+	size_t stepCount = 0;
+
+	for(size_t cube = 0; cube < count; ++cube)
+	    if(sequences[cube].size() > stepCount)
+		stepCount = sequences[cube].size();
+
+	if(stepCount == 0 || stride == 0) return;
+
+	// Transpose into step-major rows so each step reads one contiguous row.
+	steps.assign(stepCount*stride, MOVE_NONE);
+
+	for(size_t cube = 0; cube < count; ++cube)
+	    for(size_t step = 0; step < sequences[cube].size(); ++step)
+		steps[step*stride + cube] = (uint8_t)sequences[cube][step];
+
+	switch(kernel) {
+#ifdef BATCH_VECTORS
+	case KERNEL_AVX2:  BatchInfo::applyLockstepAVX2(&rows[0], stride, &steps[0], stepCount); break;
+	case KERNEL_SSSE3: BatchInfo::applyLockstepSSE(&rows[0], stride, &steps[0], stepCount); break;
+#endif
+	default:           BatchInfo::applyLockstepScalar(&rows[0], stride, &steps[0], stepCount); break;
+	}
+    }
+}
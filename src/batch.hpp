@@ -0,0 +1,61 @@
+#ifndef CUBE_BATCH
+#define CUBE_BATCH
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "cube.hpp"
+#include "cubies.hpp"
+
+namespace cube
+{
+    // N cube states in structure-of-arrays layout: one row per cubie slot
+    // (12 edge rows, then 8 corner rows), one byte per cube in each row,
+    // encoded as in Cubies. Moves run down the rows, so every SIMD lane
+    // carries a different cube.
+    class Batch
+    {
+    private:
+	size_t count;
+	size_t stride;
+	Kernel kernel;
+	std::vector<uint8_t> rows;
+	std::vector<uint8_t> steps;
+
+	// Prevent object copying
+	Batch(const Batch& other) {}
+	Batch& operator=(const Batch& other) { return *this; }
+
+    public:
+	enum { ROW_COUNT = EDGE_COUNT + CORNER_COUNT, ALIGNMENT = 32 };
+
+	// Constructor, every cube starts solved.
+	Batch(size_t count);
+
+	// Status functions
+	size_t size(void) const { return count; }
+	size_t countSolved(void) const;
+
+	// Kernel selection, defaults to the best one supported.
+	Kernel getKernel(void) const { return kernel; }
+	void setKernel(Kernel kernel);
+
+	// Per-cube access
+	void reset(void);
+	void set(size_t cube, const State& state);
+	State get(size_t cube) const;
+
+	// Apply the same move/sequence to every cube.
+	void apply(Move move);
+	void apply(const std::vector<Move>& sequence);
+
+	// Lockstep application: one move per cube (MOVE_NONE, or any larger
+	// byte, to skip), or one sequence per cube, shorter sequences idle
+	// once they run out.
+	void apply(const uint8_t* moves);
+	void apply(const std::vector<std::vector<Move> >& sequences) throw (CubeException);
+    };
+}
+
+#endif
@@ -0,0 +1,310 @@
+#include "bigcube.hpp"
+
+#include <sstream>
+
+using std::string;
+using std::stringstream;
+using std::vector;
+
+namespace cube
+{
+    namespace BigCubeInfo {
+	// Outward normal, then the directions of increasing column and row as
+	// each face is seen in the net (x = R, y = U, z = F).
+	const int faceAxes[FACE_COUNT][3][3] = {
+	    {{ 0,  1,  0}, { 1,  0,  0}, { 0,  0,  1}}, // U: rows run back to front
+	    {{ 1,  0,  0}, { 0,  0, -1}, { 0, -1,  0}}, // R
+	    {{ 0,  0,  1}, { 1,  0,  0}, { 0, -1,  0}}, // F
+	    {{ 0, -1,  0}, { 1,  0,  0}, { 0,  0, -1}}, // D: rows run front to back
+	    {{-1,  0,  0}, { 0,  0,  1}, { 0, -1,  0}}, // L
+	    {{ 0,  0, -1}, {-1,  0,  0}, { 0, -1,  0}}  // B
+	};
+
+	const char faceNames[FACE_COUNT + 1] = "URFDLB";
+
+	int dot(const int a[3], const int b[3])
+	{
+	    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+	}
+
+	// Sticker center on a doubled grid, so every coordinate is an integer:
+	// in-face axes run -(N-1)..N-1 in steps of two, the normal is N.
+	void getStickerPosition(int size, int face, int row, int column, int position[3])
+	{
+	    for(int axis = 0; axis < 3; ++axis)
+		position[axis] = size*faceAxes[face][0][axis]
+		    + (2*column - (size - 1))*faceAxes[face][1][axis]
+		    + (2*row - (size - 1))*faceAxes[face][2][axis];
+	}
+
+	// Sticker index from a doubled-grid position
+	int getStickerIndex(int size, const int position[3])
+	{
+	    for(int face = 0; face < FACE_COUNT; ++face) {
+		if(dot(position, faceAxes[face][0]) != size)
+		    continue;
+
+		int column = (dot(position, faceAxes[face][1]) + size - 1)/2;
+		int row = (dot(position, faceAxes[face][2]) + size - 1)/2;
+
+		return (face*size + row)*size + column;
+	    }
+
+	    return -1;
+	}
+
+	// Clockwise quarter turn about a face normal: n(n.v) - n x v
+	void rotate(const int normal[3], const int position[3], int result[3])
+	{
+	    int along = dot(normal, position);
+
+	    for(int axis = 0; axis < 3; ++axis) {
+		int next = (axis + 1) % 3, last = (axis + 2) % 3;
+
+		result[axis] = normal[axis]*along - (normal[next]*position[last] - normal[last]*position[next]);
+	    }
+	}
+
+	// Carry the values at four indices k places around their cycle.
+	inline void cycle(uint8_t* stickers, const int index[4], int turns)
+	{
+	    uint8_t values[4] = { stickers[index[0]], stickers[index[1]], stickers[index[2]], stickers[index[3]] };
+
+	    for(int n = 0; n < 4; ++n)
+		stickers[index[(n + turns) & 3]] = values[n];
+	}
+    }
+
+    // Constructor
+    BigCube::BigCube(int size)
+	throw(CubeException):
+	size(size)
+    {
+	if(size < MIN_BIG_SIZE || size > MAX_BIG_SIZE) {
+	    stringstream buffer;
+
+	    buffer << "Puzzle size " << size << " is outside " << MIN_BIG_SIZE << ".." << MAX_BIG_SIZE << "!";
+
+	    throw CubeException(buffer.str());
+	}
+
+	stickers.resize(FACE_COUNT*size*size);
+
+	for(int face = 0; face < FACE_COUNT; ++face)
+	    for(int sticker = 0; sticker < size*size; ++sticker)
+		stickers[face*size*size + sticker] = (uint8_t)face;
+
+	// Find each face's four neighbouring strips from the geometry once, as
+	// where the stickers of the first one land after each quarter turn.
+	for(int face = 0; face < FACE_COUNT; ++face) {
+	    const int* normal = BigCubeInfo::faceAxes[face][0];
+	    int neighbour = (face + 1) % FACE_COUNT;
+
+	    // Any face not parallel to this one starts the cycle.
+	    while(BigCubeInfo::dot(normal, BigCubeInfo::faceAxes[neighbour][0]) != 0)
+		neighbour = (neighbour + 1) % FACE_COUNT;
+
+	    // Strip elements 0 and 1 at depths 0 and 1 fix base and strides.
+	    int position[2][2][3];
+
+	    for(int depth = 0; depth < 2; ++depth) {
+		int found = 0;
+
+		for(int sticker = 0; sticker < size*size && found < 2; ++sticker) {
+		    int* target = position[depth][found];
+
+		    BigCubeInfo::getStickerPosition(size, neighbour, sticker/size, sticker % size, target);
+
+		    if(BigCubeInfo::dot(target, normal) == size - 1 - 2*depth)
+			++found;
+		}
+	    }
+
+	    for(int strip = 0; strip < 4; ++strip) {
+		int index[2][2];
+
+		for(int depth = 0; depth < 2; ++depth)
+		    for(int element = 0; element < 2; ++element) {
+			int* current = position[depth][element];
+			int turned[3];
+
+			index[depth][element] = BigCubeInfo::getStickerIndex(size, current);
+
+			BigCubeInfo::rotate(normal, current, turned);
+
+			for(int axis = 0; axis < 3; ++axis)
+			    current[axis] = turned[axis];
+		    }
+
+		strips[face][strip].base = index[0][0];
+		strips[face][strip].depthStride = index[1][0] - index[0][0];
+		strips[face][strip].stride = index[0][1] - index[0][0];
+	    }
+	}
+    }
+
+    // Rotate one face's block in place, clockwise as seen from outside
+    void BigCube::rotateFace(Face face, int turns)
+    {
+	uint8_t* block = &stickers[face*size*size];
+	int last = size - 1;
+
+	for(int row = 0; row < size/2; ++row)
+	    for(int column = 0; column < (size + 1)/2; ++column) {
+		const int index[4] = {
+		    row*size + column,
+		    column*size + last - row,
+		    (last - row)*size + last - column,
+		    (last - column)*size + row
+		};
+
+		BigCubeInfo::cycle(block, index, turns);
+	    }
+    }
+
+    // Single layer turn
+    void BigCube::turnLayer(Face face, int depth, int turns)
+    {
+	const Strip* strip = strips[face];
+	int base[4];
+
+	for(int n = 0; n < 4; ++n)
+	    base[n] = strip[n].base + depth*strip[n].depthStride;
+
+	for(int element = 0; element < size; ++element) {
+	    const int index[4] = {
+		base[0] + element*strip[0].stride,
+		base[1] + element*strip[1].stride,
+		base[2] + element*strip[2].stride,
+		base[3] + element*strip[3].stride
+	    };
+
+	    BigCubeInfo::cycle(&stickers[0], index, turns);
+	}
+
+	// Outer layers carry a whole face; the far one turns the other way
+	// as seen from its own side.
+	if(depth == 0)
+	    rotateFace(face, turns);
+
+	if(depth == size - 1)
+	    rotateFace((Face)((face + 3) % FACE_COUNT), 4 - turns);
+    }
+
+    // Apply moves
+    void BigCube::apply(const LayerMove& move)
+    {
+	int turns = move.turns & 3;
+
+	if(turns == 0)
+	    return;
+
+	for(int layer = move.depth; layer < move.depth + move.width && layer < size; ++layer)
+	    turnLayer(move.face, layer, turns);
+    }
+
+    void BigCube::apply(const vector<LayerMove>& moves)
+    {
+	for(size_t move = 0; move < moves.size(); ++move)
+	    apply(moves[move]);
+    }
+
+    // Every face a single color
+    bool BigCube::isSolved(void) const
+    {
+	for(int face = 0; face < FACE_COUNT; ++face) {
+	    const uint8_t* block = getFace((Face)face);
+
+	    for(int sticker = 1; sticker < size*size; ++sticker)
+		if(block[sticker] != block[0])
+		    return false;
+	}
+
+	return true;
+    }
+
+    // Parse a move string such as "R 2R' Rw2 3Fw'"
+    vector<LayerMove> parseLayerMoves(const string& moves, int size)
+	throw(CubeException)
+    {
+	vector<LayerMove> result;
+	stringstream tokens(moves);
+	string token;
+
+	while(tokens >> token) {
+	    string::size_type position = 0;
+	    int layers = 0;
+
+	    // Optional layer count (slice number, or width for wide turns),
+	    // never zero or with a leading zero.
+	    bool valid = token[0] != '0';
+
+	    while(position < token.size() && token[position] >= '0' && token[position] <= '9')
+		layers = 10*layers + (token[position++] - '0');
+
+	    bool counted = position > 0;
+
+	    string::size_type face = position < token.size() ? string(BigCubeInfo::faceNames).find(token[position++]) : string::npos;
+	    bool wide = position < token.size() && token[position] == 'w';
+	    LayerMove move;
+
+	    if(wide)
+		++position;
+
+	    move.turns = 1;
+
+	    if(position + 1 == token.size() && token[position] == '2')
+		move.turns = 2;
+	    else if(position + 1 == token.size() && token[position] == '\'')
+		move.turns = 3;
+	    else if(position != token.size())
+		valid = false;
+
+	    if(face == string::npos)
+		valid = false;
+	    else if(wide) {
+		// Rw = 2Rw; 1Rw is just R, and a full width turn would be a cube
+		// rotation.
+		move.face = (Face)face;
+		move.depth = 0;
+		move.width = counted ? layers : 2;
+		valid = valid && move.width >= 2 && move.width < size;
+	    } else {
+		move.face = (Face)face;
+		move.depth = counted ? layers - 1 : 0;
+		move.width = 1;
+		valid = valid && move.depth < size;
+	    }
+
+	    if(!valid) {
+		stringstream buffer;
+
+		buffer << "Unrecognized move \'" << token << "\' for a " << size << "x" << size << "!";
+
+		throw CubeException(buffer.str());
+	    }
+
+	    result.push_back(move);
+	}
+
+	return result;
+    }
+
+    // Format a move in the notation parseLayerMoves() reads
+    string toString(const LayerMove& move)
+    {
+	stringstream buffer;
+
+	if(move.depth == 0 && move.width > 1)
+	    buffer << (move.width > 2 ? std::to_string(move.width) : string()) << BigCubeInfo::faceNames[move.face] << "w";
+	else
+	    buffer << (move.depth > 0 ? std::to_string(move.depth + 1) : string()) << BigCubeInfo::faceNames[move.face];
+
+	switch(move.turns & 3) {
+	case 2: buffer << "2"; break;
+	case 3: buffer << "'"; break;
+	}
+
+	return buffer.str();
+    }
+}
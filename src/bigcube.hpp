@@ -0,0 +1,77 @@
+#ifndef CUBE_BIGCUBE
+#define CUBE_BIGCUBE
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "cube.hpp"
+
+namespace cube
+{
+    enum { MIN_BIG_SIZE = 2, MAX_BIG_SIZE = 100 };
+
+    // A turn of width layers, starting depth layers in from face (0 is the
+    // face itself), by turns clockwise quarters as seen from that face.
+    //   R = {R, 0, 1, 1}, 2R' = {R, 1, 1, 3}, 3Rw2 = {R, 0, 3, 2}
+    struct LayerMove
+    {
+	Face face;
+	int depth;
+	int width;
+	int turns;
+    };
+
+    // An NxN puzzle stored as its stickers only: one byte (a Face color) per
+    // facelet, each face a contiguous row-major N*N block in URFDLB order,
+    // laid out like State::getFacelets (which it matches for N = 3). That's
+    // 6*N^2 bytes with no cubies at all.
+    //
+    // A layer turn cycles four N sticker strips on the neighbouring faces,
+    // each a row or column walked with a fixed stride, and rotates a face
+    // block only for the outer layers; a slice costs O(N), a face O(N^2).
+    class BigCube
+    {
+    private:
+	// N stickers of one face: base + depth*depthStride + k*stride.
+	struct Strip
+	{
+	    int base;
+	    int depthStride;
+	    int stride;
+	};
+
+	int size;
+	std::vector<uint8_t> stickers;
+	Strip strips[FACE_COUNT][4];
+
+	void rotateFace(Face face, int turns);
+	void turnLayer(Face face, int depth, int turns);
+
+    public:
+	// Constructor, solved.
+	BigCube(int size) throw (CubeException);
+
+	// Moves
+	void apply(const LayerMove& move);
+	void apply(const std::vector<LayerMove>& moves);
+
+	// Status functions
+	int getSize(void) const { return size; }
+	bool isSolved(void) const;
+
+	// Sticker accessors; rows run top to bottom as the face is seen from
+	// outside, in the usual net orientation.
+	uint8_t getSticker(Face face, int row, int column) const { return stickers[(face*size + row)*size + column]; }
+	const uint8_t* getFace(Face face) const { return &stickers[face*size*size]; }
+	const std::vector<uint8_t>& getStickers(void) const { return stickers; }
+    };
+
+    // Move string conversion in WCA big cube notation, e.g. "R 2R' Rw2 3Fw'",
+    // checked against a puzzle size.
+    std::vector<LayerMove> parseLayerMoves(const std::string& moves, int size) throw (CubeException);
+    std::string toString(const LayerMove& move);
+}
+
+#endif
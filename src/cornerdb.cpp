@@ -0,0 +1,289 @@
+#include "cornerdb.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using std::atomic;
+using std::endl;
+using std::ios;
+using std::ofstream;
+using std::ostream;
+using std::string;
+using std::stringstream;
+using std::thread;
+using std::vector;
+
+namespace cube
+{
+    namespace CornerInfo {
+	enum { HEADER_SIZE = 64, CHUNK_ENTRIES = 1 << 16, UNKNOWN = 0x0F };
+
+	struct DatabaseHeader
+	{
+	    char magic[8];
+	    uint32_t version;
+	    uint32_t headerSize;
+	    uint64_t entryCount;
+	    uint64_t checksum;
+	};
+
+	const char databaseMagic[8] = {'C', 'U', 'B', 'E', 'C', 'D', 'B', '\0'};
+
+	// FNV-1a, 64 bit
+	uint64_t hash(const uint8_t* data, size_t length)
+	{
+	    uint64_t value = 14695981039346656037ULL;
+
+	    for(size_t byte = 0; byte < length; ++byte) {
+		value ^= data[byte];
+		value *= 1099511628211ULL;
+	    }
+
+	    return value;
+	}
+
+	// Shared state for one BFS level. Each 32 bit word holds eight
+	// nibbles; unknown entries are 0xF, so recording a distance only ever
+	// clears bits and a plain atomic AND is enough, no CAS loop.
+	struct Level
+	{
+	    const SolverTables& tables;
+	    atomic<uint32_t>* words;
+	    int depth;
+	    bool backward;
+	    atomic<uint64_t> nextChunk;
+	    atomic<uint64_t> found;
+
+	    Level(const SolverTables& tables, atomic<uint32_t>* words):
+		tables(tables), words(words), depth(0), backward(false), nextChunk(0), found(0) {}
+
+	    int get(uint64_t index) const
+	    {
+		return (words[index >> 3].load(std::memory_order_relaxed) >> ((index & 7) << 2)) & 0x0F;
+	    }
+
+	    // Returns true if this call moved the entry off UNKNOWN.
+	    bool set(uint64_t index, int distance)
+	    {
+		uint32_t shift = (uint32_t)((index & 7) << 2);
+		uint32_t mask = ~((uint32_t)(UNKNOWN ^ distance) << shift);
+		uint32_t previous = words[index >> 3].fetch_and(mask, std::memory_order_relaxed);
+
+		return ((previous >> shift) & 0x0F) == UNKNOWN;
+	    }
+
+	    uint64_t neighbor(uint64_t index, int move) const
+	    {
+		int corners = (int)(index/TWIST_COUNT);
+		int twist = (int)(index % TWIST_COUNT);
+
+		return (uint64_t)tables.cornerPermutationMove[corners*MOVE_COUNT + move]*TWIST_COUNT
+		    + tables.twistMove[twist*MOVE_COUNT + move];
+	    }
+	};
+
+	// Threads claim chunks of the index space until it runs out. Forward
+	// levels expand the frontier; backward levels (used once most of the
+	// table is known) let each unknown entry look for a frontier neighbor.
+	void expandLevel(Level& level)
+	{
+	    uint64_t found = 0;
+
+	    for(;;) {
+		uint64_t begin = level.nextChunk.fetch_add(1)*CHUNK_ENTRIES;
+
+		if(begin >= CornerDatabase::ENTRY_COUNT) break;
+
+		uint64_t end = begin + CHUNK_ENTRIES;
+
+		if(end > CornerDatabase::ENTRY_COUNT)
+		    end = CornerDatabase::ENTRY_COUNT;
+
+		for(uint64_t index = begin; index < end; ++index) {
+		    int distance = level.get(index);
+
+		    if(level.backward) {
+			if(distance != UNKNOWN)
+			    continue;
+
+			for(int move = 0; move < MOVE_COUNT; ++move)
+			    if(level.get(level.neighbor(index, move)) == level.depth) {
+				if(level.set(index, level.depth + 1))
+				    ++found;
+
+				break;
+			    }
+		    } else {
+			if(distance != level.depth)
+			    continue;
+
+			for(int move = 0; move < MOVE_COUNT; ++move) {
+			    uint64_t next = level.neighbor(index, move);
+
+			    if(level.get(next) == UNKNOWN && level.set(next, level.depth + 1))
+				++found;
+			}
+		    }
+		}
+	    }
+
+	    level.found.fetch_add(found);
+	}
+    }
+
+    // Map and check the header
+    CornerDatabase::CornerDatabase(const string& filename)
+	throw(CubeException):
+	nibbles(NULL), checksum(0)
+    {
+	CornerInfo::DatabaseHeader header;
+
+	try {
+	    file.open(filename);
+	} catch(sysu::SystemException& exception) {
+	    throw CubeException(exception.what());
+	}
+
+	if(file.size() != CornerInfo::HEADER_SIZE + ENTRY_COUNT/2) {
+	    stringstream buffer;
+
+	    buffer << "\"" << filename << "\" is not a corner database (wrong size).";
+
+	    throw CubeException(buffer.str());
+	}
+
+	memcpy(&header, file.data(), sizeof(header));
+
+	if(memcmp(header.magic, CornerInfo::databaseMagic, sizeof(header.magic)) != 0
+	   || header.version != VERSION || header.entryCount != ENTRY_COUNT) {
+	    stringstream buffer;
+
+	    buffer << "\"" << filename << "\" is not a version " << VERSION << " corner database.";
+
+	    throw CubeException(buffer.str());
+	}
+
+	nibbles = (const uint8_t*)file.data() + CornerInfo::HEADER_SIZE;
+	checksum = header.checksum;
+    }
+
+    // Checksum verification
+    bool CornerDatabase::verify(void) const
+    {
+	return CornerInfo::hash(nibbles, (size_t)(ENTRY_COUNT/2)) == checksum;
+    }
+
+    // Parallel BFS from solved corners
+    void CornerDatabase::generate(const SolverTables& tables, const string& filename, int threadCount, ostream* log)
+	throw(CubeException)
+    {
+	typedef std::chrono::steady_clock generate_clock;
+
+	const uint64_t wordCount = ENTRY_COUNT/8;
+	vector<atomic<uint32_t> > words(wordCount);
+	CornerInfo::Level level(tables, &words[0]);
+
+	if(threadCount <= 0)
+	    threadCount = (int)thread::hardware_concurrency();
+
+	if(threadCount <= 0)
+	    threadCount = 1;
+
+	for(uint64_t word = 0; word < wordCount; ++word)
+	    words[word].store(0xFFFFFFFFu, std::memory_order_relaxed);
+
+	level.set(0, 0);
+
+	generate_clock::time_point start = generate_clock::now();
+	uint64_t known = 1;
+
+	for(int depth = 0; known < ENTRY_COUNT && depth < CornerInfo::UNKNOWN - 1; ++depth) {
+	    uint64_t frontier = (depth == 0) ? 1 : level.found.load();
+
+	    level.depth = depth;
+	    level.backward = frontier > ENTRY_COUNT - known;
+	    level.nextChunk.store(0);
+	    level.found.store(0);
+
+	    vector<thread> workers;
+
+	    for(int worker = 1; worker < threadCount; ++worker)
+		workers.push_back(thread(CornerInfo::expandLevel, std::ref(level)));
+
+	    CornerInfo::expandLevel(level);
+
+	    for(size_t worker = 0; worker < workers.size(); ++worker)
+		workers[worker].join();
+
+	    known += level.found.load();
+
+	    if(log)
+		*log << "\tdepth " << (depth + 1) << ": " << level.found.load() << " positions"
+		     << (level.backward ? " (backward)" : "") << ", "
+		     << std::chrono::duration<double>(generate_clock::now() - start).count() << " s" << endl;
+
+	    if(level.found.load() == 0) break;
+	}
+
+	if(known != ENTRY_COUNT) {
+	    stringstream buffer;
+
+	    buffer << "Corner search only reached " << known << " of " << ENTRY_COUNT << " positions.";
+
+	    throw CubeException(buffer.str());
+	}
+
+	// Pack words into little-endian nibble bytes.
+	vector<uint8_t> data((size_t)(ENTRY_COUNT/2));
+
+	for(uint64_t word = 0; word < wordCount; ++word) {
+	    uint32_t value = words[word].load(std::memory_order_relaxed);
+
+	    for(int byte = 0; byte < 4; ++byte)
+		data[(size_t)(4*word + byte)] = (uint8_t)(value >> (8*byte));
+	}
+
+	CornerInfo::DatabaseHeader header;
+	char headerBlock[CornerInfo::HEADER_SIZE];
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CornerInfo::databaseMagic, sizeof(header.magic));
+	header.version = VERSION;
+	header.headerSize = CornerInfo::HEADER_SIZE;
+	header.entryCount = ENTRY_COUNT;
+	header.checksum = CornerInfo::hash(&data[0], data.size());
+
+	memset(headerBlock, 0, sizeof(headerBlock));
+	memcpy(headerBlock, &header, sizeof(header));
+
+	// Same as the solver tables: a temporary, swapped in once complete.
+	string temporary = filename + ".tmp";
+	ofstream output(temporary.c_str(), ios::out | ios::binary | ios::trunc);
+
+	output.write(headerBlock, sizeof(headerBlock)).write((const char*)&data[0], data.size());
+	output.close();
+
+	if(!output) {
+	    stringstream buffer;
+
+	    remove(temporary.c_str());
+	    buffer << "Could not write corner database to \"" << temporary << "\".";
+
+	    throw CubeException(buffer.str());
+	}
+
+	if(!sysu::replaceFile(temporary, filename)) {
+	    stringstream buffer;
+
+	    buffer << "Could not move corner database into \"" << filename << "\".";
+
+	    throw CubeException(buffer.str());
+	}
+    }
+}
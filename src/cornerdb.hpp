@@ -0,0 +1,53 @@
+#ifndef CUBE_CORNER_DATABASE
+#define CUBE_CORNER_DATABASE
+
+#include <ostream>
+#include <string>
+
+#include <stdint.h>
+
+#include "cube.hpp"
+#include "solver.hpp"
+#include "mappedfile.hpp"
+
+namespace cube
+{
+    // Korf's corner pattern database: the exact distance to solved corners
+    // for every corner permutation and twist (8!*3^7 = 88179840 entries),
+    // stored as 4 bit nibbles, low nibble first.
+    class CornerDatabase
+    {
+    private:
+	sysu::MappedFile file;
+	const uint8_t* nibbles;
+	uint64_t checksum;
+
+	// Prevent object copying
+	CornerDatabase(const CornerDatabase& other) {}
+	CornerDatabase& operator=(const CornerDatabase& other) { return *this; }
+
+    public:
+	enum { VERSION = 1 };
+	static const uint64_t ENTRY_COUNT = (uint64_t)CORNER_PERMUTATION_COUNT*TWIST_COUNT;
+
+	// Map a database file, checking its header (not its checksum).
+	CornerDatabase(const std::string& filename) throw (CubeException);
+
+	// Distance lookup
+	int getDistance(int cornerPermutation, int twist) const
+	{
+	    uint64_t index = (uint64_t)cornerPermutation*TWIST_COUNT + twist;
+	    return (nibbles[index >> 1] >> ((index & 1) << 2)) & 0x0F;
+	}
+
+	// Recompute the checksum over the whole table.
+	bool verify(void) const;
+
+	// Breadth-first generation over threadCount threads (0 = all), then
+	// write a checksummed file. Progress goes to log when given.
+	static void generate(const SolverTables& tables, const std::string& filename,
+			     int threadCount = 0, std::ostream* log = NULL) throw (CubeException);
+    };
+}
+
+#endif
@@ -0,0 +1,472 @@
+#include "cube.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::stringstream;
+using std::vector;
+
+namespace cube
+{
+    namespace CubeInfo {
+	// Base quarter turns (U, R, F, D, L, B), after Kociemba's cubie model.
+	const MoveDefinition baseMoves[FACE_COUNT] = {
+	    // U
+	    {{UBR, URF, UFL, ULB, DFR, DLF, DBL, DRB}, {0, 0, 0, 0, 0, 0, 0, 0},
+	     {UB, UR, UF, UL, DR, DF, DL, DB, FR, FL, BL, BR}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+	    // R
+	    {{DFR, UFL, ULB, URF, DRB, DLF, DBL, UBR}, {2, 0, 0, 1, 1, 0, 0, 2},
+	     {FR, UF, UL, UB, BR, DF, DL, DB, DR, FL, BL, UR}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+	    // F
+	    {{UFL, DLF, ULB, UBR, URF, DFR, DBL, DRB}, {1, 2, 0, 0, 2, 1, 0, 0},
+	     {UR, FL, UL, UB, DR, FR, DL, DB, UF, DF, BL, BR}, {0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0}},
+	    // D
+	    {{URF, UFL, ULB, UBR, DLF, DBL, DRB, DFR}, {0, 0, 0, 0, 0, 0, 0, 0},
+	     {UR, UF, UL, UB, DF, DL, DB, DR, FR, FL, BL, BR}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+	    // L
+	    {{URF, ULB, DBL, UBR, DFR, UFL, DLF, DRB}, {0, 1, 2, 0, 0, 2, 1, 0},
+	     {UR, UF, BL, UB, DR, DF, FL, DB, FR, UL, DL, BR}, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}},
+	    // B
+	    {{URF, UFL, UBR, DRB, DFR, DLF, ULB, DBL}, {0, 0, 1, 2, 0, 0, 2, 1},
+	     {UR, UF, UL, BR, DR, DF, DL, BL, FR, FL, UB, DB}, {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1}}
+	};
+
+	// Faces touched by each corner/edge slot, in facelet order.
+	const Face cornerFaces[CORNER_COUNT][3] = {
+	    {FACE_U, FACE_R, FACE_F}, {FACE_U, FACE_F, FACE_L}, {FACE_U, FACE_L, FACE_B}, {FACE_U, FACE_B, FACE_R},
+	    {FACE_D, FACE_F, FACE_R}, {FACE_D, FACE_L, FACE_F}, {FACE_D, FACE_B, FACE_L}, {FACE_D, FACE_R, FACE_B}
+	};
+
+	const Face edgeFaces[EDGE_COUNT][2] = {
+	    {FACE_U, FACE_R}, {FACE_U, FACE_F}, {FACE_U, FACE_L}, {FACE_U, FACE_B},
+	    {FACE_D, FACE_R}, {FACE_D, FACE_F}, {FACE_D, FACE_L}, {FACE_D, FACE_B},
+	    {FACE_F, FACE_R}, {FACE_F, FACE_L}, {FACE_B, FACE_L}, {FACE_B, FACE_R}
+	};
+
+	// Facelet indices of each corner/edge slot, matching cornerFaces/edgeFaces.
+	const uint8_t cornerFacelets[CORNER_COUNT][3] = {
+	    {8, 9, 20}, {6, 18, 38}, {0, 36, 47}, {2, 45, 11},
+	    {29, 26, 15}, {27, 44, 24}, {33, 53, 42}, {35, 17, 51}
+	};
+
+	const uint8_t edgeFacelets[EDGE_COUNT][2] = {
+	    {5, 10}, {7, 19}, {3, 37}, {1, 46}, {32, 16}, {28, 25},
+	    {30, 43}, {34, 52}, {23, 12}, {21, 41}, {50, 39}, {48, 14}
+	};
+
+	// Unit direction of each face.
+	const int faceDirections[FACE_COUNT][3] = {
+	    {0, 1, 0}, {1, 0, 0}, {0, 0, 1}, {0, -1, 0}, {-1, 0, 0}, {0, 0, -1}
+	};
+
+	const char faceNames[FACE_COUNT + 1] = "URFDLB";
+	const char* moveNames[MOVE_COUNT] = {
+	    "U", "U2", "U'", "R", "R2", "R'", "F", "F2", "F'",
+	    "D", "D2", "D'", "L", "L2", "L'", "B", "B2", "B'"
+	};
+
+	// Everything apply() needs for one move, precomputed.
+	struct MoveTable
+	{
+	    MoveDefinition definitions[MOVE_COUNT];
+	    uint8_t cornerTwist[32][3]; // packed corner byte + twist -> packed corner byte
+	};
+
+	// Compose two cubie-level moves (first a, then b).
+	void multiply(const MoveDefinition& a, const MoveDefinition& b, MoveDefinition& result)
+	{
+	    for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+		result.cornerPermutation[slot] = a.cornerPermutation[b.cornerPermutation[slot]];
+		result.cornerOrientation[slot] = (a.cornerOrientation[b.cornerPermutation[slot]] + b.cornerOrientation[slot]) % 3;
+	    }
+
+	    for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+		result.edgePermutation[slot] = a.edgePermutation[b.edgePermutation[slot]];
+		result.edgeOrientation[slot] = (a.edgeOrientation[b.edgePermutation[slot]] + b.edgeOrientation[slot]) % 2;
+	    }
+	}
+
+	MoveTable buildMoveTable(void)
+	{
+	    MoveTable table;
+
+	    // Half and counter-clockwise turns are repeated quarter turns.
+	    for(int face = 0; face < FACE_COUNT; ++face) {
+		table.definitions[3*face] = baseMoves[face];
+		multiply(table.definitions[3*face], baseMoves[face], table.definitions[3*face + 1]);
+		multiply(table.definitions[3*face + 1], baseMoves[face], table.definitions[3*face + 2]);
+	    }
+
+	    for(int packed = 0; packed < 32; ++packed)
+		for(int twist = 0; twist < 3; ++twist)
+		    table.cornerTwist[packed][twist] = (uint8_t)((packed & 0x07) | ((((packed >> 3) + twist) % 3) << 3));
+
+	    return table;
+	}
+
+	const MoveTable& getMoveTable(void)
+	{
+	    static const MoveTable table = buildMoveTable();
+
+	    return table;
+	}
+    }
+
+    // Solved constructor
+    State::State(void):
+	corners(0), edges(0)
+    {
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    corners |= (uint64_t)slot << (8*slot);
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    edges |= (uint64_t)slot << (5*slot);
+    }
+
+    // Cubie constructor
+    State::State(const uint8_t cornerPermutation[CORNER_COUNT], const uint8_t cornerOrientation[CORNER_COUNT],
+		 const uint8_t edgePermutation[EDGE_COUNT], const uint8_t edgeOrientation[EDGE_COUNT]):
+	corners(0), edges(0)
+    {
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    corners |= (uint64_t)((cornerPermutation[slot] & 0x07) | ((cornerOrientation[slot] % 3) << 3)) << (8*slot);
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    edges |= (uint64_t)((edgePermutation[slot] & 0x0F) | ((edgeOrientation[slot] & 0x01) << 4)) << (5*slot);
+    }
+
+    // Apply a single face turn
+    void State::apply(Move move)
+    {
+	const CubeInfo::MoveTable& table = CubeInfo::getMoveTable();
+	const MoveDefinition& definition = table.definitions[move];
+	uint64_t newCorners = 0;
+	uint64_t newEdges = 0;
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+	    int packed = (int)((corners >> (8*definition.cornerPermutation[slot])) & 0x1F);
+	    newCorners |= (uint64_t)table.cornerTwist[packed][definition.cornerOrientation[slot]] << (8*slot);
+	}
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+	    uint64_t packed = (edges >> (5*definition.edgePermutation[slot])) & 0x1F;
+	    newEdges |= (packed ^ ((uint64_t)definition.edgeOrientation[slot] << 4)) << (5*slot);
+	}
+
+	corners = newCorners;
+	edges = newEdges;
+    }
+
+    // Apply a move sequence
+    void State::apply(const vector<Move>& moves)
+    {
+	for(size_t move = 0; move < moves.size(); ++move)
+	    apply(moves[move]);
+    }
+
+    // Check against the solved cube
+    bool State::isSolved(void) const
+    {
+	static const State solved;
+
+	return *this == solved;
+    }
+
+    // Check that the state is reachable by face turns
+    bool State::isValid(void) const
+    {
+	int cornerSeen = 0, edgeSeen = 0;
+	int twist = 0, flip = 0;
+	int cornerParity = 0, edgeParity = 0;
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+	    if(getCornerTwist(slot) > 2) return false;
+
+	    cornerSeen |= 1 << getCorner(slot);
+	    twist += getCornerTwist(slot);
+
+	    for(int other = slot + 1; other < CORNER_COUNT; ++other)
+		if(getCorner(other) < getCorner(slot))
+		    cornerParity ^= 1;
+	}
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+	    if(getEdge(slot) >= EDGE_COUNT) return false;
+
+	    edgeSeen |= 1 << getEdge(slot);
+	    flip += getEdgeFlip(slot);
+
+	    for(int other = slot + 1; other < EDGE_COUNT; ++other)
+		if(getEdge(other) < getEdge(slot))
+		    edgeParity ^= 1;
+	}
+
+	return cornerSeen == (1 << CORNER_COUNT) - 1
+	    && edgeSeen == (1 << EDGE_COUNT) - 1
+	    && twist % 3 == 0
+	    && flip % 2 == 0
+	    && cornerParity == edgeParity;
+    }
+
+    // Slots that changed between two states
+    uint32_t State::diff(const State& other) const
+    {
+	uint64_t cornerDelta = corners ^ other.corners;
+	uint64_t edgeDelta = edges ^ other.edges;
+	uint32_t mask = 0;
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    if((cornerDelta >> (8*slot)) & 0xFF)
+		mask |= 1u << (FIRST_CORNER_SLOT + slot);
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    if((edgeDelta >> (5*slot)) & 0x1F)
+		mask |= 1u << (FIRST_EDGE_SLOT + slot);
+
+	return mask;
+    }
+
+    // Expand to facelet colors
+    void State::getFacelets(uint8_t facelets[FACELET_COUNT]) const
+    {
+	// Centers never move.
+	for(int face = 0; face < FACE_COUNT; ++face)
+	    facelets[9*face + 4] = (uint8_t)face;
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+	    int corner = getCorner(slot);
+	    int twist = getCornerTwist(slot);
+
+	    for(int n = 0; n < 3; ++n)
+		facelets[CubeInfo::cornerFacelets[slot][(n + twist) % 3]] = (uint8_t)CubeInfo::cornerFaces[corner][n];
+	}
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+	    int edge = getEdge(slot);
+	    int flip = getEdgeFlip(slot);
+
+	    for(int n = 0; n < 2; ++n)
+		facelets[CubeInfo::edgeFacelets[slot][(n + flip) % 2]] = (uint8_t)CubeInfo::edgeFaces[edge][n];
+	}
+    }
+
+    // Rotation carrying a cubie from its home slot into its current one
+    void State::getRotation(int slot, int rotation[9]) const
+    {
+	int home[3][3], target[3][3];
+
+	for(int entry = 0; entry < 9; ++entry)
+	    rotation[entry] = (entry % 4 == 0) ? 1 : 0;
+
+	if(slot < FIRST_EDGE_SLOT) {
+	    int corner = getCorner(slot);
+	    int twist = getCornerTwist(slot);
+
+	    for(int n = 0; n < 3; ++n)
+		for(int axis = 0; axis < 3; ++axis) {
+		    home[n][axis] = CubeInfo::faceDirections[CubeInfo::cornerFaces[corner][n]][axis];
+		    target[n][axis] = CubeInfo::faceDirections[CubeInfo::cornerFaces[slot][(n + twist) % 3]][axis];
+		}
+	} else if(slot < FIRST_CENTER_SLOT) {
+	    int edge = getEdge(slot - FIRST_EDGE_SLOT);
+	    int flip = getEdgeFlip(slot - FIRST_EDGE_SLOT);
+
+	    for(int n = 0; n < 2; ++n)
+		for(int axis = 0; axis < 3; ++axis) {
+		    home[n][axis] = CubeInfo::faceDirections[CubeInfo::edgeFaces[edge][n]][axis];
+		    target[n][axis] = CubeInfo::faceDirections[CubeInfo::edgeFaces[slot - FIRST_EDGE_SLOT][(n + flip) % 2]][axis];
+		}
+
+	    // The third axis follows from the first two.
+	    for(int axis = 0; axis < 3; ++axis) {
+		int next = (axis + 1) % 3, last = (axis + 2) % 3;
+
+		home[2][axis] = home[0][next]*home[1][last] - home[0][last]*home[1][next];
+		target[2][axis] = target[0][next]*target[1][last] - target[0][last]*target[1][next];
+	    }
+	} else {
+	    // Centers only ever spin in place, which is invisible.
+	    return;
+	}
+
+	// rotation = sum(target_n * home_n^T), stored column-major.
+	for(int column = 0; column < 3; ++column)
+	    for(int row = 0; row < 3; ++row) {
+		int value = 0;
+
+		for(int n = 0; n < 3; ++n)
+		    value += target[n][row]*home[n][column];
+
+		rotation[3*column + row] = value;
+	    }
+    }
+
+    // Move definition accessor
+    const MoveDefinition& getMoveDefinition(Move move)
+    {
+	return CubeInfo::getMoveTable().definitions[move];
+    }
+
+    // Move name accessor
+    const char* getMoveName(Move move)
+    {
+	return CubeInfo::moveNames[move];
+    }
+
+    // Slot position accessor
+    void getSlotPosition(int slot, int position[3])
+    {
+	for(int axis = 0; axis < 3; ++axis)
+	    position[axis] = 0;
+
+	if(slot < FIRST_EDGE_SLOT) {
+	    for(int n = 0; n < 3; ++n)
+		for(int axis = 0; axis < 3; ++axis)
+		    position[axis] += CubeInfo::faceDirections[CubeInfo::cornerFaces[slot][n]][axis];
+	} else if(slot < FIRST_CENTER_SLOT) {
+	    for(int n = 0; n < 2; ++n)
+		for(int axis = 0; axis < 3; ++axis)
+		    position[axis] += CubeInfo::faceDirections[CubeInfo::edgeFaces[slot - FIRST_EDGE_SLOT][n]][axis];
+	} else {
+	    for(int axis = 0; axis < 3; ++axis)
+		position[axis] = CubeInfo::faceDirections[slot - FIRST_CENTER_SLOT][axis];
+	}
+    }
+
+    // Layer membership from the slot grid
+    uint32_t getFaceSlots(Face face)
+    {
+	int direction[3];
+	uint32_t slots = 0;
+
+	getSlotPosition(FIRST_CENTER_SLOT + face, direction);
+
+	for(int slot = 0; slot < SLOT_COUNT; ++slot) {
+	    int position[3];
+
+	    getSlotPosition(slot, position);
+
+	    if(position[0]*direction[0] + position[1]*direction[1] + position[2]*direction[2] == 1)
+		slots |= 1u << slot;
+	}
+
+	return slots;
+    }
+
+    // Parse a move string such as "R U R' U2"
+    vector<Move> parseMoves(const string& moves)
+	throw(CubeException)
+    {
+	vector<Move> result;
+	stringstream tokens(moves);
+	string token;
+
+	while(tokens >> token) {
+	    string::size_type face = string(CubeInfo::faceNames).find(token[0]);
+	    int turns = 0;
+
+	    if(face != string::npos) {
+		if(token.size() == 1)
+		    turns = 1;
+		else if(token.size() == 2 && token[1] == '2')
+		    turns = 2;
+		else if(token.size() == 2 && (token[1] == '\'' || token[1] == '3'))
+		    turns = 3;
+	    }
+
+	    if(turns == 0) {
+		stringstream buffer;
+
+		buffer << "Unrecognized move \'" << token << "\'!";
+
+		throw CubeException(buffer.str());
+	    }
+
+	    result.push_back((Move)(3*face + turns - 1));
+	}
+
+	return result;
+    }
+
+    // Format a move sequence
+    string toString(const vector<Move>& moves)
+    {
+	stringstream buffer;
+
+	for(size_t move = 0; move < moves.size(); ++move)
+	    buffer << (move != 0 ? " " : "") << getMoveName(moves[move]);
+
+	return buffer.str();
+    }
+
+    // Read a facelet string back into cubies
+    State parseFacelets(const string& facelets)
+	throw(CubeException)
+    {
+	uint8_t colors[FACELET_COUNT];
+	uint8_t cornerPermutation[CORNER_COUNT], cornerOrientation[CORNER_COUNT];
+	uint8_t edgePermutation[EDGE_COUNT], edgeOrientation[EDGE_COUNT];
+	bool valid = facelets.size() == FACELET_COUNT;
+
+	for(int facelet = 0; valid && facelet < FACELET_COUNT; ++facelet) {
+	    string::size_type face = string(CubeInfo::faceNames).find(facelets[facelet]);
+
+	    valid = face != string::npos;
+	    colors[facelet] = (uint8_t)face;
+	}
+
+	// Centers fix the orientation of the whole puzzle.
+	for(int face = 0; valid && face < FACE_COUNT; ++face)
+	    valid = colors[9*face + 4] == face;
+
+	// Each slot's stickers must be some cubie at some twist.
+	for(int slot = 0; valid && slot < CORNER_COUNT; ++slot) {
+	    valid = false;
+
+	    for(int corner = 0; !valid && corner < CORNER_COUNT; ++corner)
+		for(int twist = 0; !valid && twist < 3; ++twist) {
+		    valid = true;
+
+		    for(int n = 0; n < 3; ++n)
+			valid = valid && colors[CubeInfo::cornerFacelets[slot][(n + twist) % 3]] == CubeInfo::cornerFaces[corner][n];
+
+		    cornerPermutation[slot] = (uint8_t)corner;
+		    cornerOrientation[slot] = (uint8_t)twist;
+		}
+	}
+
+	for(int slot = 0; valid && slot < EDGE_COUNT; ++slot) {
+	    valid = false;
+
+	    for(int edge = 0; !valid && edge < EDGE_COUNT; ++edge)
+		for(int flip = 0; !valid && flip < 2; ++flip) {
+		    valid = true;
+
+		    for(int n = 0; n < 2; ++n)
+			valid = valid && colors[CubeInfo::edgeFacelets[slot][(n + flip) % 2]] == CubeInfo::edgeFaces[edge][n];
+
+		    edgePermutation[slot] = (uint8_t)edge;
+		    edgeOrientation[slot] = (uint8_t)flip;
+		}
+	}
+
+	State state;
+
+	if(valid) {
+	    state = State(cornerPermutation, cornerOrientation, edgePermutation, edgeOrientation);
+	    valid = state.isValid();
+	}
+
+	if(!valid) {
+	    stringstream buffer;
+
+	    buffer << "Invalid facelets \'" << facelets << "\'!";
+
+	    throw CubeException(buffer.str());
+	}
+
+	return state;
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef CUBE_STATE
+#define CUBE_STATE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+namespace cube
+{
+    // Faces, in facelet order (U1..U9, R1..R9, F1..F9, D1..D9, L1..L9, B1..B9)
+    enum Face
+    {
+	FACE_U, FACE_R, FACE_F, FACE_D, FACE_L, FACE_B,
+	FACE_COUNT
+    };
+
+    // Corner cubies and slots, named by the faces they touch (clockwise).
+    enum Corner
+    {
+	URF, UFL, ULB, UBR, DFR, DLF, DBL, DRB,
+	CORNER_COUNT
+    };
+
+    // Edge cubies and slots, named by the faces they touch.
+    enum Edge
+    {
+	UR, UF, UL, UB, DR, DF, DL, DB, FR, FL, BL, BR,
+	EDGE_COUNT
+    };
+
+    // Face turns, 1 = clockwise quarter, 2 = half, 3 = counter-clockwise quarter.
+    enum Move
+    {
+	U1, U2, U3,
+	R1, R2, R3,
+	F1, F2, F3,
+	D1, D2, D3,
+	L1, L2, L3,
+	B1, B2, B3,
+	MOVE_COUNT,
+	MOVE_NONE = MOVE_COUNT
+    };
+
+    // Slot numbering used for rendering: corners, then edges, then centers.
+    enum
+    {
+	FIRST_CORNER_SLOT = 0,
+	FIRST_EDGE_SLOT = CORNER_COUNT,
+	FIRST_CENTER_SLOT = CORNER_COUNT + EDGE_COUNT,
+	SLOT_COUNT = CORNER_COUNT + EDGE_COUNT + FACE_COUNT,
+	FACELET_COUNT = 9*FACE_COUNT
+    };
+
+    // Cubie-level description of a move: slot i receives the cubie from slot
+    // permutation[i], with its orientation increased by orientation[i].
+    struct MoveDefinition
+    {
+	uint8_t cornerPermutation[CORNER_COUNT];
+	uint8_t cornerOrientation[CORNER_COUNT];
+	uint8_t edgePermutation[EDGE_COUNT];
+	uint8_t edgeOrientation[EDGE_COUNT];
+    };
+
+    class CubeException: public std::runtime_error
+    {
+    public:
+	CubeException(const std::string &msg): std::runtime_error(msg) {}
+    };
+
+    // Puzzle state packed into two words.
+    //   corners: one byte per slot, bits 0-2 cubie, bits 3-4 twist (0..2)
+    //   edges:   five bits per slot, bits 0-3 cubie, bit 4 flip
+    class State
+    {
+    private:
+	uint64_t corners;
+	uint64_t edges;
+
+    public:
+	// Constructors, default is the solved cube.
+	State(void);
+	State(const uint8_t cornerPermutation[CORNER_COUNT], const uint8_t cornerOrientation[CORNER_COUNT],
+	      const uint8_t edgePermutation[EDGE_COUNT], const uint8_t edgeOrientation[EDGE_COUNT]);
+
+	// Raw accessors
+	uint64_t getCornerBits(void) const { return corners; }
+	uint64_t getEdgeBits(void) const { return edges; }
+
+	// Cubie accessors
+	int getCorner(int slot) const { return (int)((corners >> (8*slot)) & 0x07); }
+	int getCornerTwist(int slot) const { return (int)((corners >> (8*slot + 3)) & 0x03); }
+	int getEdge(int slot) const { return (int)((edges >> (5*slot)) & 0x0F); }
+	int getEdgeFlip(int slot) const { return (int)((edges >> (5*slot + 4)) & 0x01); }
+
+	// Moves
+	void apply(Move move);
+	void apply(const std::vector<Move>& moves);
+
+	// Status functions
+	bool isSolved(void) const;
+	bool isValid(void) const;
+
+	// Bitmask of the cubie slots (see FIRST_*_SLOT) that differ from other.
+	uint32_t diff(const State& other) const;
+
+	// Face color (Face value) for each of the 54 facelets.
+	void getFacelets(uint8_t facelets[FACELET_COUNT]) const;
+
+	// Integer rotation (column-major 3x3) of the cubie sitting in a slot,
+	// relative to its solved orientation.
+	void getRotation(int slot, int rotation[9]) const;
+
+	bool operator==(const State& other) const { return corners == other.corners && edges == other.edges; }
+	bool operator!=(const State& other) const { return !(*this == other); }
+    };
+
+    // Move helpers
+    const MoveDefinition& getMoveDefinition(Move move);
+    inline Face getMoveFace(Move move) { return (Face)(move/3); }
+    inline Move getInverse(Move move) { return (Move)(move - move%3 + (2 - move%3)); }
+    const char* getMoveName(Move move);
+
+    // Slot position on the {-1, 0, 1} grid (x = R, y = U, z = F).
+    void getSlotPosition(int slot, int position[3]);
+
+    // Bitmask of the slots in a face's layer (four corners, four edges and
+    // the center), i.e. the cubies a turn of that face carries along.
+    uint32_t getFaceSlots(Face face);
+
+    // Move string conversion, e.g. "R U R' U2"
+    std::vector<Move> parseMoves(const std::string& moves) throw (CubeException);
+    std::string toString(const std::vector<Move>& moves);
+
+    // Facelet string conversion: 54 face letters (URFDLB) in getFacelets()
+    // order, e.g. "UUUUUUUUURRRRRRRRRFFFFFFFFFDDDDDDDDDLLLLLLLLLBBBBBBBBB".
+    // Throws unless the stickers make up a reachable state.
+    State parseFacelets(const std::string& facelets) throw (CubeException);
+}
+
+#endif
@@ -0,0 +1,245 @@
+#include "cubies.hpp"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CUBIES_X86
+#include <immintrin.h>
+#endif
+
+namespace cube
+{
+    namespace CubiesInfo {
+	// Shuffle controls and orientation deltas per move, edges in the low
+	// lane and corners in the high lane. 0x80 zeroes the padding bytes.
+	struct ShuffleTable
+	{
+	    alignas(32) uint8_t permutation[MOVE_COUNT][32];
+	    alignas(32) uint8_t orientation[MOVE_COUNT][32];
+	    alignas(32) uint8_t modulus[32];
+	};
+
+	ShuffleTable buildShuffleTable(void)
+	{
+	    ShuffleTable table;
+
+	    memset(&table, 0, sizeof(table));
+
+	    for(int move = 0; move < MOVE_COUNT; ++move) {
+		const MoveDefinition& definition = getMoveDefinition((Move)move);
+
+		memset(table.permutation[move], 0x80, 32);
+
+		for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+		    table.permutation[move][slot] = definition.edgePermutation[slot];
+		    table.orientation[move][slot] = (uint8_t)(definition.edgeOrientation[slot] << 4);
+		}
+
+		for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+		    table.permutation[move][16 + slot] = definition.cornerPermutation[slot];
+		    table.orientation[move][16 + slot] = (uint8_t)(definition.cornerOrientation[slot] << 4);
+		}
+	    }
+
+	    // Orientations wrap at 2 for edges, 3 for corners.
+	    for(int byte = 0; byte < 16; ++byte) {
+		table.modulus[byte] = 2 << 4;
+		table.modulus[16 + byte] = 3 << 4;
+	    }
+
+	    return table;
+	}
+
+	const ShuffleTable& getShuffleTable(void)
+	{
+	    static const ShuffleTable table = buildShuffleTable();
+
+	    return table;
+	}
+
+	// Reference kernel, one byte at a time.
+	void applyScalar(Cubies& cubies, const Move* moves, size_t count)
+	{
+	    const ShuffleTable& table = getShuffleTable();
+
+	    for(size_t move = 0; move < count; ++move) {
+		const uint8_t* permutation = table.permutation[moves[move]];
+		const uint8_t* orientation = table.orientation[moves[move]];
+		Cubies previous = cubies;
+
+		for(int byte = 0; byte < 32; ++byte) {
+		    const uint8_t* source = (byte < 16) ? previous.edges : previous.corners;
+		    uint8_t* destination = (byte < 16) ? cubies.edges : cubies.corners;
+		    uint8_t control = permutation[byte];
+		    uint8_t value = (control & 0x80) ? 0 : source[control & 0x0F];
+
+		    value = (uint8_t)(value + orientation[byte]);
+
+		    if(value >= table.modulus[byte])
+			value = (uint8_t)(value - table.modulus[byte]);
+
+		    destination[byte & 0x0F] = value;
+		}
+	    }
+	}
+
+#ifdef CUBIES_X86
+	// PSHUFB per lane; min(x, x - m) wraps the orientation since x - m
+	// underflows to a large value whenever x < m.
+	__attribute__((target("ssse3")))
+	void applySSSE3(Cubies& cubies, const Move* moves, size_t count)
+	{
+	    const ShuffleTable& table = getShuffleTable();
+	    __m128i edges = _mm_load_si128((const __m128i*)cubies.edges);
+	    __m128i corners = _mm_load_si128((const __m128i*)cubies.corners);
+	    const __m128i edgeModulus = _mm_load_si128((const __m128i*)table.modulus);
+	    const __m128i cornerModulus = _mm_load_si128((const __m128i*)(table.modulus + 16));
+
+	    for(size_t move = 0; move < count; ++move) {
+		const __m128i* permutation = (const __m128i*)table.permutation[moves[move]];
+		const __m128i* orientation = (const __m128i*)table.orientation[moves[move]];
+
+		edges = _mm_add_epi8(_mm_shuffle_epi8(edges, _mm_load_si128(permutation)), _mm_load_si128(orientation));
+		corners = _mm_add_epi8(_mm_shuffle_epi8(corners, _mm_load_si128(permutation + 1)), _mm_load_si128(orientation + 1));
+
+		edges = _mm_min_epu8(edges, _mm_sub_epi8(edges, edgeModulus));
+		corners = _mm_min_epu8(corners, _mm_sub_epi8(corners, cornerModulus));
+	    }
+
+	    _mm_store_si128((__m128i*)cubies.edges, edges);
+	    _mm_store_si128((__m128i*)cubies.corners, corners);
+	}
+
+	// VPSHUFB shuffles within 128 bit lanes, so both halves go at once.
+	__attribute__((target("avx2")))
+	void applyAVX2(Cubies& cubies, const Move* moves, size_t count)
+	{
+	    const ShuffleTable& table = getShuffleTable();
+	    __m256i lanes = _mm256_load_si256((const __m256i*)cubies.edges);
+	    const __m256i modulus = _mm256_load_si256((const __m256i*)table.modulus);
+
+	    for(size_t move = 0; move < count; ++move) {
+		const __m256i permutation = _mm256_load_si256((const __m256i*)table.permutation[moves[move]]);
+		const __m256i orientation = _mm256_load_si256((const __m256i*)table.orientation[moves[move]]);
+
+		lanes = _mm256_add_epi8(_mm256_shuffle_epi8(lanes, permutation), orientation);
+		lanes = _mm256_min_epu8(lanes, _mm256_sub_epi8(lanes, modulus));
+	    }
+
+	    _mm256_store_si256((__m256i*)cubies.edges, lanes);
+	}
+#endif
+
+	const char* kernelNames[KERNEL_COUNT] = {"scalar", "ssse3", "avx2"};
+    }
+
+    // Solved constructor
+    Cubies::Cubies(void)
+    {
+	memset(edges, 0, sizeof(edges));
+	memset(corners, 0, sizeof(corners));
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    edges[slot] = (uint8_t)slot;
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    corners[slot] = (uint8_t)slot;
+    }
+
+    // Unpack from state
+    Cubies::Cubies(const State& state)
+    {
+	memset(edges, 0, sizeof(edges));
+	memset(corners, 0, sizeof(corners));
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot)
+	    edges[slot] = (uint8_t)(state.getEdge(slot) | (state.getEdgeFlip(slot) << 4));
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    corners[slot] = (uint8_t)(state.getCorner(slot) | (state.getCornerTwist(slot) << 4));
+    }
+
+    // Pack into state
+    State Cubies::toState(void) const
+    {
+	uint8_t cornerPermutation[CORNER_COUNT], cornerOrientation[CORNER_COUNT];
+	uint8_t edgePermutation[EDGE_COUNT], edgeOrientation[EDGE_COUNT];
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot) {
+	    cornerPermutation[slot] = corners[slot] & 0x0F;
+	    cornerOrientation[slot] = corners[slot] >> 4;
+	}
+
+	for(int slot = 0; slot < EDGE_COUNT; ++slot) {
+	    edgePermutation[slot] = edges[slot] & 0x0F;
+	    edgeOrientation[slot] = edges[slot] >> 4;
+	}
+
+	return State(cornerPermutation, cornerOrientation, edgePermutation, edgeOrientation);
+    }
+
+    // Comparison
+    bool Cubies::operator==(const Cubies& other) const
+    {
+	return memcmp(edges, other.edges, sizeof(edges)) == 0 && memcmp(corners, other.corners, sizeof(corners)) == 0;
+    }
+
+    // Check the CPU for a kernel's instruction set
+    bool isKernelSupported(Kernel kernel)
+    {
+	switch(kernel) {
+	case KERNEL_SCALAR: return true; break;
+#ifdef CUBIES_X86
+	case KERNEL_SSSE3:  return __builtin_cpu_supports("ssse3") != 0; break;
+	case KERNEL_AVX2:   return __builtin_cpu_supports("avx2") != 0; break;
+#endif
+	default:            return false; break;
+	}
+    }
+
+    // Pick the widest supported kernel
+    Kernel getBestKernel(void)
+    {
+	static Kernel best = KERNEL_COUNT;
+
+	if(best == KERNEL_COUNT) {
+	    best = KERNEL_SCALAR;
+
+	    for(int kernel = KERNEL_COUNT - 1; kernel > KERNEL_SCALAR; --kernel)
+		if(isKernelSupported((Kernel)kernel)) {
+		    best = (Kernel)kernel;
+
+		    break;
+		}
+	}
+
+	return best;
+    }
+
+    // Kernel name accessor
+    const char* getKernelName(Kernel kernel)
+    {
+	return CubiesInfo::kernelNames[kernel];
+    }
+
+    // Runtime-dispatched move application
+    void applyMoves(Cubies& cubies, const Move* moves, size_t count)
+    {
+	applyMoves(getBestKernel(), cubies, moves, count);
+    }
+
+    // Kernel-specific move application, unsupported kernels fall back to scalar.
+    void applyMoves(Kernel kernel, Cubies& cubies, const Move* moves, size_t count)
+    {
+	if(!isKernelSupported(kernel))
+	    kernel = KERNEL_SCALAR;
+
+	switch(kernel) {
+#ifdef CUBIES_X86
+	case KERNEL_SSSE3: CubiesInfo::applySSSE3(cubies, moves, count); break;
+	case KERNEL_AVX2:  CubiesInfo::applyAVX2(cubies, moves, count); break;
+#endif
+	default:           CubiesInfo::applyScalar(cubies, moves, count); break;
+	}
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef CUBE_CUBIES
+#define CUBE_CUBIES
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cube.hpp"
+
+namespace cube
+{
+    // Move kernels, in order of preference.
+    enum Kernel
+    {
+	KERNEL_SCALAR,
+	KERNEL_SSSE3,
+	KERNEL_AVX2,
+	KERNEL_COUNT
+    };
+
+    // One byte per cubie (bits 0-3 cubie, bits 4-5 orientation), laid out as
+    // two 16 byte lanes so a face turn is a single byte shuffle per lane.
+    // Unused bytes are kept at zero.
+    struct Cubies
+    {
+	alignas(32) uint8_t edges[16];
+	uint8_t corners[16];
+
+	// Conversion to and from the packed state
+	Cubies(void);
+	explicit Cubies(const State& state);
+	State toState(void) const;
+
+	bool operator==(const Cubies& other) const;
+	bool operator!=(const Cubies& other) const { return !(*this == other); }
+    };
+
+    // Kernel selection
+    bool isKernelSupported(Kernel kernel);
+    Kernel getBestKernel(void);
+    const char* getKernelName(Kernel kernel);
+
+    // Apply a stream of moves, using the best kernel the CPU supports.
+    void applyMoves(Cubies& cubies, const Move* moves, size_t count);
+    void applyMoves(Kernel kernel, Cubies& cubies, const Move* moves, size_t count);
+}
+
+#endif
@@ -1,5 +1,8 @@
 #include <algorithm>
 #include <vector>
+#include <utility>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stddef.h>
 #include "gl_core_4_4.hpp"
@@ -91,7 +94,22 @@ static PROC WinGetProcAddress(const char *name)
 		#else /* GLX */
 		    #include <GL/glx.h>
 
-			#define IntGetProcAddress(name) (*glXGetProcAddressARB)((const GLubyte*)name)
+			#if defined(USE_EGL)
+				#include <EGL/egl.h>
+
+/* Headless contexts come from EGL; its lookup is only valid for them. */
+static void* EGLGetProcAddress(const char *name)
+{
+	if(eglGetCurrentContext() != EGL_NO_CONTEXT)
+		return (void*)eglGetProcAddress(name);
+	
+	return (void*)glXGetProcAddressARB((const GLubyte*)name);
+}
+
+				#define IntGetProcAddress(name) EGLGetProcAddress(name)
+			#else
+				#define IntGetProcAddress(name) (*glXGetProcAddressARB)((const GLubyte*)name)
+			#endif
 		#endif
 	#endif
 #endif
@@ -100,1105 +118,4929 @@ namespace gl
 {
 	namespace exts
 	{
+		LoadTest var_KHR_parallel_shader_compile;
+		
 	} //namespace exts
+	typedef void (CODEGEN_FUNCPTR *PFNMAXSHADERCOMPILERTHREADSKHR)(GLuint);
+	PFNMAXSHADERCOMPILERTHREADSKHR MaxShaderCompilerThreadsKHR = 0;
+	
+	static int Load_KHR_parallel_shader_compile()
+	{
+		int numFailed = 0;
+		MaxShaderCompilerThreadsKHR = reinterpret_cast<PFNMAXSHADERCOMPILERTHREADSKHR>(IntGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+		if(!MaxShaderCompilerThreadsKHR) ++numFailed;
+		return numFailed;
+	}
+	
+	// Lazy binding: every core pointer starts out at a Switch_ trampoline
+	// that looks the entry point up, patches the pointer and forwards the
+	// call, so only functions actually used are ever resolved.
+	enum { CORE_FUNCTION_COUNT = 541 };
+	static int g_resolved_count = 0;
+	
+	// A missing entry point would otherwise be called through NULL; name
+	// it and stop instead.
+	static void CheckLazyEntryPoint(bool found, const char *name)
+	{
+		if(!found)
+		{
+			fprintf(stderr, "OpenGL entry point %s is not available in this context.\n", name);
+			abort();
+		}
+		
+		++g_resolved_count;
+	}
+	
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNC)(GLenum, GLenum);
-	PFNBLENDFUNC BlendFunc = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendFunc(GLenum sfactor, GLenum dfactor)
+	{
+		BlendFunc = reinterpret_cast<PFNBLENDFUNC>(IntGetProcAddress("glBlendFunc"));
+		CheckLazyEntryPoint(BlendFunc != 0, "glBlendFunc");
+		return BlendFunc(sfactor, dfactor);
+	}
+	PFNBLENDFUNC BlendFunc = Switch_BlendFunc;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEAR)(GLbitfield);
-	PFNCLEAR Clear = 0;
+	static void CODEGEN_FUNCPTR Switch_Clear(GLbitfield mask)
+	{
+		Clear = reinterpret_cast<PFNCLEAR>(IntGetProcAddress("glClear"));
+		CheckLazyEntryPoint(Clear != 0, "glClear");
+		return Clear(mask);
+	}
+	PFNCLEAR Clear = Switch_Clear;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARCOLOR)(GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNCLEARCOLOR ClearColor = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		ClearColor = reinterpret_cast<PFNCLEARCOLOR>(IntGetProcAddress("glClearColor"));
+		CheckLazyEntryPoint(ClearColor != 0, "glClearColor");
+		return ClearColor(red, green, blue, alpha);
+	}
+	PFNCLEARCOLOR ClearColor = Switch_ClearColor;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARDEPTH)(GLdouble);
-	PFNCLEARDEPTH ClearDepth = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearDepth(GLdouble depth)
+	{
+		ClearDepth = reinterpret_cast<PFNCLEARDEPTH>(IntGetProcAddress("glClearDepth"));
+		CheckLazyEntryPoint(ClearDepth != 0, "glClearDepth");
+		return ClearDepth(depth);
+	}
+	PFNCLEARDEPTH ClearDepth = Switch_ClearDepth;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARSTENCIL)(GLint);
-	PFNCLEARSTENCIL ClearStencil = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearStencil(GLint s)
+	{
+		ClearStencil = reinterpret_cast<PFNCLEARSTENCIL>(IntGetProcAddress("glClearStencil"));
+		CheckLazyEntryPoint(ClearStencil != 0, "glClearStencil");
+		return ClearStencil(s);
+	}
+	PFNCLEARSTENCIL ClearStencil = Switch_ClearStencil;
 	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASK)(GLboolean, GLboolean, GLboolean, GLboolean);
-	PFNCOLORMASK ColorMask = 0;
+	static void CODEGEN_FUNCPTR Switch_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+	{
+		ColorMask = reinterpret_cast<PFNCOLORMASK>(IntGetProcAddress("glColorMask"));
+		CheckLazyEntryPoint(ColorMask != 0, "glColorMask");
+		return ColorMask(red, green, blue, alpha);
+	}
+	PFNCOLORMASK ColorMask = Switch_ColorMask;
 	typedef void (CODEGEN_FUNCPTR *PFNCULLFACE)(GLenum);
-	PFNCULLFACE CullFace = 0;
+	static void CODEGEN_FUNCPTR Switch_CullFace(GLenum mode)
+	{
+		CullFace = reinterpret_cast<PFNCULLFACE>(IntGetProcAddress("glCullFace"));
+		CheckLazyEntryPoint(CullFace != 0, "glCullFace");
+		return CullFace(mode);
+	}
+	PFNCULLFACE CullFace = Switch_CullFace;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHFUNC)(GLenum);
-	PFNDEPTHFUNC DepthFunc = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthFunc(GLenum func)
+	{
+		DepthFunc = reinterpret_cast<PFNDEPTHFUNC>(IntGetProcAddress("glDepthFunc"));
+		CheckLazyEntryPoint(DepthFunc != 0, "glDepthFunc");
+		return DepthFunc(func);
+	}
+	PFNDEPTHFUNC DepthFunc = Switch_DepthFunc;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHMASK)(GLboolean);
-	PFNDEPTHMASK DepthMask = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthMask(GLboolean flag)
+	{
+		DepthMask = reinterpret_cast<PFNDEPTHMASK>(IntGetProcAddress("glDepthMask"));
+		CheckLazyEntryPoint(DepthMask != 0, "glDepthMask");
+		return DepthMask(flag);
+	}
+	PFNDEPTHMASK DepthMask = Switch_DepthMask;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGE)(GLdouble, GLdouble);
-	PFNDEPTHRANGE DepthRange = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthRange(GLdouble ren_near, GLdouble ren_far)
+	{
+		DepthRange = reinterpret_cast<PFNDEPTHRANGE>(IntGetProcAddress("glDepthRange"));
+		CheckLazyEntryPoint(DepthRange != 0, "glDepthRange");
+		return DepthRange(ren_near, ren_far);
+	}
+	PFNDEPTHRANGE DepthRange = Switch_DepthRange;
 	typedef void (CODEGEN_FUNCPTR *PFNDISABLE)(GLenum);
-	PFNDISABLE Disable = 0;
+	static void CODEGEN_FUNCPTR Switch_Disable(GLenum cap)
+	{
+		Disable = reinterpret_cast<PFNDISABLE>(IntGetProcAddress("glDisable"));
+		CheckLazyEntryPoint(Disable != 0, "glDisable");
+		return Disable(cap);
+	}
+	PFNDISABLE Disable = Switch_Disable;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFER)(GLenum);
-	PFNDRAWBUFFER DrawBuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawBuffer(GLenum buf)
+	{
+		DrawBuffer = reinterpret_cast<PFNDRAWBUFFER>(IntGetProcAddress("glDrawBuffer"));
+		CheckLazyEntryPoint(DrawBuffer != 0, "glDrawBuffer");
+		return DrawBuffer(buf);
+	}
+	PFNDRAWBUFFER DrawBuffer = Switch_DrawBuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNENABLE)(GLenum);
-	PFNENABLE Enable = 0;
+	static void CODEGEN_FUNCPTR Switch_Enable(GLenum cap)
+	{
+		Enable = reinterpret_cast<PFNENABLE>(IntGetProcAddress("glEnable"));
+		CheckLazyEntryPoint(Enable != 0, "glEnable");
+		return Enable(cap);
+	}
+	PFNENABLE Enable = Switch_Enable;
 	typedef void (CODEGEN_FUNCPTR *PFNFINISH)();
-	PFNFINISH Finish = 0;
+	static void CODEGEN_FUNCPTR Switch_Finish()
+	{
+		Finish = reinterpret_cast<PFNFINISH>(IntGetProcAddress("glFinish"));
+		CheckLazyEntryPoint(Finish != 0, "glFinish");
+		return Finish();
+	}
+	PFNFINISH Finish = Switch_Finish;
 	typedef void (CODEGEN_FUNCPTR *PFNFLUSH)();
-	PFNFLUSH Flush = 0;
+	static void CODEGEN_FUNCPTR Switch_Flush()
+	{
+		Flush = reinterpret_cast<PFNFLUSH>(IntGetProcAddress("glFlush"));
+		CheckLazyEntryPoint(Flush != 0, "glFlush");
+		return Flush();
+	}
+	PFNFLUSH Flush = Switch_Flush;
 	typedef void (CODEGEN_FUNCPTR *PFNFRONTFACE)(GLenum);
-	PFNFRONTFACE FrontFace = 0;
+	static void CODEGEN_FUNCPTR Switch_FrontFace(GLenum mode)
+	{
+		FrontFace = reinterpret_cast<PFNFRONTFACE>(IntGetProcAddress("glFrontFace"));
+		CheckLazyEntryPoint(FrontFace != 0, "glFrontFace");
+		return FrontFace(mode);
+	}
+	PFNFRONTFACE FrontFace = Switch_FrontFace;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANV)(GLenum, GLboolean *);
-	PFNGETBOOLEANV GetBooleanv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBooleanv(GLenum pname, GLboolean * data)
+	{
+		GetBooleanv = reinterpret_cast<PFNGETBOOLEANV>(IntGetProcAddress("glGetBooleanv"));
+		CheckLazyEntryPoint(GetBooleanv != 0, "glGetBooleanv");
+		return GetBooleanv(pname, data);
+	}
+	PFNGETBOOLEANV GetBooleanv = Switch_GetBooleanv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETDOUBLEV)(GLenum, GLdouble *);
-	PFNGETDOUBLEV GetDoublev = 0;
+	static void CODEGEN_FUNCPTR Switch_GetDoublev(GLenum pname, GLdouble * data)
+	{
+		GetDoublev = reinterpret_cast<PFNGETDOUBLEV>(IntGetProcAddress("glGetDoublev"));
+		CheckLazyEntryPoint(GetDoublev != 0, "glGetDoublev");
+		return GetDoublev(pname, data);
+	}
+	PFNGETDOUBLEV GetDoublev = Switch_GetDoublev;
 	typedef GLenum (CODEGEN_FUNCPTR *PFNGETERROR)();
-	PFNGETERROR GetError = 0;
+	static GLenum CODEGEN_FUNCPTR Switch_GetError()
+	{
+		GetError = reinterpret_cast<PFNGETERROR>(IntGetProcAddress("glGetError"));
+		CheckLazyEntryPoint(GetError != 0, "glGetError");
+		return GetError();
+	}
+	PFNGETERROR GetError = Switch_GetError;
 	typedef void (CODEGEN_FUNCPTR *PFNGETFLOATV)(GLenum, GLfloat *);
-	PFNGETFLOATV GetFloatv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetFloatv(GLenum pname, GLfloat * data)
+	{
+		GetFloatv = reinterpret_cast<PFNGETFLOATV>(IntGetProcAddress("glGetFloatv"));
+		CheckLazyEntryPoint(GetFloatv != 0, "glGetFloatv");
+		return GetFloatv(pname, data);
+	}
+	PFNGETFLOATV GetFloatv = Switch_GetFloatv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERV)(GLenum, GLint *);
-	PFNGETINTEGERV GetIntegerv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetIntegerv(GLenum pname, GLint * data)
+	{
+		GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
+		CheckLazyEntryPoint(GetIntegerv != 0, "glGetIntegerv");
+		return GetIntegerv(pname, data);
+	}
+	PFNGETINTEGERV GetIntegerv = Switch_GetIntegerv;
 	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRING)(GLenum);
-	PFNGETSTRING GetString = 0;
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetString(GLenum name)
+	{
+		GetString = reinterpret_cast<PFNGETSTRING>(IntGetProcAddress("glGetString"));
+		CheckLazyEntryPoint(GetString != 0, "glGetString");
+		return GetString(name);
+	}
+	PFNGETSTRING GetString = Switch_GetString;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXIMAGE)(GLenum, GLint, GLenum, GLenum, void *);
-	PFNGETTEXIMAGE GetTexImage = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels)
+	{
+		GetTexImage = reinterpret_cast<PFNGETTEXIMAGE>(IntGetProcAddress("glGetTexImage"));
+		CheckLazyEntryPoint(GetTexImage != 0, "glGetTexImage");
+		return GetTexImage(target, level, format, type, pixels);
+	}
+	PFNGETTEXIMAGE GetTexImage = Switch_GetTexImage;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERFV)(GLenum, GLint, GLenum, GLfloat *);
-	PFNGETTEXLEVELPARAMETERFV GetTexLevelParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
+	{
+		GetTexLevelParameterfv = reinterpret_cast<PFNGETTEXLEVELPARAMETERFV>(IntGetProcAddress("glGetTexLevelParameterfv"));
+		CheckLazyEntryPoint(GetTexLevelParameterfv != 0, "glGetTexLevelParameterfv");
+		return GetTexLevelParameterfv(target, level, pname, params);
+	}
+	PFNGETTEXLEVELPARAMETERFV GetTexLevelParameterfv = Switch_GetTexLevelParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXLEVELPARAMETERIV)(GLenum, GLint, GLenum, GLint *);
-	PFNGETTEXLEVELPARAMETERIV GetTexLevelParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
+	{
+		GetTexLevelParameteriv = reinterpret_cast<PFNGETTEXLEVELPARAMETERIV>(IntGetProcAddress("glGetTexLevelParameteriv"));
+		CheckLazyEntryPoint(GetTexLevelParameteriv != 0, "glGetTexLevelParameteriv");
+		return GetTexLevelParameteriv(target, level, pname, params);
+	}
+	PFNGETTEXLEVELPARAMETERIV GetTexLevelParameteriv = Switch_GetTexLevelParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERFV)(GLenum, GLenum, GLfloat *);
-	PFNGETTEXPARAMETERFV GetTexParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
+	{
+		GetTexParameterfv = reinterpret_cast<PFNGETTEXPARAMETERFV>(IntGetProcAddress("glGetTexParameterfv"));
+		CheckLazyEntryPoint(GetTexParameterfv != 0, "glGetTexParameterfv");
+		return GetTexParameterfv(target, pname, params);
+	}
+	PFNGETTEXPARAMETERFV GetTexParameterfv = Switch_GetTexParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETTEXPARAMETERIV GetTexParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexParameteriv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetTexParameteriv = reinterpret_cast<PFNGETTEXPARAMETERIV>(IntGetProcAddress("glGetTexParameteriv"));
+		CheckLazyEntryPoint(GetTexParameteriv != 0, "glGetTexParameteriv");
+		return GetTexParameteriv(target, pname, params);
+	}
+	PFNGETTEXPARAMETERIV GetTexParameteriv = Switch_GetTexParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNHINT)(GLenum, GLenum);
-	PFNHINT Hint = 0;
+	static void CODEGEN_FUNCPTR Switch_Hint(GLenum target, GLenum mode)
+	{
+		Hint = reinterpret_cast<PFNHINT>(IntGetProcAddress("glHint"));
+		CheckLazyEntryPoint(Hint != 0, "glHint");
+		return Hint(target, mode);
+	}
+	PFNHINT Hint = Switch_Hint;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLED)(GLenum);
-	PFNISENABLED IsEnabled = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabled(GLenum cap)
+	{
+		IsEnabled = reinterpret_cast<PFNISENABLED>(IntGetProcAddress("glIsEnabled"));
+		CheckLazyEntryPoint(IsEnabled != 0, "glIsEnabled");
+		return IsEnabled(cap);
+	}
+	PFNISENABLED IsEnabled = Switch_IsEnabled;
 	typedef void (CODEGEN_FUNCPTR *PFNLINEWIDTH)(GLfloat);
-	PFNLINEWIDTH LineWidth = 0;
+	static void CODEGEN_FUNCPTR Switch_LineWidth(GLfloat width)
+	{
+		LineWidth = reinterpret_cast<PFNLINEWIDTH>(IntGetProcAddress("glLineWidth"));
+		CheckLazyEntryPoint(LineWidth != 0, "glLineWidth");
+		return LineWidth(width);
+	}
+	PFNLINEWIDTH LineWidth = Switch_LineWidth;
 	typedef void (CODEGEN_FUNCPTR *PFNLOGICOP)(GLenum);
-	PFNLOGICOP LogicOp = 0;
+	static void CODEGEN_FUNCPTR Switch_LogicOp(GLenum opcode)
+	{
+		LogicOp = reinterpret_cast<PFNLOGICOP>(IntGetProcAddress("glLogicOp"));
+		CheckLazyEntryPoint(LogicOp != 0, "glLogicOp");
+		return LogicOp(opcode);
+	}
+	PFNLOGICOP LogicOp = Switch_LogicOp;
 	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREF)(GLenum, GLfloat);
-	PFNPIXELSTOREF PixelStoref = 0;
+	static void CODEGEN_FUNCPTR Switch_PixelStoref(GLenum pname, GLfloat param)
+	{
+		PixelStoref = reinterpret_cast<PFNPIXELSTOREF>(IntGetProcAddress("glPixelStoref"));
+		CheckLazyEntryPoint(PixelStoref != 0, "glPixelStoref");
+		return PixelStoref(pname, param);
+	}
+	PFNPIXELSTOREF PixelStoref = Switch_PixelStoref;
 	typedef void (CODEGEN_FUNCPTR *PFNPIXELSTOREI)(GLenum, GLint);
-	PFNPIXELSTOREI PixelStorei = 0;
+	static void CODEGEN_FUNCPTR Switch_PixelStorei(GLenum pname, GLint param)
+	{
+		PixelStorei = reinterpret_cast<PFNPIXELSTOREI>(IntGetProcAddress("glPixelStorei"));
+		CheckLazyEntryPoint(PixelStorei != 0, "glPixelStorei");
+		return PixelStorei(pname, param);
+	}
+	PFNPIXELSTOREI PixelStorei = Switch_PixelStorei;
 	typedef void (CODEGEN_FUNCPTR *PFNPOINTSIZE)(GLfloat);
-	PFNPOINTSIZE PointSize = 0;
+	static void CODEGEN_FUNCPTR Switch_PointSize(GLfloat size)
+	{
+		PointSize = reinterpret_cast<PFNPOINTSIZE>(IntGetProcAddress("glPointSize"));
+		CheckLazyEntryPoint(PointSize != 0, "glPointSize");
+		return PointSize(size);
+	}
+	PFNPOINTSIZE PointSize = Switch_PointSize;
 	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONMODE)(GLenum, GLenum);
-	PFNPOLYGONMODE PolygonMode = 0;
+	static void CODEGEN_FUNCPTR Switch_PolygonMode(GLenum face, GLenum mode)
+	{
+		PolygonMode = reinterpret_cast<PFNPOLYGONMODE>(IntGetProcAddress("glPolygonMode"));
+		CheckLazyEntryPoint(PolygonMode != 0, "glPolygonMode");
+		return PolygonMode(face, mode);
+	}
+	PFNPOLYGONMODE PolygonMode = Switch_PolygonMode;
 	typedef void (CODEGEN_FUNCPTR *PFNREADBUFFER)(GLenum);
-	PFNREADBUFFER ReadBuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_ReadBuffer(GLenum src)
+	{
+		ReadBuffer = reinterpret_cast<PFNREADBUFFER>(IntGetProcAddress("glReadBuffer"));
+		CheckLazyEntryPoint(ReadBuffer != 0, "glReadBuffer");
+		return ReadBuffer(src);
+	}
+	PFNREADBUFFER ReadBuffer = Switch_ReadBuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNREADPIXELS)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void *);
-	PFNREADPIXELS ReadPixels = 0;
+	static void CODEGEN_FUNCPTR Switch_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels)
+	{
+		ReadPixels = reinterpret_cast<PFNREADPIXELS>(IntGetProcAddress("glReadPixels"));
+		CheckLazyEntryPoint(ReadPixels != 0, "glReadPixels");
+		return ReadPixels(x, y, width, height, format, type, pixels);
+	}
+	PFNREADPIXELS ReadPixels = Switch_ReadPixels;
 	typedef void (CODEGEN_FUNCPTR *PFNSCISSOR)(GLint, GLint, GLsizei, GLsizei);
-	PFNSCISSOR Scissor = 0;
+	static void CODEGEN_FUNCPTR Switch_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		Scissor = reinterpret_cast<PFNSCISSOR>(IntGetProcAddress("glScissor"));
+		CheckLazyEntryPoint(Scissor != 0, "glScissor");
+		return Scissor(x, y, width, height);
+	}
+	PFNSCISSOR Scissor = Switch_Scissor;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNC)(GLenum, GLint, GLuint);
-	PFNSTENCILFUNC StencilFunc = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilFunc(GLenum func, GLint ref, GLuint mask)
+	{
+		StencilFunc = reinterpret_cast<PFNSTENCILFUNC>(IntGetProcAddress("glStencilFunc"));
+		CheckLazyEntryPoint(StencilFunc != 0, "glStencilFunc");
+		return StencilFunc(func, ref, mask);
+	}
+	PFNSTENCILFUNC StencilFunc = Switch_StencilFunc;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASK)(GLuint);
-	PFNSTENCILMASK StencilMask = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilMask(GLuint mask)
+	{
+		StencilMask = reinterpret_cast<PFNSTENCILMASK>(IntGetProcAddress("glStencilMask"));
+		CheckLazyEntryPoint(StencilMask != 0, "glStencilMask");
+		return StencilMask(mask);
+	}
+	PFNSTENCILMASK StencilMask = Switch_StencilMask;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOP)(GLenum, GLenum, GLenum);
-	PFNSTENCILOP StencilOp = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+	{
+		StencilOp = reinterpret_cast<PFNSTENCILOP>(IntGetProcAddress("glStencilOp"));
+		CheckLazyEntryPoint(StencilOp != 0, "glStencilOp");
+		return StencilOp(fail, zfail, zpass);
+	}
+	PFNSTENCILOP StencilOp = Switch_StencilOp;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE1D TexImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels)
+	{
+		TexImage1D = reinterpret_cast<PFNTEXIMAGE1D>(IntGetProcAddress("glTexImage1D"));
+		CheckLazyEntryPoint(TexImage1D != 0, "glTexImage1D");
+		return TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	}
+	PFNTEXIMAGE1D TexImage1D = Switch_TexImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE2D TexImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)
+	{
+		TexImage2D = reinterpret_cast<PFNTEXIMAGE2D>(IntGetProcAddress("glTexImage2D"));
+		CheckLazyEntryPoint(TexImage2D != 0, "glTexImage2D");
+		return TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	}
+	PFNTEXIMAGE2D TexImage2D = Switch_TexImage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERF)(GLenum, GLenum, GLfloat);
-	PFNTEXPARAMETERF TexParameterf = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+	{
+		TexParameterf = reinterpret_cast<PFNTEXPARAMETERF>(IntGetProcAddress("glTexParameterf"));
+		CheckLazyEntryPoint(TexParameterf != 0, "glTexParameterf");
+		return TexParameterf(target, pname, param);
+	}
+	PFNTEXPARAMETERF TexParameterf = Switch_TexParameterf;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERFV)(GLenum, GLenum, const GLfloat *);
-	PFNTEXPARAMETERFV TexParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+	{
+		TexParameterfv = reinterpret_cast<PFNTEXPARAMETERFV>(IntGetProcAddress("glTexParameterfv"));
+		CheckLazyEntryPoint(TexParameterfv != 0, "glTexParameterfv");
+		return TexParameterfv(target, pname, params);
+	}
+	PFNTEXPARAMETERFV TexParameterfv = Switch_TexParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERI)(GLenum, GLenum, GLint);
-	PFNTEXPARAMETERI TexParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameteri(GLenum target, GLenum pname, GLint param)
+	{
+		TexParameteri = reinterpret_cast<PFNTEXPARAMETERI>(IntGetProcAddress("glTexParameteri"));
+		CheckLazyEntryPoint(TexParameteri != 0, "glTexParameteri");
+		return TexParameteri(target, pname, param);
+	}
+	PFNTEXPARAMETERI TexParameteri = Switch_TexParameteri;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIV)(GLenum, GLenum, const GLint *);
-	PFNTEXPARAMETERIV TexParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameteriv(GLenum target, GLenum pname, const GLint * params)
+	{
+		TexParameteriv = reinterpret_cast<PFNTEXPARAMETERIV>(IntGetProcAddress("glTexParameteriv"));
+		CheckLazyEntryPoint(TexParameteriv != 0, "glTexParameteriv");
+		return TexParameteriv(target, pname, params);
+	}
+	PFNTEXPARAMETERIV TexParameteriv = Switch_TexParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORT)(GLint, GLint, GLsizei, GLsizei);
-	PFNVIEWPORT Viewport = 0;
+	static void CODEGEN_FUNCPTR Switch_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		Viewport = reinterpret_cast<PFNVIEWPORT>(IntGetProcAddress("glViewport"));
+		CheckLazyEntryPoint(Viewport != 0, "glViewport");
+		return Viewport(x, y, width, height);
+	}
+	PFNVIEWPORT Viewport = Switch_Viewport;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBINDTEXTURE)(GLenum, GLuint);
-	PFNBINDTEXTURE BindTexture = 0;
+	static void CODEGEN_FUNCPTR Switch_BindTexture(GLenum target, GLuint texture)
+	{
+		BindTexture = reinterpret_cast<PFNBINDTEXTURE>(IntGetProcAddress("glBindTexture"));
+		CheckLazyEntryPoint(BindTexture != 0, "glBindTexture");
+		return BindTexture(target, texture);
+	}
+	PFNBINDTEXTURE BindTexture = Switch_BindTexture;
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE1D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLint);
-	PFNCOPYTEXIMAGE1D CopyTexImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+	{
+		CopyTexImage1D = reinterpret_cast<PFNCOPYTEXIMAGE1D>(IntGetProcAddress("glCopyTexImage1D"));
+		CheckLazyEntryPoint(CopyTexImage1D != 0, "glCopyTexImage1D");
+		return CopyTexImage1D(target, level, internalformat, x, y, width, border);
+	}
+	PFNCOPYTEXIMAGE1D CopyTexImage1D = Switch_CopyTexImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXIMAGE2D)(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei, GLint);
-	PFNCOPYTEXIMAGE2D CopyTexImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+	{
+		CopyTexImage2D = reinterpret_cast<PFNCOPYTEXIMAGE2D>(IntGetProcAddress("glCopyTexImage2D"));
+		CheckLazyEntryPoint(CopyTexImage2D != 0, "glCopyTexImage2D");
+		return CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	}
+	PFNCOPYTEXIMAGE2D CopyTexImage2D = Switch_CopyTexImage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLint, GLint, GLsizei);
-	PFNCOPYTEXSUBIMAGE1D CopyTexSubImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+	{
+		CopyTexSubImage1D = reinterpret_cast<PFNCOPYTEXSUBIMAGE1D>(IntGetProcAddress("glCopyTexSubImage1D"));
+		CheckLazyEntryPoint(CopyTexSubImage1D != 0, "glCopyTexSubImage1D");
+		return CopyTexSubImage1D(target, level, xoffset, x, y, width);
+	}
+	PFNCOPYTEXSUBIMAGE1D CopyTexSubImage1D = Switch_CopyTexSubImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
-	PFNCOPYTEXSUBIMAGE2D CopyTexSubImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		CopyTexSubImage2D = reinterpret_cast<PFNCOPYTEXSUBIMAGE2D>(IntGetProcAddress("glCopyTexSubImage2D"));
+		CheckLazyEntryPoint(CopyTexSubImage2D != 0, "glCopyTexSubImage2D");
+		return CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	}
+	PFNCOPYTEXSUBIMAGE2D CopyTexSubImage2D = Switch_CopyTexSubImage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETETEXTURES)(GLsizei, const GLuint *);
-	PFNDELETETEXTURES DeleteTextures = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteTextures(GLsizei n, const GLuint * textures)
+	{
+		DeleteTextures = reinterpret_cast<PFNDELETETEXTURES>(IntGetProcAddress("glDeleteTextures"));
+		CheckLazyEntryPoint(DeleteTextures != 0, "glDeleteTextures");
+		return DeleteTextures(n, textures);
+	}
+	PFNDELETETEXTURES DeleteTextures = Switch_DeleteTextures;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYS)(GLenum, GLint, GLsizei);
-	PFNDRAWARRAYS DrawArrays = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawArrays(GLenum mode, GLint first, GLsizei count)
+	{
+		DrawArrays = reinterpret_cast<PFNDRAWARRAYS>(IntGetProcAddress("glDrawArrays"));
+		CheckLazyEntryPoint(DrawArrays != 0, "glDrawArrays");
+		return DrawArrays(mode, first, count);
+	}
+	PFNDRAWARRAYS DrawArrays = Switch_DrawArrays;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTS)(GLenum, GLsizei, GLenum, const void *);
-	PFNDRAWELEMENTS DrawElements = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices)
+	{
+		DrawElements = reinterpret_cast<PFNDRAWELEMENTS>(IntGetProcAddress("glDrawElements"));
+		CheckLazyEntryPoint(DrawElements != 0, "glDrawElements");
+		return DrawElements(mode, count, type, indices);
+	}
+	PFNDRAWELEMENTS DrawElements = Switch_DrawElements;
 	typedef void (CODEGEN_FUNCPTR *PFNGENTEXTURES)(GLsizei, GLuint *);
-	PFNGENTEXTURES GenTextures = 0;
+	static void CODEGEN_FUNCPTR Switch_GenTextures(GLsizei n, GLuint * textures)
+	{
+		GenTextures = reinterpret_cast<PFNGENTEXTURES>(IntGetProcAddress("glGenTextures"));
+		CheckLazyEntryPoint(GenTextures != 0, "glGenTextures");
+		return GenTextures(n, textures);
+	}
+	PFNGENTEXTURES GenTextures = Switch_GenTextures;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPOINTERV)(GLenum, void **);
-	PFNGETPOINTERV GetPointerv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetPointerv(GLenum pname, void ** params)
+	{
+		GetPointerv = reinterpret_cast<PFNGETPOINTERV>(IntGetProcAddress("glGetPointerv"));
+		CheckLazyEntryPoint(GetPointerv != 0, "glGetPointerv");
+		return GetPointerv(pname, params);
+	}
+	PFNGETPOINTERV GetPointerv = Switch_GetPointerv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISTEXTURE)(GLuint);
-	PFNISTEXTURE IsTexture = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsTexture(GLuint texture)
+	{
+		IsTexture = reinterpret_cast<PFNISTEXTURE>(IntGetProcAddress("glIsTexture"));
+		CheckLazyEntryPoint(IsTexture != 0, "glIsTexture");
+		return IsTexture(texture);
+	}
+	PFNISTEXTURE IsTexture = Switch_IsTexture;
 	typedef void (CODEGEN_FUNCPTR *PFNPOLYGONOFFSET)(GLfloat, GLfloat);
-	PFNPOLYGONOFFSET PolygonOffset = 0;
+	static void CODEGEN_FUNCPTR Switch_PolygonOffset(GLfloat factor, GLfloat units)
+	{
+		PolygonOffset = reinterpret_cast<PFNPOLYGONOFFSET>(IntGetProcAddress("glPolygonOffset"));
+		CheckLazyEntryPoint(PolygonOffset != 0, "glPolygonOffset");
+		return PolygonOffset(factor, units);
+	}
+	PFNPOLYGONOFFSET PolygonOffset = Switch_PolygonOffset;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE1D TexSubImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels)
+	{
+		TexSubImage1D = reinterpret_cast<PFNTEXSUBIMAGE1D>(IntGetProcAddress("glTexSubImage1D"));
+		CheckLazyEntryPoint(TexSubImage1D != 0, "glTexSubImage1D");
+		return TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	}
+	PFNTEXSUBIMAGE1D TexSubImage1D = Switch_TexSubImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE2D TexSubImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)
+	{
+		TexSubImage2D = reinterpret_cast<PFNTEXSUBIMAGE2D>(IntGetProcAddress("glTexSubImage2D"));
+		CheckLazyEntryPoint(TexSubImage2D != 0, "glTexSubImage2D");
+		return TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	}
+	PFNTEXSUBIMAGE2D TexSubImage2D = Switch_TexSubImage2D;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLint, GLint, GLsizei, GLsizei);
-	PFNCOPYTEXSUBIMAGE3D CopyTexSubImage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		CopyTexSubImage3D = reinterpret_cast<PFNCOPYTEXSUBIMAGE3D>(IntGetProcAddress("glCopyTexSubImage3D"));
+		CheckLazyEntryPoint(CopyTexSubImage3D != 0, "glCopyTexSubImage3D");
+		return CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	}
+	PFNCOPYTEXSUBIMAGE3D CopyTexSubImage3D = Switch_CopyTexSubImage3D;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTS)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *);
-	PFNDRAWRANGEELEMENTS DrawRangeElements = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices)
+	{
+		DrawRangeElements = reinterpret_cast<PFNDRAWRANGEELEMENTS>(IntGetProcAddress("glDrawRangeElements"));
+		CheckLazyEntryPoint(DrawRangeElements != 0, "glDrawRangeElements");
+		return DrawRangeElements(mode, start, end, count, type, indices);
+	}
+	PFNDRAWRANGEELEMENTS DrawRangeElements = Switch_DrawRangeElements;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *);
-	PFNTEXIMAGE3D TexImage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)
+	{
+		TexImage3D = reinterpret_cast<PFNTEXIMAGE3D>(IntGetProcAddress("glTexImage3D"));
+		CheckLazyEntryPoint(TexImage3D != 0, "glTexImage3D");
+		return TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	}
+	PFNTEXIMAGE3D TexImage3D = Switch_TexImage3D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *);
-	PFNTEXSUBIMAGE3D TexSubImage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)
+	{
+		TexSubImage3D = reinterpret_cast<PFNTEXSUBIMAGE3D>(IntGetProcAddress("glTexSubImage3D"));
+		CheckLazyEntryPoint(TexSubImage3D != 0, "glTexSubImage3D");
+		return TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	}
+	PFNTEXSUBIMAGE3D TexSubImage3D = Switch_TexSubImage3D;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNACTIVETEXTURE)(GLenum);
-	PFNACTIVETEXTURE ActiveTexture = 0;
+	static void CODEGEN_FUNCPTR Switch_ActiveTexture(GLenum texture)
+	{
+		ActiveTexture = reinterpret_cast<PFNACTIVETEXTURE>(IntGetProcAddress("glActiveTexture"));
+		CheckLazyEntryPoint(ActiveTexture != 0, "glActiveTexture");
+		return ActiveTexture(texture);
+	}
+	PFNACTIVETEXTURE ActiveTexture = Switch_ActiveTexture;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE1D)(GLenum, GLint, GLenum, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE1D CompressedTexImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data)
+	{
+		CompressedTexImage1D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE1D>(IntGetProcAddress("glCompressedTexImage1D"));
+		CheckLazyEntryPoint(CompressedTexImage1D != 0, "glCompressedTexImage1D");
+		return CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXIMAGE1D CompressedTexImage1D = Switch_CompressedTexImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE2D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE2D CompressedTexImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)
+	{
+		CompressedTexImage2D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE2D>(IntGetProcAddress("glCompressedTexImage2D"));
+		CheckLazyEntryPoint(CompressedTexImage2D != 0, "glCompressedTexImage2D");
+		return CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXIMAGE2D CompressedTexImage2D = Switch_CompressedTexImage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXIMAGE3D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLint, GLsizei, const void *);
-	PFNCOMPRESSEDTEXIMAGE3D CompressedTexImage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)
+	{
+		CompressedTexImage3D = reinterpret_cast<PFNCOMPRESSEDTEXIMAGE3D>(IntGetProcAddress("glCompressedTexImage3D"));
+		CheckLazyEntryPoint(CompressedTexImage3D != 0, "glCompressedTexImage3D");
+		return CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXIMAGE3D CompressedTexImage3D = Switch_CompressedTexImage3D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE1D)(GLenum, GLint, GLint, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE1D CompressedTexSubImage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data)
+	{
+		CompressedTexSubImage1D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE1D>(IntGetProcAddress("glCompressedTexSubImage1D"));
+		CheckLazyEntryPoint(CompressedTexSubImage1D != 0, "glCompressedTexSubImage1D");
+		return CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE1D CompressedTexSubImage1D = Switch_CompressedTexSubImage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE2D)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE2D CompressedTexSubImage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data)
+	{
+		CompressedTexSubImage2D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE2D>(IntGetProcAddress("glCompressedTexSubImage2D"));
+		CheckLazyEntryPoint(CompressedTexSubImage2D != 0, "glCompressedTexSubImage2D");
+		return CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE2D CompressedTexSubImage2D = Switch_CompressedTexSubImage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPRESSEDTEXSUBIMAGE3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void *);
-	PFNCOMPRESSEDTEXSUBIMAGE3D CompressedTexSubImage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data)
+	{
+		CompressedTexSubImage3D = reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE3D>(IntGetProcAddress("glCompressedTexSubImage3D"));
+		CheckLazyEntryPoint(CompressedTexSubImage3D != 0, "glCompressedTexSubImage3D");
+		return CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	}
+	PFNCOMPRESSEDTEXSUBIMAGE3D CompressedTexSubImage3D = Switch_CompressedTexSubImage3D;
 	typedef void (CODEGEN_FUNCPTR *PFNGETCOMPRESSEDTEXIMAGE)(GLenum, GLint, void *);
-	PFNGETCOMPRESSEDTEXIMAGE GetCompressedTexImage = 0;
+	static void CODEGEN_FUNCPTR Switch_GetCompressedTexImage(GLenum target, GLint level, void * img)
+	{
+		GetCompressedTexImage = reinterpret_cast<PFNGETCOMPRESSEDTEXIMAGE>(IntGetProcAddress("glGetCompressedTexImage"));
+		CheckLazyEntryPoint(GetCompressedTexImage != 0, "glGetCompressedTexImage");
+		return GetCompressedTexImage(target, level, img);
+	}
+	PFNGETCOMPRESSEDTEXIMAGE GetCompressedTexImage = Switch_GetCompressedTexImage;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLECOVERAGE)(GLfloat, GLboolean);
-	PFNSAMPLECOVERAGE SampleCoverage = 0;
+	static void CODEGEN_FUNCPTR Switch_SampleCoverage(GLfloat value, GLboolean invert)
+	{
+		SampleCoverage = reinterpret_cast<PFNSAMPLECOVERAGE>(IntGetProcAddress("glSampleCoverage"));
+		CheckLazyEntryPoint(SampleCoverage != 0, "glSampleCoverage");
+		return SampleCoverage(value, invert);
+	}
+	PFNSAMPLECOVERAGE SampleCoverage = Switch_SampleCoverage;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNCSEPARATE)(GLenum, GLenum, GLenum, GLenum);
-	PFNBLENDFUNCSEPARATE BlendFuncSeparate = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+	{
+		BlendFuncSeparate = reinterpret_cast<PFNBLENDFUNCSEPARATE>(IntGetProcAddress("glBlendFuncSeparate"));
+		CheckLazyEntryPoint(BlendFuncSeparate != 0, "glBlendFuncSeparate");
+		return BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	}
+	PFNBLENDFUNCSEPARATE BlendFuncSeparate = Switch_BlendFuncSeparate;
 	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWARRAYS)(GLenum, const GLint *, const GLsizei *, GLsizei);
-	PFNMULTIDRAWARRAYS MultiDrawArrays = 0;
+	static void CODEGEN_FUNCPTR Switch_MultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount)
+	{
+		MultiDrawArrays = reinterpret_cast<PFNMULTIDRAWARRAYS>(IntGetProcAddress("glMultiDrawArrays"));
+		CheckLazyEntryPoint(MultiDrawArrays != 0, "glMultiDrawArrays");
+		return MultiDrawArrays(mode, first, count, drawcount);
+	}
+	PFNMULTIDRAWARRAYS MultiDrawArrays = Switch_MultiDrawArrays;
 	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTS)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei);
-	PFNMULTIDRAWELEMENTS MultiDrawElements = 0;
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount)
+	{
+		MultiDrawElements = reinterpret_cast<PFNMULTIDRAWELEMENTS>(IntGetProcAddress("glMultiDrawElements"));
+		CheckLazyEntryPoint(MultiDrawElements != 0, "glMultiDrawElements");
+		return MultiDrawElements(mode, count, type, indices, drawcount);
+	}
+	PFNMULTIDRAWELEMENTS MultiDrawElements = Switch_MultiDrawElements;
 	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERF)(GLenum, GLfloat);
-	PFNPOINTPARAMETERF PointParameterf = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERFV)(GLenum, const GLfloat *);
-	PFNPOINTPARAMETERFV PointParameterfv = 0;
-	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERI)(GLenum, GLint);
-	PFNPOINTPARAMETERI PointParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_PointParameterf(GLenum pname, GLfloat param)
+	{
+		PointParameterf = reinterpret_cast<PFNPOINTPARAMETERF>(IntGetProcAddress("glPointParameterf"));
+		CheckLazyEntryPoint(PointParameterf != 0, "glPointParameterf");
+		return PointParameterf(pname, param);
+	}
+	PFNPOINTPARAMETERF PointParameterf = Switch_PointParameterf;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERFV)(GLenum, const GLfloat *);
+	static void CODEGEN_FUNCPTR Switch_PointParameterfv(GLenum pname, const GLfloat * params)
+	{
+		PointParameterfv = reinterpret_cast<PFNPOINTPARAMETERFV>(IntGetProcAddress("glPointParameterfv"));
+		CheckLazyEntryPoint(PointParameterfv != 0, "glPointParameterfv");
+		return PointParameterfv(pname, params);
+	}
+	PFNPOINTPARAMETERFV PointParameterfv = Switch_PointParameterfv;
+	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERI)(GLenum, GLint);
+	static void CODEGEN_FUNCPTR Switch_PointParameteri(GLenum pname, GLint param)
+	{
+		PointParameteri = reinterpret_cast<PFNPOINTPARAMETERI>(IntGetProcAddress("glPointParameteri"));
+		CheckLazyEntryPoint(PointParameteri != 0, "glPointParameteri");
+		return PointParameteri(pname, param);
+	}
+	PFNPOINTPARAMETERI PointParameteri = Switch_PointParameteri;
 	typedef void (CODEGEN_FUNCPTR *PFNPOINTPARAMETERIV)(GLenum, const GLint *);
-	PFNPOINTPARAMETERIV PointParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_PointParameteriv(GLenum pname, const GLint * params)
+	{
+		PointParameteriv = reinterpret_cast<PFNPOINTPARAMETERIV>(IntGetProcAddress("glPointParameteriv"));
+		CheckLazyEntryPoint(PointParameteriv != 0, "glPointParameteriv");
+		return PointParameteriv(pname, params);
+	}
+	PFNPOINTPARAMETERIV PointParameteriv = Switch_PointParameteriv;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBEGINQUERY)(GLenum, GLuint);
-	PFNBEGINQUERY BeginQuery = 0;
+	static void CODEGEN_FUNCPTR Switch_BeginQuery(GLenum target, GLuint id)
+	{
+		BeginQuery = reinterpret_cast<PFNBEGINQUERY>(IntGetProcAddress("glBeginQuery"));
+		CheckLazyEntryPoint(BeginQuery != 0, "glBeginQuery");
+		return BeginQuery(target, id);
+	}
+	PFNBEGINQUERY BeginQuery = Switch_BeginQuery;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFER)(GLenum, GLuint);
-	PFNBINDBUFFER BindBuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_BindBuffer(GLenum target, GLuint buffer)
+	{
+		BindBuffer = reinterpret_cast<PFNBINDBUFFER>(IntGetProcAddress("glBindBuffer"));
+		CheckLazyEntryPoint(BindBuffer != 0, "glBindBuffer");
+		return BindBuffer(target, buffer);
+	}
+	PFNBINDBUFFER BindBuffer = Switch_BindBuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNBUFFERDATA)(GLenum, GLsizeiptr, const void *, GLenum);
-	PFNBUFFERDATA BufferData = 0;
+	static void CODEGEN_FUNCPTR Switch_BufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage)
+	{
+		BufferData = reinterpret_cast<PFNBUFFERDATA>(IntGetProcAddress("glBufferData"));
+		CheckLazyEntryPoint(BufferData != 0, "glBufferData");
+		return BufferData(target, size, data, usage);
+	}
+	PFNBUFFERDATA BufferData = Switch_BufferData;
 	typedef void (CODEGEN_FUNCPTR *PFNBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, const void *);
-	PFNBUFFERSUBDATA BufferSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data)
+	{
+		BufferSubData = reinterpret_cast<PFNBUFFERSUBDATA>(IntGetProcAddress("glBufferSubData"));
+		CheckLazyEntryPoint(BufferSubData != 0, "glBufferSubData");
+		return BufferSubData(target, offset, size, data);
+	}
+	PFNBUFFERSUBDATA BufferSubData = Switch_BufferSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETEBUFFERS DeleteBuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteBuffers(GLsizei n, const GLuint * buffers)
+	{
+		DeleteBuffers = reinterpret_cast<PFNDELETEBUFFERS>(IntGetProcAddress("glDeleteBuffers"));
+		CheckLazyEntryPoint(DeleteBuffers != 0, "glDeleteBuffers");
+		return DeleteBuffers(n, buffers);
+	}
+	PFNDELETEBUFFERS DeleteBuffers = Switch_DeleteBuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEQUERIES)(GLsizei, const GLuint *);
-	PFNDELETEQUERIES DeleteQueries = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteQueries(GLsizei n, const GLuint * ids)
+	{
+		DeleteQueries = reinterpret_cast<PFNDELETEQUERIES>(IntGetProcAddress("glDeleteQueries"));
+		CheckLazyEntryPoint(DeleteQueries != 0, "glDeleteQueries");
+		return DeleteQueries(n, ids);
+	}
+	PFNDELETEQUERIES DeleteQueries = Switch_DeleteQueries;
 	typedef void (CODEGEN_FUNCPTR *PFNENDQUERY)(GLenum);
-	PFNENDQUERY EndQuery = 0;
+	static void CODEGEN_FUNCPTR Switch_EndQuery(GLenum target)
+	{
+		EndQuery = reinterpret_cast<PFNENDQUERY>(IntGetProcAddress("glEndQuery"));
+		CheckLazyEntryPoint(EndQuery != 0, "glEndQuery");
+		return EndQuery(target);
+	}
+	PFNENDQUERY EndQuery = Switch_EndQuery;
 	typedef void (CODEGEN_FUNCPTR *PFNGENBUFFERS)(GLsizei, GLuint *);
-	PFNGENBUFFERS GenBuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_GenBuffers(GLsizei n, GLuint * buffers)
+	{
+		GenBuffers = reinterpret_cast<PFNGENBUFFERS>(IntGetProcAddress("glGenBuffers"));
+		CheckLazyEntryPoint(GenBuffers != 0, "glGenBuffers");
+		return GenBuffers(n, buffers);
+	}
+	PFNGENBUFFERS GenBuffers = Switch_GenBuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNGENQUERIES)(GLsizei, GLuint *);
-	PFNGENQUERIES GenQueries = 0;
+	static void CODEGEN_FUNCPTR Switch_GenQueries(GLsizei n, GLuint * ids)
+	{
+		GenQueries = reinterpret_cast<PFNGENQUERIES>(IntGetProcAddress("glGenQueries"));
+		CheckLazyEntryPoint(GenQueries != 0, "glGenQueries");
+		return GenQueries(n, ids);
+	}
+	PFNGENQUERIES GenQueries = Switch_GenQueries;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETBUFFERPARAMETERIV GetBufferParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteriv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetBufferParameteriv = reinterpret_cast<PFNGETBUFFERPARAMETERIV>(IntGetProcAddress("glGetBufferParameteriv"));
+		CheckLazyEntryPoint(GetBufferParameteriv != 0, "glGetBufferParameteriv");
+		return GetBufferParameteriv(target, pname, params);
+	}
+	PFNGETBUFFERPARAMETERIV GetBufferParameteriv = Switch_GetBufferParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPOINTERV)(GLenum, GLenum, void **);
-	PFNGETBUFFERPOINTERV GetBufferPointerv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBufferPointerv(GLenum target, GLenum pname, void ** params)
+	{
+		GetBufferPointerv = reinterpret_cast<PFNGETBUFFERPOINTERV>(IntGetProcAddress("glGetBufferPointerv"));
+		CheckLazyEntryPoint(GetBufferPointerv != 0, "glGetBufferPointerv");
+		return GetBufferPointerv(target, pname, params);
+	}
+	PFNGETBUFFERPOINTERV GetBufferPointerv = Switch_GetBufferPointerv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERSUBDATA)(GLenum, GLintptr, GLsizeiptr, void *);
-	PFNGETBUFFERSUBDATA GetBufferSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data)
+	{
+		GetBufferSubData = reinterpret_cast<PFNGETBUFFERSUBDATA>(IntGetProcAddress("glGetBufferSubData"));
+		CheckLazyEntryPoint(GetBufferSubData != 0, "glGetBufferSubData");
+		return GetBufferSubData(target, offset, size, data);
+	}
+	PFNGETBUFFERSUBDATA GetBufferSubData = Switch_GetBufferSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTIV)(GLuint, GLenum, GLint *);
-	PFNGETQUERYOBJECTIV GetQueryObjectiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectiv(GLuint id, GLenum pname, GLint * params)
+	{
+		GetQueryObjectiv = reinterpret_cast<PFNGETQUERYOBJECTIV>(IntGetProcAddress("glGetQueryObjectiv"));
+		CheckLazyEntryPoint(GetQueryObjectiv != 0, "glGetQueryObjectiv");
+		return GetQueryObjectiv(id, pname, params);
+	}
+	PFNGETQUERYOBJECTIV GetQueryObjectiv = Switch_GetQueryObjectiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUIV)(GLuint, GLenum, GLuint *);
-	PFNGETQUERYOBJECTUIV GetQueryObjectuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params)
+	{
+		GetQueryObjectuiv = reinterpret_cast<PFNGETQUERYOBJECTUIV>(IntGetProcAddress("glGetQueryObjectuiv"));
+		CheckLazyEntryPoint(GetQueryObjectuiv != 0, "glGetQueryObjectuiv");
+		return GetQueryObjectuiv(id, pname, params);
+	}
+	PFNGETQUERYOBJECTUIV GetQueryObjectuiv = Switch_GetQueryObjectuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYIV)(GLenum, GLenum, GLint *);
-	PFNGETQUERYIV GetQueryiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryiv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetQueryiv = reinterpret_cast<PFNGETQUERYIV>(IntGetProcAddress("glGetQueryiv"));
+		CheckLazyEntryPoint(GetQueryiv != 0, "glGetQueryiv");
+		return GetQueryiv(target, pname, params);
+	}
+	PFNGETQUERYIV GetQueryiv = Switch_GetQueryiv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISBUFFER)(GLuint);
-	PFNISBUFFER IsBuffer = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsBuffer(GLuint buffer)
+	{
+		IsBuffer = reinterpret_cast<PFNISBUFFER>(IntGetProcAddress("glIsBuffer"));
+		CheckLazyEntryPoint(IsBuffer != 0, "glIsBuffer");
+		return IsBuffer(buffer);
+	}
+	PFNISBUFFER IsBuffer = Switch_IsBuffer;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISQUERY)(GLuint);
-	PFNISQUERY IsQuery = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsQuery(GLuint id)
+	{
+		IsQuery = reinterpret_cast<PFNISQUERY>(IntGetProcAddress("glIsQuery"));
+		CheckLazyEntryPoint(IsQuery != 0, "glIsQuery");
+		return IsQuery(id);
+	}
+	PFNISQUERY IsQuery = Switch_IsQuery;
 	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFER)(GLenum, GLenum);
-	PFNMAPBUFFER MapBuffer = 0;
+	static void * CODEGEN_FUNCPTR Switch_MapBuffer(GLenum target, GLenum access)
+	{
+		MapBuffer = reinterpret_cast<PFNMAPBUFFER>(IntGetProcAddress("glMapBuffer"));
+		CheckLazyEntryPoint(MapBuffer != 0, "glMapBuffer");
+		return MapBuffer(target, access);
+	}
+	PFNMAPBUFFER MapBuffer = Switch_MapBuffer;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNUNMAPBUFFER)(GLenum);
-	PFNUNMAPBUFFER UnmapBuffer = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_UnmapBuffer(GLenum target)
+	{
+		UnmapBuffer = reinterpret_cast<PFNUNMAPBUFFER>(IntGetProcAddress("glUnmapBuffer"));
+		CheckLazyEntryPoint(UnmapBuffer != 0, "glUnmapBuffer");
+		return UnmapBuffer(target);
+	}
+	PFNUNMAPBUFFER UnmapBuffer = Switch_UnmapBuffer;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNATTACHSHADER)(GLuint, GLuint);
-	PFNATTACHSHADER AttachShader = 0;
+	static void CODEGEN_FUNCPTR Switch_AttachShader(GLuint program, GLuint shader)
+	{
+		AttachShader = reinterpret_cast<PFNATTACHSHADER>(IntGetProcAddress("glAttachShader"));
+		CheckLazyEntryPoint(AttachShader != 0, "glAttachShader");
+		return AttachShader(program, shader);
+	}
+	PFNATTACHSHADER AttachShader = Switch_AttachShader;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDATTRIBLOCATION)(GLuint, GLuint, const GLchar *);
-	PFNBINDATTRIBLOCATION BindAttribLocation = 0;
+	static void CODEGEN_FUNCPTR Switch_BindAttribLocation(GLuint program, GLuint index, const GLchar * name)
+	{
+		BindAttribLocation = reinterpret_cast<PFNBINDATTRIBLOCATION>(IntGetProcAddress("glBindAttribLocation"));
+		CheckLazyEntryPoint(BindAttribLocation != 0, "glBindAttribLocation");
+		return BindAttribLocation(program, index, name);
+	}
+	PFNBINDATTRIBLOCATION BindAttribLocation = Switch_BindAttribLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDEQUATIONSEPARATE)(GLenum, GLenum);
-	PFNBLENDEQUATIONSEPARATE BlendEquationSeparate = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+	{
+		BlendEquationSeparate = reinterpret_cast<PFNBLENDEQUATIONSEPARATE>(IntGetProcAddress("glBlendEquationSeparate"));
+		CheckLazyEntryPoint(BlendEquationSeparate != 0, "glBlendEquationSeparate");
+		return BlendEquationSeparate(modeRGB, modeAlpha);
+	}
+	PFNBLENDEQUATIONSEPARATE BlendEquationSeparate = Switch_BlendEquationSeparate;
 	typedef void (CODEGEN_FUNCPTR *PFNCOMPILESHADER)(GLuint);
-	PFNCOMPILESHADER CompileShader = 0;
+	static void CODEGEN_FUNCPTR Switch_CompileShader(GLuint shader)
+	{
+		CompileShader = reinterpret_cast<PFNCOMPILESHADER>(IntGetProcAddress("glCompileShader"));
+		CheckLazyEntryPoint(CompileShader != 0, "glCompileShader");
+		return CompileShader(shader);
+	}
+	PFNCOMPILESHADER CompileShader = Switch_CompileShader;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATEPROGRAM)();
-	PFNCREATEPROGRAM CreateProgram = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_CreateProgram()
+	{
+		CreateProgram = reinterpret_cast<PFNCREATEPROGRAM>(IntGetProcAddress("glCreateProgram"));
+		CheckLazyEntryPoint(CreateProgram != 0, "glCreateProgram");
+		return CreateProgram();
+	}
+	PFNCREATEPROGRAM CreateProgram = Switch_CreateProgram;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATESHADER)(GLenum);
-	PFNCREATESHADER CreateShader = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_CreateShader(GLenum type)
+	{
+		CreateShader = reinterpret_cast<PFNCREATESHADER>(IntGetProcAddress("glCreateShader"));
+		CheckLazyEntryPoint(CreateShader != 0, "glCreateShader");
+		return CreateShader(type);
+	}
+	PFNCREATESHADER CreateShader = Switch_CreateShader;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEPROGRAM)(GLuint);
-	PFNDELETEPROGRAM DeleteProgram = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteProgram(GLuint program)
+	{
+		DeleteProgram = reinterpret_cast<PFNDELETEPROGRAM>(IntGetProcAddress("glDeleteProgram"));
+		CheckLazyEntryPoint(DeleteProgram != 0, "glDeleteProgram");
+		return DeleteProgram(program);
+	}
+	PFNDELETEPROGRAM DeleteProgram = Switch_DeleteProgram;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETESHADER)(GLuint);
-	PFNDELETESHADER DeleteShader = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteShader(GLuint shader)
+	{
+		DeleteShader = reinterpret_cast<PFNDELETESHADER>(IntGetProcAddress("glDeleteShader"));
+		CheckLazyEntryPoint(DeleteShader != 0, "glDeleteShader");
+		return DeleteShader(shader);
+	}
+	PFNDELETESHADER DeleteShader = Switch_DeleteShader;
 	typedef void (CODEGEN_FUNCPTR *PFNDETACHSHADER)(GLuint, GLuint);
-	PFNDETACHSHADER DetachShader = 0;
+	static void CODEGEN_FUNCPTR Switch_DetachShader(GLuint program, GLuint shader)
+	{
+		DetachShader = reinterpret_cast<PFNDETACHSHADER>(IntGetProcAddress("glDetachShader"));
+		CheckLazyEntryPoint(DetachShader != 0, "glDetachShader");
+		return DetachShader(program, shader);
+	}
+	PFNDETACHSHADER DetachShader = Switch_DetachShader;
 	typedef void (CODEGEN_FUNCPTR *PFNDISABLEVERTEXATTRIBARRAY)(GLuint);
-	PFNDISABLEVERTEXATTRIBARRAY DisableVertexAttribArray = 0;
+	static void CODEGEN_FUNCPTR Switch_DisableVertexAttribArray(GLuint index)
+	{
+		DisableVertexAttribArray = reinterpret_cast<PFNDISABLEVERTEXATTRIBARRAY>(IntGetProcAddress("glDisableVertexAttribArray"));
+		CheckLazyEntryPoint(DisableVertexAttribArray != 0, "glDisableVertexAttribArray");
+		return DisableVertexAttribArray(index);
+	}
+	PFNDISABLEVERTEXATTRIBARRAY DisableVertexAttribArray = Switch_DisableVertexAttribArray;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWBUFFERS)(GLsizei, const GLenum *);
-	PFNDRAWBUFFERS DrawBuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawBuffers(GLsizei n, const GLenum * bufs)
+	{
+		DrawBuffers = reinterpret_cast<PFNDRAWBUFFERS>(IntGetProcAddress("glDrawBuffers"));
+		CheckLazyEntryPoint(DrawBuffers != 0, "glDrawBuffers");
+		return DrawBuffers(n, bufs);
+	}
+	PFNDRAWBUFFERS DrawBuffers = Switch_DrawBuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNENABLEVERTEXATTRIBARRAY)(GLuint);
-	PFNENABLEVERTEXATTRIBARRAY EnableVertexAttribArray = 0;
+	static void CODEGEN_FUNCPTR Switch_EnableVertexAttribArray(GLuint index)
+	{
+		EnableVertexAttribArray = reinterpret_cast<PFNENABLEVERTEXATTRIBARRAY>(IntGetProcAddress("glEnableVertexAttribArray"));
+		CheckLazyEntryPoint(EnableVertexAttribArray != 0, "glEnableVertexAttribArray");
+		return EnableVertexAttribArray(index);
+	}
+	PFNENABLEVERTEXATTRIBARRAY EnableVertexAttribArray = Switch_EnableVertexAttribArray;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEATTRIB)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
-	PFNGETACTIVEATTRIB GetActiveAttrib = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+	{
+		GetActiveAttrib = reinterpret_cast<PFNGETACTIVEATTRIB>(IntGetProcAddress("glGetActiveAttrib"));
+		CheckLazyEntryPoint(GetActiveAttrib != 0, "glGetActiveAttrib");
+		return GetActiveAttrib(program, index, bufSize, length, size, type, name);
+	}
+	PFNGETACTIVEATTRIB GetActiveAttrib = Switch_GetActiveAttrib;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORM)(GLuint, GLuint, GLsizei, GLsizei *, GLint *, GLenum *, GLchar *);
-	PFNGETACTIVEUNIFORM GetActiveUniform = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+	{
+		GetActiveUniform = reinterpret_cast<PFNGETACTIVEUNIFORM>(IntGetProcAddress("glGetActiveUniform"));
+		CheckLazyEntryPoint(GetActiveUniform != 0, "glGetActiveUniform");
+		return GetActiveUniform(program, index, bufSize, length, size, type, name);
+	}
+	PFNGETACTIVEUNIFORM GetActiveUniform = Switch_GetActiveUniform;
 	typedef void (CODEGEN_FUNCPTR *PFNGETATTACHEDSHADERS)(GLuint, GLsizei, GLsizei *, GLuint *);
-	PFNGETATTACHEDSHADERS GetAttachedShaders = 0;
+	static void CODEGEN_FUNCPTR Switch_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders)
+	{
+		GetAttachedShaders = reinterpret_cast<PFNGETATTACHEDSHADERS>(IntGetProcAddress("glGetAttachedShaders"));
+		CheckLazyEntryPoint(GetAttachedShaders != 0, "glGetAttachedShaders");
+		return GetAttachedShaders(program, maxCount, count, shaders);
+	}
+	PFNGETATTACHEDSHADERS GetAttachedShaders = Switch_GetAttachedShaders;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETATTRIBLOCATION)(GLuint, const GLchar *);
-	PFNGETATTRIBLOCATION GetAttribLocation = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetAttribLocation(GLuint program, const GLchar * name)
+	{
+		GetAttribLocation = reinterpret_cast<PFNGETATTRIBLOCATION>(IntGetProcAddress("glGetAttribLocation"));
+		CheckLazyEntryPoint(GetAttribLocation != 0, "glGetAttribLocation");
+		return GetAttribLocation(program, name);
+	}
+	PFNGETATTRIBLOCATION GetAttribLocation = Switch_GetAttribLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETPROGRAMINFOLOG GetProgramInfoLog = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+	{
+		GetProgramInfoLog = reinterpret_cast<PFNGETPROGRAMINFOLOG>(IntGetProcAddress("glGetProgramInfoLog"));
+		CheckLazyEntryPoint(GetProgramInfoLog != 0, "glGetProgramInfoLog");
+		return GetProgramInfoLog(program, bufSize, length, infoLog);
+	}
+	PFNGETPROGRAMINFOLOG GetProgramInfoLog = Switch_GetProgramInfoLog;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMIV)(GLuint, GLenum, GLint *);
-	PFNGETPROGRAMIV GetProgramiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramiv(GLuint program, GLenum pname, GLint * params)
+	{
+		GetProgramiv = reinterpret_cast<PFNGETPROGRAMIV>(IntGetProcAddress("glGetProgramiv"));
+		CheckLazyEntryPoint(GetProgramiv != 0, "glGetProgramiv");
+		return GetProgramiv(program, pname, params);
+	}
+	PFNGETPROGRAMIV GetProgramiv = Switch_GetProgramiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETSHADERINFOLOG GetShaderInfoLog = 0;
+	static void CODEGEN_FUNCPTR Switch_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+	{
+		GetShaderInfoLog = reinterpret_cast<PFNGETSHADERINFOLOG>(IntGetProcAddress("glGetShaderInfoLog"));
+		CheckLazyEntryPoint(GetShaderInfoLog != 0, "glGetShaderInfoLog");
+		return GetShaderInfoLog(shader, bufSize, length, infoLog);
+	}
+	PFNGETSHADERINFOLOG GetShaderInfoLog = Switch_GetShaderInfoLog;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERSOURCE)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETSHADERSOURCE GetShaderSource = 0;
+	static void CODEGEN_FUNCPTR Switch_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source)
+	{
+		GetShaderSource = reinterpret_cast<PFNGETSHADERSOURCE>(IntGetProcAddress("glGetShaderSource"));
+		CheckLazyEntryPoint(GetShaderSource != 0, "glGetShaderSource");
+		return GetShaderSource(shader, bufSize, length, source);
+	}
+	PFNGETSHADERSOURCE GetShaderSource = Switch_GetShaderSource;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERIV)(GLuint, GLenum, GLint *);
-	PFNGETSHADERIV GetShaderiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetShaderiv(GLuint shader, GLenum pname, GLint * params)
+	{
+		GetShaderiv = reinterpret_cast<PFNGETSHADERIV>(IntGetProcAddress("glGetShaderiv"));
+		CheckLazyEntryPoint(GetShaderiv != 0, "glGetShaderiv");
+		return GetShaderiv(shader, pname, params);
+	}
+	PFNGETSHADERIV GetShaderiv = Switch_GetShaderiv;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETUNIFORMLOCATION)(GLuint, const GLchar *);
-	PFNGETUNIFORMLOCATION GetUniformLocation = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetUniformLocation(GLuint program, const GLchar * name)
+	{
+		GetUniformLocation = reinterpret_cast<PFNGETUNIFORMLOCATION>(IntGetProcAddress("glGetUniformLocation"));
+		CheckLazyEntryPoint(GetUniformLocation != 0, "glGetUniformLocation");
+		return GetUniformLocation(program, name);
+	}
+	PFNGETUNIFORMLOCATION GetUniformLocation = Switch_GetUniformLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMFV)(GLuint, GLint, GLfloat *);
-	PFNGETUNIFORMFV GetUniformfv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformfv(GLuint program, GLint location, GLfloat * params)
+	{
+		GetUniformfv = reinterpret_cast<PFNGETUNIFORMFV>(IntGetProcAddress("glGetUniformfv"));
+		CheckLazyEntryPoint(GetUniformfv != 0, "glGetUniformfv");
+		return GetUniformfv(program, location, params);
+	}
+	PFNGETUNIFORMFV GetUniformfv = Switch_GetUniformfv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMIV)(GLuint, GLint, GLint *);
-	PFNGETUNIFORMIV GetUniformiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformiv(GLuint program, GLint location, GLint * params)
+	{
+		GetUniformiv = reinterpret_cast<PFNGETUNIFORMIV>(IntGetProcAddress("glGetUniformiv"));
+		CheckLazyEntryPoint(GetUniformiv != 0, "glGetUniformiv");
+		return GetUniformiv(program, location, params);
+	}
+	PFNGETUNIFORMIV GetUniformiv = Switch_GetUniformiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBPOINTERV)(GLuint, GLenum, void **);
-	PFNGETVERTEXATTRIBPOINTERV GetVertexAttribPointerv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer)
+	{
+		GetVertexAttribPointerv = reinterpret_cast<PFNGETVERTEXATTRIBPOINTERV>(IntGetProcAddress("glGetVertexAttribPointerv"));
+		CheckLazyEntryPoint(GetVertexAttribPointerv != 0, "glGetVertexAttribPointerv");
+		return GetVertexAttribPointerv(index, pname, pointer);
+	}
+	PFNGETVERTEXATTRIBPOINTERV GetVertexAttribPointerv = Switch_GetVertexAttribPointerv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBDV)(GLuint, GLenum, GLdouble *);
-	PFNGETVERTEXATTRIBDV GetVertexAttribdv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params)
+	{
+		GetVertexAttribdv = reinterpret_cast<PFNGETVERTEXATTRIBDV>(IntGetProcAddress("glGetVertexAttribdv"));
+		CheckLazyEntryPoint(GetVertexAttribdv != 0, "glGetVertexAttribdv");
+		return GetVertexAttribdv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBDV GetVertexAttribdv = Switch_GetVertexAttribdv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBFV)(GLuint, GLenum, GLfloat *);
-	PFNGETVERTEXATTRIBFV GetVertexAttribfv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params)
+	{
+		GetVertexAttribfv = reinterpret_cast<PFNGETVERTEXATTRIBFV>(IntGetProcAddress("glGetVertexAttribfv"));
+		CheckLazyEntryPoint(GetVertexAttribfv != 0, "glGetVertexAttribfv");
+		return GetVertexAttribfv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBFV GetVertexAttribfv = Switch_GetVertexAttribfv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIV)(GLuint, GLenum, GLint *);
-	PFNGETVERTEXATTRIBIV GetVertexAttribiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribiv(GLuint index, GLenum pname, GLint * params)
+	{
+		GetVertexAttribiv = reinterpret_cast<PFNGETVERTEXATTRIBIV>(IntGetProcAddress("glGetVertexAttribiv"));
+		CheckLazyEntryPoint(GetVertexAttribiv != 0, "glGetVertexAttribiv");
+		return GetVertexAttribiv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBIV GetVertexAttribiv = Switch_GetVertexAttribiv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISPROGRAM)(GLuint);
-	PFNISPROGRAM IsProgram = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsProgram(GLuint program)
+	{
+		IsProgram = reinterpret_cast<PFNISPROGRAM>(IntGetProcAddress("glIsProgram"));
+		CheckLazyEntryPoint(IsProgram != 0, "glIsProgram");
+		return IsProgram(program);
+	}
+	PFNISPROGRAM IsProgram = Switch_IsProgram;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSHADER)(GLuint);
-	PFNISSHADER IsShader = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsShader(GLuint shader)
+	{
+		IsShader = reinterpret_cast<PFNISSHADER>(IntGetProcAddress("glIsShader"));
+		CheckLazyEntryPoint(IsShader != 0, "glIsShader");
+		return IsShader(shader);
+	}
+	PFNISSHADER IsShader = Switch_IsShader;
 	typedef void (CODEGEN_FUNCPTR *PFNLINKPROGRAM)(GLuint);
-	PFNLINKPROGRAM LinkProgram = 0;
+	static void CODEGEN_FUNCPTR Switch_LinkProgram(GLuint program)
+	{
+		LinkProgram = reinterpret_cast<PFNLINKPROGRAM>(IntGetProcAddress("glLinkProgram"));
+		CheckLazyEntryPoint(LinkProgram != 0, "glLinkProgram");
+		return LinkProgram(program);
+	}
+	PFNLINKPROGRAM LinkProgram = Switch_LinkProgram;
 	typedef void (CODEGEN_FUNCPTR *PFNSHADERSOURCE)(GLuint, GLsizei, const GLchar *const*, const GLint *);
-	PFNSHADERSOURCE ShaderSource = 0;
+	static void CODEGEN_FUNCPTR Switch_ShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length)
+	{
+		ShaderSource = reinterpret_cast<PFNSHADERSOURCE>(IntGetProcAddress("glShaderSource"));
+		CheckLazyEntryPoint(ShaderSource != 0, "glShaderSource");
+		return ShaderSource(shader, count, string, length);
+	}
+	PFNSHADERSOURCE ShaderSource = Switch_ShaderSource;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILFUNCSEPARATE)(GLenum, GLenum, GLint, GLuint);
-	PFNSTENCILFUNCSEPARATE StencilFuncSeparate = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+	{
+		StencilFuncSeparate = reinterpret_cast<PFNSTENCILFUNCSEPARATE>(IntGetProcAddress("glStencilFuncSeparate"));
+		CheckLazyEntryPoint(StencilFuncSeparate != 0, "glStencilFuncSeparate");
+		return StencilFuncSeparate(face, func, ref, mask);
+	}
+	PFNSTENCILFUNCSEPARATE StencilFuncSeparate = Switch_StencilFuncSeparate;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILMASKSEPARATE)(GLenum, GLuint);
-	PFNSTENCILMASKSEPARATE StencilMaskSeparate = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilMaskSeparate(GLenum face, GLuint mask)
+	{
+		StencilMaskSeparate = reinterpret_cast<PFNSTENCILMASKSEPARATE>(IntGetProcAddress("glStencilMaskSeparate"));
+		CheckLazyEntryPoint(StencilMaskSeparate != 0, "glStencilMaskSeparate");
+		return StencilMaskSeparate(face, mask);
+	}
+	PFNSTENCILMASKSEPARATE StencilMaskSeparate = Switch_StencilMaskSeparate;
 	typedef void (CODEGEN_FUNCPTR *PFNSTENCILOPSEPARATE)(GLenum, GLenum, GLenum, GLenum);
-	PFNSTENCILOPSEPARATE StencilOpSeparate = 0;
+	static void CODEGEN_FUNCPTR Switch_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+	{
+		StencilOpSeparate = reinterpret_cast<PFNSTENCILOPSEPARATE>(IntGetProcAddress("glStencilOpSeparate"));
+		CheckLazyEntryPoint(StencilOpSeparate != 0, "glStencilOpSeparate");
+		return StencilOpSeparate(face, sfail, dpfail, dppass);
+	}
+	PFNSTENCILOPSEPARATE StencilOpSeparate = Switch_StencilOpSeparate;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1F)(GLint, GLfloat);
-	PFNUNIFORM1F Uniform1f = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1f(GLint location, GLfloat v0)
+	{
+		Uniform1f = reinterpret_cast<PFNUNIFORM1F>(IntGetProcAddress("glUniform1f"));
+		CheckLazyEntryPoint(Uniform1f != 0, "glUniform1f");
+		return Uniform1f(location, v0);
+	}
+	PFNUNIFORM1F Uniform1f = Switch_Uniform1f;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM1FV Uniform1fv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1fv(GLint location, GLsizei count, const GLfloat * value)
+	{
+		Uniform1fv = reinterpret_cast<PFNUNIFORM1FV>(IntGetProcAddress("glUniform1fv"));
+		CheckLazyEntryPoint(Uniform1fv != 0, "glUniform1fv");
+		return Uniform1fv(location, count, value);
+	}
+	PFNUNIFORM1FV Uniform1fv = Switch_Uniform1fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1I)(GLint, GLint);
-	PFNUNIFORM1I Uniform1i = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1i(GLint location, GLint v0)
+	{
+		Uniform1i = reinterpret_cast<PFNUNIFORM1I>(IntGetProcAddress("glUniform1i"));
+		CheckLazyEntryPoint(Uniform1i != 0, "glUniform1i");
+		return Uniform1i(location, v0);
+	}
+	PFNUNIFORM1I Uniform1i = Switch_Uniform1i;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM1IV Uniform1iv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1iv(GLint location, GLsizei count, const GLint * value)
+	{
+		Uniform1iv = reinterpret_cast<PFNUNIFORM1IV>(IntGetProcAddress("glUniform1iv"));
+		CheckLazyEntryPoint(Uniform1iv != 0, "glUniform1iv");
+		return Uniform1iv(location, count, value);
+	}
+	PFNUNIFORM1IV Uniform1iv = Switch_Uniform1iv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2F)(GLint, GLfloat, GLfloat);
-	PFNUNIFORM2F Uniform2f = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
+	{
+		Uniform2f = reinterpret_cast<PFNUNIFORM2F>(IntGetProcAddress("glUniform2f"));
+		CheckLazyEntryPoint(Uniform2f != 0, "glUniform2f");
+		return Uniform2f(location, v0, v1);
+	}
+	PFNUNIFORM2F Uniform2f = Switch_Uniform2f;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM2FV Uniform2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2fv(GLint location, GLsizei count, const GLfloat * value)
+	{
+		Uniform2fv = reinterpret_cast<PFNUNIFORM2FV>(IntGetProcAddress("glUniform2fv"));
+		CheckLazyEntryPoint(Uniform2fv != 0, "glUniform2fv");
+		return Uniform2fv(location, count, value);
+	}
+	PFNUNIFORM2FV Uniform2fv = Switch_Uniform2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2I)(GLint, GLint, GLint);
-	PFNUNIFORM2I Uniform2i = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2i(GLint location, GLint v0, GLint v1)
+	{
+		Uniform2i = reinterpret_cast<PFNUNIFORM2I>(IntGetProcAddress("glUniform2i"));
+		CheckLazyEntryPoint(Uniform2i != 0, "glUniform2i");
+		return Uniform2i(location, v0, v1);
+	}
+	PFNUNIFORM2I Uniform2i = Switch_Uniform2i;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM2IV Uniform2iv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2iv(GLint location, GLsizei count, const GLint * value)
+	{
+		Uniform2iv = reinterpret_cast<PFNUNIFORM2IV>(IntGetProcAddress("glUniform2iv"));
+		CheckLazyEntryPoint(Uniform2iv != 0, "glUniform2iv");
+		return Uniform2iv(location, count, value);
+	}
+	PFNUNIFORM2IV Uniform2iv = Switch_Uniform2iv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3F)(GLint, GLfloat, GLfloat, GLfloat);
-	PFNUNIFORM3F Uniform3f = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+	{
+		Uniform3f = reinterpret_cast<PFNUNIFORM3F>(IntGetProcAddress("glUniform3f"));
+		CheckLazyEntryPoint(Uniform3f != 0, "glUniform3f");
+		return Uniform3f(location, v0, v1, v2);
+	}
+	PFNUNIFORM3F Uniform3f = Switch_Uniform3f;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM3FV Uniform3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3fv(GLint location, GLsizei count, const GLfloat * value)
+	{
+		Uniform3fv = reinterpret_cast<PFNUNIFORM3FV>(IntGetProcAddress("glUniform3fv"));
+		CheckLazyEntryPoint(Uniform3fv != 0, "glUniform3fv");
+		return Uniform3fv(location, count, value);
+	}
+	PFNUNIFORM3FV Uniform3fv = Switch_Uniform3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3I)(GLint, GLint, GLint, GLint);
-	PFNUNIFORM3I Uniform3i = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+	{
+		Uniform3i = reinterpret_cast<PFNUNIFORM3I>(IntGetProcAddress("glUniform3i"));
+		CheckLazyEntryPoint(Uniform3i != 0, "glUniform3i");
+		return Uniform3i(location, v0, v1, v2);
+	}
+	PFNUNIFORM3I Uniform3i = Switch_Uniform3i;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM3IV Uniform3iv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3iv(GLint location, GLsizei count, const GLint * value)
+	{
+		Uniform3iv = reinterpret_cast<PFNUNIFORM3IV>(IntGetProcAddress("glUniform3iv"));
+		CheckLazyEntryPoint(Uniform3iv != 0, "glUniform3iv");
+		return Uniform3iv(location, count, value);
+	}
+	PFNUNIFORM3IV Uniform3iv = Switch_Uniform3iv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4F)(GLint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNUNIFORM4F Uniform4f = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+	{
+		Uniform4f = reinterpret_cast<PFNUNIFORM4F>(IntGetProcAddress("glUniform4f"));
+		CheckLazyEntryPoint(Uniform4f != 0, "glUniform4f");
+		return Uniform4f(location, v0, v1, v2, v3);
+	}
+	PFNUNIFORM4F Uniform4f = Switch_Uniform4f;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4FV)(GLint, GLsizei, const GLfloat *);
-	PFNUNIFORM4FV Uniform4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4fv(GLint location, GLsizei count, const GLfloat * value)
+	{
+		Uniform4fv = reinterpret_cast<PFNUNIFORM4FV>(IntGetProcAddress("glUniform4fv"));
+		CheckLazyEntryPoint(Uniform4fv != 0, "glUniform4fv");
+		return Uniform4fv(location, count, value);
+	}
+	PFNUNIFORM4FV Uniform4fv = Switch_Uniform4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4I)(GLint, GLint, GLint, GLint, GLint);
-	PFNUNIFORM4I Uniform4i = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+	{
+		Uniform4i = reinterpret_cast<PFNUNIFORM4I>(IntGetProcAddress("glUniform4i"));
+		CheckLazyEntryPoint(Uniform4i != 0, "glUniform4i");
+		return Uniform4i(location, v0, v1, v2, v3);
+	}
+	PFNUNIFORM4I Uniform4i = Switch_Uniform4i;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4IV)(GLint, GLsizei, const GLint *);
-	PFNUNIFORM4IV Uniform4iv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4iv(GLint location, GLsizei count, const GLint * value)
+	{
+		Uniform4iv = reinterpret_cast<PFNUNIFORM4IV>(IntGetProcAddress("glUniform4iv"));
+		CheckLazyEntryPoint(Uniform4iv != 0, "glUniform4iv");
+		return Uniform4iv(location, count, value);
+	}
+	PFNUNIFORM4IV Uniform4iv = Switch_Uniform4iv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2FV UniformMatrix2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix2fv = reinterpret_cast<PFNUNIFORMMATRIX2FV>(IntGetProcAddress("glUniformMatrix2fv"));
+		CheckLazyEntryPoint(UniformMatrix2fv != 0, "glUniformMatrix2fv");
+		return UniformMatrix2fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2FV UniformMatrix2fv = Switch_UniformMatrix2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3FV UniformMatrix3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix3fv = reinterpret_cast<PFNUNIFORMMATRIX3FV>(IntGetProcAddress("glUniformMatrix3fv"));
+		CheckLazyEntryPoint(UniformMatrix3fv != 0, "glUniformMatrix3fv");
+		return UniformMatrix3fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3FV UniformMatrix3fv = Switch_UniformMatrix3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4FV UniformMatrix4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix4fv = reinterpret_cast<PFNUNIFORMMATRIX4FV>(IntGetProcAddress("glUniformMatrix4fv"));
+		CheckLazyEntryPoint(UniformMatrix4fv != 0, "glUniformMatrix4fv");
+		return UniformMatrix4fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4FV UniformMatrix4fv = Switch_UniformMatrix4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUSEPROGRAM)(GLuint);
-	PFNUSEPROGRAM UseProgram = 0;
+	static void CODEGEN_FUNCPTR Switch_UseProgram(GLuint program)
+	{
+		UseProgram = reinterpret_cast<PFNUSEPROGRAM>(IntGetProcAddress("glUseProgram"));
+		CheckLazyEntryPoint(UseProgram != 0, "glUseProgram");
+		return UseProgram(program);
+	}
+	PFNUSEPROGRAM UseProgram = Switch_UseProgram;
 	typedef void (CODEGEN_FUNCPTR *PFNVALIDATEPROGRAM)(GLuint);
-	PFNVALIDATEPROGRAM ValidateProgram = 0;
+	static void CODEGEN_FUNCPTR Switch_ValidateProgram(GLuint program)
+	{
+		ValidateProgram = reinterpret_cast<PFNVALIDATEPROGRAM>(IntGetProcAddress("glValidateProgram"));
+		CheckLazyEntryPoint(ValidateProgram != 0, "glValidateProgram");
+		return ValidateProgram(program);
+	}
+	PFNVALIDATEPROGRAM ValidateProgram = Switch_ValidateProgram;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1D)(GLuint, GLdouble);
-	PFNVERTEXATTRIB1D VertexAttrib1d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1d(GLuint index, GLdouble x)
+	{
+		VertexAttrib1d = reinterpret_cast<PFNVERTEXATTRIB1D>(IntGetProcAddress("glVertexAttrib1d"));
+		CheckLazyEntryPoint(VertexAttrib1d != 0, "glVertexAttrib1d");
+		return VertexAttrib1d(index, x);
+	}
+	PFNVERTEXATTRIB1D VertexAttrib1d = Switch_VertexAttrib1d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB1DV VertexAttrib1dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttrib1dv = reinterpret_cast<PFNVERTEXATTRIB1DV>(IntGetProcAddress("glVertexAttrib1dv"));
+		CheckLazyEntryPoint(VertexAttrib1dv != 0, "glVertexAttrib1dv");
+		return VertexAttrib1dv(index, v);
+	}
+	PFNVERTEXATTRIB1DV VertexAttrib1dv = Switch_VertexAttrib1dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1F)(GLuint, GLfloat);
-	PFNVERTEXATTRIB1F VertexAttrib1f = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1f(GLuint index, GLfloat x)
+	{
+		VertexAttrib1f = reinterpret_cast<PFNVERTEXATTRIB1F>(IntGetProcAddress("glVertexAttrib1f"));
+		CheckLazyEntryPoint(VertexAttrib1f != 0, "glVertexAttrib1f");
+		return VertexAttrib1f(index, x);
+	}
+	PFNVERTEXATTRIB1F VertexAttrib1f = Switch_VertexAttrib1f;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB1FV VertexAttrib1fv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1fv(GLuint index, const GLfloat * v)
+	{
+		VertexAttrib1fv = reinterpret_cast<PFNVERTEXATTRIB1FV>(IntGetProcAddress("glVertexAttrib1fv"));
+		CheckLazyEntryPoint(VertexAttrib1fv != 0, "glVertexAttrib1fv");
+		return VertexAttrib1fv(index, v);
+	}
+	PFNVERTEXATTRIB1FV VertexAttrib1fv = Switch_VertexAttrib1fv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1S)(GLuint, GLshort);
-	PFNVERTEXATTRIB1S VertexAttrib1s = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1s(GLuint index, GLshort x)
+	{
+		VertexAttrib1s = reinterpret_cast<PFNVERTEXATTRIB1S>(IntGetProcAddress("glVertexAttrib1s"));
+		CheckLazyEntryPoint(VertexAttrib1s != 0, "glVertexAttrib1s");
+		return VertexAttrib1s(index, x);
+	}
+	PFNVERTEXATTRIB1S VertexAttrib1s = Switch_VertexAttrib1s;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB1SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB1SV VertexAttrib1sv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1sv(GLuint index, const GLshort * v)
+	{
+		VertexAttrib1sv = reinterpret_cast<PFNVERTEXATTRIB1SV>(IntGetProcAddress("glVertexAttrib1sv"));
+		CheckLazyEntryPoint(VertexAttrib1sv != 0, "glVertexAttrib1sv");
+		return VertexAttrib1sv(index, v);
+	}
+	PFNVERTEXATTRIB1SV VertexAttrib1sv = Switch_VertexAttrib1sv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2D)(GLuint, GLdouble, GLdouble);
-	PFNVERTEXATTRIB2D VertexAttrib2d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+	{
+		VertexAttrib2d = reinterpret_cast<PFNVERTEXATTRIB2D>(IntGetProcAddress("glVertexAttrib2d"));
+		CheckLazyEntryPoint(VertexAttrib2d != 0, "glVertexAttrib2d");
+		return VertexAttrib2d(index, x, y);
+	}
+	PFNVERTEXATTRIB2D VertexAttrib2d = Switch_VertexAttrib2d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB2DV VertexAttrib2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttrib2dv = reinterpret_cast<PFNVERTEXATTRIB2DV>(IntGetProcAddress("glVertexAttrib2dv"));
+		CheckLazyEntryPoint(VertexAttrib2dv != 0, "glVertexAttrib2dv");
+		return VertexAttrib2dv(index, v);
+	}
+	PFNVERTEXATTRIB2DV VertexAttrib2dv = Switch_VertexAttrib2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2F)(GLuint, GLfloat, GLfloat);
-	PFNVERTEXATTRIB2F VertexAttrib2f = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+	{
+		VertexAttrib2f = reinterpret_cast<PFNVERTEXATTRIB2F>(IntGetProcAddress("glVertexAttrib2f"));
+		CheckLazyEntryPoint(VertexAttrib2f != 0, "glVertexAttrib2f");
+		return VertexAttrib2f(index, x, y);
+	}
+	PFNVERTEXATTRIB2F VertexAttrib2f = Switch_VertexAttrib2f;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB2FV VertexAttrib2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2fv(GLuint index, const GLfloat * v)
+	{
+		VertexAttrib2fv = reinterpret_cast<PFNVERTEXATTRIB2FV>(IntGetProcAddress("glVertexAttrib2fv"));
+		CheckLazyEntryPoint(VertexAttrib2fv != 0, "glVertexAttrib2fv");
+		return VertexAttrib2fv(index, v);
+	}
+	PFNVERTEXATTRIB2FV VertexAttrib2fv = Switch_VertexAttrib2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2S)(GLuint, GLshort, GLshort);
-	PFNVERTEXATTRIB2S VertexAttrib2s = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2s(GLuint index, GLshort x, GLshort y)
+	{
+		VertexAttrib2s = reinterpret_cast<PFNVERTEXATTRIB2S>(IntGetProcAddress("glVertexAttrib2s"));
+		CheckLazyEntryPoint(VertexAttrib2s != 0, "glVertexAttrib2s");
+		return VertexAttrib2s(index, x, y);
+	}
+	PFNVERTEXATTRIB2S VertexAttrib2s = Switch_VertexAttrib2s;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB2SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB2SV VertexAttrib2sv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2sv(GLuint index, const GLshort * v)
+	{
+		VertexAttrib2sv = reinterpret_cast<PFNVERTEXATTRIB2SV>(IntGetProcAddress("glVertexAttrib2sv"));
+		CheckLazyEntryPoint(VertexAttrib2sv != 0, "glVertexAttrib2sv");
+		return VertexAttrib2sv(index, v);
+	}
+	PFNVERTEXATTRIB2SV VertexAttrib2sv = Switch_VertexAttrib2sv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3D)(GLuint, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIB3D VertexAttrib3d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+	{
+		VertexAttrib3d = reinterpret_cast<PFNVERTEXATTRIB3D>(IntGetProcAddress("glVertexAttrib3d"));
+		CheckLazyEntryPoint(VertexAttrib3d != 0, "glVertexAttrib3d");
+		return VertexAttrib3d(index, x, y, z);
+	}
+	PFNVERTEXATTRIB3D VertexAttrib3d = Switch_VertexAttrib3d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB3DV VertexAttrib3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttrib3dv = reinterpret_cast<PFNVERTEXATTRIB3DV>(IntGetProcAddress("glVertexAttrib3dv"));
+		CheckLazyEntryPoint(VertexAttrib3dv != 0, "glVertexAttrib3dv");
+		return VertexAttrib3dv(index, v);
+	}
+	PFNVERTEXATTRIB3DV VertexAttrib3dv = Switch_VertexAttrib3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3F)(GLuint, GLfloat, GLfloat, GLfloat);
-	PFNVERTEXATTRIB3F VertexAttrib3f = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+	{
+		VertexAttrib3f = reinterpret_cast<PFNVERTEXATTRIB3F>(IntGetProcAddress("glVertexAttrib3f"));
+		CheckLazyEntryPoint(VertexAttrib3f != 0, "glVertexAttrib3f");
+		return VertexAttrib3f(index, x, y, z);
+	}
+	PFNVERTEXATTRIB3F VertexAttrib3f = Switch_VertexAttrib3f;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB3FV VertexAttrib3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3fv(GLuint index, const GLfloat * v)
+	{
+		VertexAttrib3fv = reinterpret_cast<PFNVERTEXATTRIB3FV>(IntGetProcAddress("glVertexAttrib3fv"));
+		CheckLazyEntryPoint(VertexAttrib3fv != 0, "glVertexAttrib3fv");
+		return VertexAttrib3fv(index, v);
+	}
+	PFNVERTEXATTRIB3FV VertexAttrib3fv = Switch_VertexAttrib3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3S)(GLuint, GLshort, GLshort, GLshort);
-	PFNVERTEXATTRIB3S VertexAttrib3s = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+	{
+		VertexAttrib3s = reinterpret_cast<PFNVERTEXATTRIB3S>(IntGetProcAddress("glVertexAttrib3s"));
+		CheckLazyEntryPoint(VertexAttrib3s != 0, "glVertexAttrib3s");
+		return VertexAttrib3s(index, x, y, z);
+	}
+	PFNVERTEXATTRIB3S VertexAttrib3s = Switch_VertexAttrib3s;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB3SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB3SV VertexAttrib3sv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3sv(GLuint index, const GLshort * v)
+	{
+		VertexAttrib3sv = reinterpret_cast<PFNVERTEXATTRIB3SV>(IntGetProcAddress("glVertexAttrib3sv"));
+		CheckLazyEntryPoint(VertexAttrib3sv != 0, "glVertexAttrib3sv");
+		return VertexAttrib3sv(index, v);
+	}
+	PFNVERTEXATTRIB3SV VertexAttrib3sv = Switch_VertexAttrib3sv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NBV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIB4NBV VertexAttrib4Nbv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nbv(GLuint index, const GLbyte * v)
+	{
+		VertexAttrib4Nbv = reinterpret_cast<PFNVERTEXATTRIB4NBV>(IntGetProcAddress("glVertexAttrib4Nbv"));
+		CheckLazyEntryPoint(VertexAttrib4Nbv != 0, "glVertexAttrib4Nbv");
+		return VertexAttrib4Nbv(index, v);
+	}
+	PFNVERTEXATTRIB4NBV VertexAttrib4Nbv = Switch_VertexAttrib4Nbv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NIV)(GLuint, const GLint *);
-	PFNVERTEXATTRIB4NIV VertexAttrib4Niv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Niv(GLuint index, const GLint * v)
+	{
+		VertexAttrib4Niv = reinterpret_cast<PFNVERTEXATTRIB4NIV>(IntGetProcAddress("glVertexAttrib4Niv"));
+		CheckLazyEntryPoint(VertexAttrib4Niv != 0, "glVertexAttrib4Niv");
+		return VertexAttrib4Niv(index, v);
+	}
+	PFNVERTEXATTRIB4NIV VertexAttrib4Niv = Switch_VertexAttrib4Niv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NSV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB4NSV VertexAttrib4Nsv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nsv(GLuint index, const GLshort * v)
+	{
+		VertexAttrib4Nsv = reinterpret_cast<PFNVERTEXATTRIB4NSV>(IntGetProcAddress("glVertexAttrib4Nsv"));
+		CheckLazyEntryPoint(VertexAttrib4Nsv != 0, "glVertexAttrib4Nsv");
+		return VertexAttrib4Nsv(index, v);
+	}
+	PFNVERTEXATTRIB4NSV VertexAttrib4Nsv = Switch_VertexAttrib4Nsv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUB)(GLuint, GLubyte, GLubyte, GLubyte, GLubyte);
-	PFNVERTEXATTRIB4NUB VertexAttrib4Nub = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+	{
+		VertexAttrib4Nub = reinterpret_cast<PFNVERTEXATTRIB4NUB>(IntGetProcAddress("glVertexAttrib4Nub"));
+		CheckLazyEntryPoint(VertexAttrib4Nub != 0, "glVertexAttrib4Nub");
+		return VertexAttrib4Nub(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIB4NUB VertexAttrib4Nub = Switch_VertexAttrib4Nub;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIB4NUBV VertexAttrib4Nubv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nubv(GLuint index, const GLubyte * v)
+	{
+		VertexAttrib4Nubv = reinterpret_cast<PFNVERTEXATTRIB4NUBV>(IntGetProcAddress("glVertexAttrib4Nubv"));
+		CheckLazyEntryPoint(VertexAttrib4Nubv != 0, "glVertexAttrib4Nubv");
+		return VertexAttrib4Nubv(index, v);
+	}
+	PFNVERTEXATTRIB4NUBV VertexAttrib4Nubv = Switch_VertexAttrib4Nubv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIB4NUIV VertexAttrib4Nuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nuiv(GLuint index, const GLuint * v)
+	{
+		VertexAttrib4Nuiv = reinterpret_cast<PFNVERTEXATTRIB4NUIV>(IntGetProcAddress("glVertexAttrib4Nuiv"));
+		CheckLazyEntryPoint(VertexAttrib4Nuiv != 0, "glVertexAttrib4Nuiv");
+		return VertexAttrib4Nuiv(index, v);
+	}
+	PFNVERTEXATTRIB4NUIV VertexAttrib4Nuiv = Switch_VertexAttrib4Nuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4NUSV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIB4NUSV VertexAttrib4Nusv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nusv(GLuint index, const GLushort * v)
+	{
+		VertexAttrib4Nusv = reinterpret_cast<PFNVERTEXATTRIB4NUSV>(IntGetProcAddress("glVertexAttrib4Nusv"));
+		CheckLazyEntryPoint(VertexAttrib4Nusv != 0, "glVertexAttrib4Nusv");
+		return VertexAttrib4Nusv(index, v);
+	}
+	PFNVERTEXATTRIB4NUSV VertexAttrib4Nusv = Switch_VertexAttrib4Nusv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4BV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIB4BV VertexAttrib4bv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4bv(GLuint index, const GLbyte * v)
+	{
+		VertexAttrib4bv = reinterpret_cast<PFNVERTEXATTRIB4BV>(IntGetProcAddress("glVertexAttrib4bv"));
+		CheckLazyEntryPoint(VertexAttrib4bv != 0, "glVertexAttrib4bv");
+		return VertexAttrib4bv(index, v);
+	}
+	PFNVERTEXATTRIB4BV VertexAttrib4bv = Switch_VertexAttrib4bv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4D)(GLuint, GLdouble, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIB4D VertexAttrib4d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+	{
+		VertexAttrib4d = reinterpret_cast<PFNVERTEXATTRIB4D>(IntGetProcAddress("glVertexAttrib4d"));
+		CheckLazyEntryPoint(VertexAttrib4d != 0, "glVertexAttrib4d");
+		return VertexAttrib4d(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIB4D VertexAttrib4d = Switch_VertexAttrib4d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIB4DV VertexAttrib4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttrib4dv = reinterpret_cast<PFNVERTEXATTRIB4DV>(IntGetProcAddress("glVertexAttrib4dv"));
+		CheckLazyEntryPoint(VertexAttrib4dv != 0, "glVertexAttrib4dv");
+		return VertexAttrib4dv(index, v);
+	}
+	PFNVERTEXATTRIB4DV VertexAttrib4dv = Switch_VertexAttrib4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4F)(GLuint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNVERTEXATTRIB4F VertexAttrib4f = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+	{
+		VertexAttrib4f = reinterpret_cast<PFNVERTEXATTRIB4F>(IntGetProcAddress("glVertexAttrib4f"));
+		CheckLazyEntryPoint(VertexAttrib4f != 0, "glVertexAttrib4f");
+		return VertexAttrib4f(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIB4F VertexAttrib4f = Switch_VertexAttrib4f;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4FV)(GLuint, const GLfloat *);
-	PFNVERTEXATTRIB4FV VertexAttrib4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4fv(GLuint index, const GLfloat * v)
+	{
+		VertexAttrib4fv = reinterpret_cast<PFNVERTEXATTRIB4FV>(IntGetProcAddress("glVertexAttrib4fv"));
+		CheckLazyEntryPoint(VertexAttrib4fv != 0, "glVertexAttrib4fv");
+		return VertexAttrib4fv(index, v);
+	}
+	PFNVERTEXATTRIB4FV VertexAttrib4fv = Switch_VertexAttrib4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIB4IV VertexAttrib4iv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4iv(GLuint index, const GLint * v)
+	{
+		VertexAttrib4iv = reinterpret_cast<PFNVERTEXATTRIB4IV>(IntGetProcAddress("glVertexAttrib4iv"));
+		CheckLazyEntryPoint(VertexAttrib4iv != 0, "glVertexAttrib4iv");
+		return VertexAttrib4iv(index, v);
+	}
+	PFNVERTEXATTRIB4IV VertexAttrib4iv = Switch_VertexAttrib4iv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4S)(GLuint, GLshort, GLshort, GLshort, GLshort);
-	PFNVERTEXATTRIB4S VertexAttrib4s = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+	{
+		VertexAttrib4s = reinterpret_cast<PFNVERTEXATTRIB4S>(IntGetProcAddress("glVertexAttrib4s"));
+		CheckLazyEntryPoint(VertexAttrib4s != 0, "glVertexAttrib4s");
+		return VertexAttrib4s(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIB4S VertexAttrib4s = Switch_VertexAttrib4s;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIB4SV VertexAttrib4sv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4sv(GLuint index, const GLshort * v)
+	{
+		VertexAttrib4sv = reinterpret_cast<PFNVERTEXATTRIB4SV>(IntGetProcAddress("glVertexAttrib4sv"));
+		CheckLazyEntryPoint(VertexAttrib4sv != 0, "glVertexAttrib4sv");
+		return VertexAttrib4sv(index, v);
+	}
+	PFNVERTEXATTRIB4SV VertexAttrib4sv = Switch_VertexAttrib4sv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIB4UBV VertexAttrib4ubv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4ubv(GLuint index, const GLubyte * v)
+	{
+		VertexAttrib4ubv = reinterpret_cast<PFNVERTEXATTRIB4UBV>(IntGetProcAddress("glVertexAttrib4ubv"));
+		CheckLazyEntryPoint(VertexAttrib4ubv != 0, "glVertexAttrib4ubv");
+		return VertexAttrib4ubv(index, v);
+	}
+	PFNVERTEXATTRIB4UBV VertexAttrib4ubv = Switch_VertexAttrib4ubv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIB4UIV VertexAttrib4uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4uiv(GLuint index, const GLuint * v)
+	{
+		VertexAttrib4uiv = reinterpret_cast<PFNVERTEXATTRIB4UIV>(IntGetProcAddress("glVertexAttrib4uiv"));
+		CheckLazyEntryPoint(VertexAttrib4uiv != 0, "glVertexAttrib4uiv");
+		return VertexAttrib4uiv(index, v);
+	}
+	PFNVERTEXATTRIB4UIV VertexAttrib4uiv = Switch_VertexAttrib4uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIB4USV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIB4USV VertexAttrib4usv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4usv(GLuint index, const GLushort * v)
+	{
+		VertexAttrib4usv = reinterpret_cast<PFNVERTEXATTRIB4USV>(IntGetProcAddress("glVertexAttrib4usv"));
+		CheckLazyEntryPoint(VertexAttrib4usv != 0, "glVertexAttrib4usv");
+		return VertexAttrib4usv(index, v);
+	}
+	PFNVERTEXATTRIB4USV VertexAttrib4usv = Switch_VertexAttrib4usv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBPOINTER)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *);
-	PFNVERTEXATTRIBPOINTER VertexAttribPointer = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)
+	{
+		VertexAttribPointer = reinterpret_cast<PFNVERTEXATTRIBPOINTER>(IntGetProcAddress("glVertexAttribPointer"));
+		CheckLazyEntryPoint(VertexAttribPointer != 0, "glVertexAttribPointer");
+		return VertexAttribPointer(index, size, type, normalized, stride, pointer);
+	}
+	PFNVERTEXATTRIBPOINTER VertexAttribPointer = Switch_VertexAttribPointer;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2X3FV UniformMatrix2x3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix2x3fv = reinterpret_cast<PFNUNIFORMMATRIX2X3FV>(IntGetProcAddress("glUniformMatrix2x3fv"));
+		CheckLazyEntryPoint(UniformMatrix2x3fv != 0, "glUniformMatrix2x3fv");
+		return UniformMatrix2x3fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2X3FV UniformMatrix2x3fv = Switch_UniformMatrix2x3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX2X4FV UniformMatrix2x4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix2x4fv = reinterpret_cast<PFNUNIFORMMATRIX2X4FV>(IntGetProcAddress("glUniformMatrix2x4fv"));
+		CheckLazyEntryPoint(UniformMatrix2x4fv != 0, "glUniformMatrix2x4fv");
+		return UniformMatrix2x4fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2X4FV UniformMatrix2x4fv = Switch_UniformMatrix2x4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3X2FV UniformMatrix3x2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix3x2fv = reinterpret_cast<PFNUNIFORMMATRIX3X2FV>(IntGetProcAddress("glUniformMatrix3x2fv"));
+		CheckLazyEntryPoint(UniformMatrix3x2fv != 0, "glUniformMatrix3x2fv");
+		return UniformMatrix3x2fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3X2FV UniformMatrix3x2fv = Switch_UniformMatrix3x2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X4FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX3X4FV UniformMatrix3x4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix3x4fv = reinterpret_cast<PFNUNIFORMMATRIX3X4FV>(IntGetProcAddress("glUniformMatrix3x4fv"));
+		CheckLazyEntryPoint(UniformMatrix3x4fv != 0, "glUniformMatrix3x4fv");
+		return UniformMatrix3x4fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3X4FV UniformMatrix3x4fv = Switch_UniformMatrix3x4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X2FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4X2FV UniformMatrix4x2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix4x2fv = reinterpret_cast<PFNUNIFORMMATRIX4X2FV>(IntGetProcAddress("glUniformMatrix4x2fv"));
+		CheckLazyEntryPoint(UniformMatrix4x2fv != 0, "glUniformMatrix4x2fv");
+		return UniformMatrix4x2fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4X2FV UniformMatrix4x2fv = Switch_UniformMatrix4x2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X3FV)(GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNUNIFORMMATRIX4X3FV UniformMatrix4x3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		UniformMatrix4x3fv = reinterpret_cast<PFNUNIFORMMATRIX4X3FV>(IntGetProcAddress("glUniformMatrix4x3fv"));
+		CheckLazyEntryPoint(UniformMatrix4x3fv != 0, "glUniformMatrix4x3fv");
+		return UniformMatrix4x3fv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4X3FV UniformMatrix4x3fv = Switch_UniformMatrix4x3fv;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBEGINCONDITIONALRENDER)(GLuint, GLenum);
-	PFNBEGINCONDITIONALRENDER BeginConditionalRender = 0;
+	static void CODEGEN_FUNCPTR Switch_BeginConditionalRender(GLuint id, GLenum mode)
+	{
+		BeginConditionalRender = reinterpret_cast<PFNBEGINCONDITIONALRENDER>(IntGetProcAddress("glBeginConditionalRender"));
+		CheckLazyEntryPoint(BeginConditionalRender != 0, "glBeginConditionalRender");
+		return BeginConditionalRender(id, mode);
+	}
+	PFNBEGINCONDITIONALRENDER BeginConditionalRender = Switch_BeginConditionalRender;
 	typedef void (CODEGEN_FUNCPTR *PFNBEGINTRANSFORMFEEDBACK)(GLenum);
-	PFNBEGINTRANSFORMFEEDBACK BeginTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_BeginTransformFeedback(GLenum primitiveMode)
+	{
+		BeginTransformFeedback = reinterpret_cast<PFNBEGINTRANSFORMFEEDBACK>(IntGetProcAddress("glBeginTransformFeedback"));
+		CheckLazyEntryPoint(BeginTransformFeedback != 0, "glBeginTransformFeedback");
+		return BeginTransformFeedback(primitiveMode);
+	}
+	PFNBEGINTRANSFORMFEEDBACK BeginTransformFeedback = Switch_BeginTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERBASE)(GLenum, GLuint, GLuint);
-	PFNBINDBUFFERBASE BindBufferBase = 0;
+	static void CODEGEN_FUNCPTR Switch_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+	{
+		BindBufferBase = reinterpret_cast<PFNBINDBUFFERBASE>(IntGetProcAddress("glBindBufferBase"));
+		CheckLazyEntryPoint(BindBufferBase != 0, "glBindBufferBase");
+		return BindBufferBase(target, index, buffer);
+	}
+	PFNBINDBUFFERBASE BindBufferBase = Switch_BindBufferBase;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERRANGE)(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr);
-	PFNBINDBUFFERRANGE BindBufferRange = 0;
+	static void CODEGEN_FUNCPTR Switch_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+	{
+		BindBufferRange = reinterpret_cast<PFNBINDBUFFERRANGE>(IntGetProcAddress("glBindBufferRange"));
+		CheckLazyEntryPoint(BindBufferRange != 0, "glBindBufferRange");
+		return BindBufferRange(target, index, buffer, offset, size);
+	}
+	PFNBINDBUFFERRANGE BindBufferRange = Switch_BindBufferRange;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATION)(GLuint, GLuint, const GLchar *);
-	PFNBINDFRAGDATALOCATION BindFragDataLocation = 0;
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocation(GLuint program, GLuint color, const GLchar * name)
+	{
+		BindFragDataLocation = reinterpret_cast<PFNBINDFRAGDATALOCATION>(IntGetProcAddress("glBindFragDataLocation"));
+		CheckLazyEntryPoint(BindFragDataLocation != 0, "glBindFragDataLocation");
+		return BindFragDataLocation(program, color, name);
+	}
+	PFNBINDFRAGDATALOCATION BindFragDataLocation = Switch_BindFragDataLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAMEBUFFER)(GLenum, GLuint);
-	PFNBINDFRAMEBUFFER BindFramebuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_BindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		BindFramebuffer = reinterpret_cast<PFNBINDFRAMEBUFFER>(IntGetProcAddress("glBindFramebuffer"));
+		CheckLazyEntryPoint(BindFramebuffer != 0, "glBindFramebuffer");
+		return BindFramebuffer(target, framebuffer);
+	}
+	PFNBINDFRAMEBUFFER BindFramebuffer = Switch_BindFramebuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDRENDERBUFFER)(GLenum, GLuint);
-	PFNBINDRENDERBUFFER BindRenderbuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+	{
+		BindRenderbuffer = reinterpret_cast<PFNBINDRENDERBUFFER>(IntGetProcAddress("glBindRenderbuffer"));
+		CheckLazyEntryPoint(BindRenderbuffer != 0, "glBindRenderbuffer");
+		return BindRenderbuffer(target, renderbuffer);
+	}
+	PFNBINDRENDERBUFFER BindRenderbuffer = Switch_BindRenderbuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDVERTEXARRAY)(GLuint);
-	PFNBINDVERTEXARRAY BindVertexArray = 0;
+	static void CODEGEN_FUNCPTR Switch_BindVertexArray(GLuint ren_array)
+	{
+		BindVertexArray = reinterpret_cast<PFNBINDVERTEXARRAY>(IntGetProcAddress("glBindVertexArray"));
+		CheckLazyEntryPoint(BindVertexArray != 0, "glBindVertexArray");
+		return BindVertexArray(ren_array);
+	}
+	PFNBINDVERTEXARRAY BindVertexArray = Switch_BindVertexArray;
 	typedef void (CODEGEN_FUNCPTR *PFNBLITFRAMEBUFFER)(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum);
-	PFNBLITFRAMEBUFFER BlitFramebuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+	{
+		BlitFramebuffer = reinterpret_cast<PFNBLITFRAMEBUFFER>(IntGetProcAddress("glBlitFramebuffer"));
+		CheckLazyEntryPoint(BlitFramebuffer != 0, "glBlitFramebuffer");
+		return BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	}
+	PFNBLITFRAMEBUFFER BlitFramebuffer = Switch_BlitFramebuffer;
 	typedef GLenum (CODEGEN_FUNCPTR *PFNCHECKFRAMEBUFFERSTATUS)(GLenum);
-	PFNCHECKFRAMEBUFFERSTATUS CheckFramebufferStatus = 0;
+	static GLenum CODEGEN_FUNCPTR Switch_CheckFramebufferStatus(GLenum target)
+	{
+		CheckFramebufferStatus = reinterpret_cast<PFNCHECKFRAMEBUFFERSTATUS>(IntGetProcAddress("glCheckFramebufferStatus"));
+		CheckLazyEntryPoint(CheckFramebufferStatus != 0, "glCheckFramebufferStatus");
+		return CheckFramebufferStatus(target);
+	}
+	PFNCHECKFRAMEBUFFERSTATUS CheckFramebufferStatus = Switch_CheckFramebufferStatus;
 	typedef void (CODEGEN_FUNCPTR *PFNCLAMPCOLOR)(GLenum, GLenum);
-	PFNCLAMPCOLOR ClampColor = 0;
+	static void CODEGEN_FUNCPTR Switch_ClampColor(GLenum target, GLenum clamp)
+	{
+		ClampColor = reinterpret_cast<PFNCLAMPCOLOR>(IntGetProcAddress("glClampColor"));
+		CheckLazyEntryPoint(ClampColor != 0, "glClampColor");
+		return ClampColor(target, clamp);
+	}
+	PFNCLAMPCOLOR ClampColor = Switch_ClampColor;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFI)(GLenum, GLint, GLfloat, GLint);
-	PFNCLEARBUFFERFI ClearBufferfi = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+	{
+		ClearBufferfi = reinterpret_cast<PFNCLEARBUFFERFI>(IntGetProcAddress("glClearBufferfi"));
+		CheckLazyEntryPoint(ClearBufferfi != 0, "glClearBufferfi");
+		return ClearBufferfi(buffer, drawbuffer, depth, stencil);
+	}
+	PFNCLEARBUFFERFI ClearBufferfi = Switch_ClearBufferfi;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERFV)(GLenum, GLint, const GLfloat *);
-	PFNCLEARBUFFERFV ClearBufferfv = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value)
+	{
+		ClearBufferfv = reinterpret_cast<PFNCLEARBUFFERFV>(IntGetProcAddress("glClearBufferfv"));
+		CheckLazyEntryPoint(ClearBufferfv != 0, "glClearBufferfv");
+		return ClearBufferfv(buffer, drawbuffer, value);
+	}
+	PFNCLEARBUFFERFV ClearBufferfv = Switch_ClearBufferfv;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERIV)(GLenum, GLint, const GLint *);
-	PFNCLEARBUFFERIV ClearBufferiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value)
+	{
+		ClearBufferiv = reinterpret_cast<PFNCLEARBUFFERIV>(IntGetProcAddress("glClearBufferiv"));
+		CheckLazyEntryPoint(ClearBufferiv != 0, "glClearBufferiv");
+		return ClearBufferiv(buffer, drawbuffer, value);
+	}
+	PFNCLEARBUFFERIV ClearBufferiv = Switch_ClearBufferiv;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERUIV)(GLenum, GLint, const GLuint *);
-	PFNCLEARBUFFERUIV ClearBufferuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value)
+	{
+		ClearBufferuiv = reinterpret_cast<PFNCLEARBUFFERUIV>(IntGetProcAddress("glClearBufferuiv"));
+		CheckLazyEntryPoint(ClearBufferuiv != 0, "glClearBufferuiv");
+		return ClearBufferuiv(buffer, drawbuffer, value);
+	}
+	PFNCLEARBUFFERUIV ClearBufferuiv = Switch_ClearBufferuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNCOLORMASKI)(GLuint, GLboolean, GLboolean, GLboolean, GLboolean);
-	PFNCOLORMASKI ColorMaski = 0;
+	static void CODEGEN_FUNCPTR Switch_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+	{
+		ColorMaski = reinterpret_cast<PFNCOLORMASKI>(IntGetProcAddress("glColorMaski"));
+		CheckLazyEntryPoint(ColorMaski != 0, "glColorMaski");
+		return ColorMaski(index, r, g, b, a);
+	}
+	PFNCOLORMASKI ColorMaski = Switch_ColorMaski;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEFRAMEBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETEFRAMEBUFFERS DeleteFramebuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteFramebuffers(GLsizei n, const GLuint * framebuffers)
+	{
+		DeleteFramebuffers = reinterpret_cast<PFNDELETEFRAMEBUFFERS>(IntGetProcAddress("glDeleteFramebuffers"));
+		CheckLazyEntryPoint(DeleteFramebuffers != 0, "glDeleteFramebuffers");
+		return DeleteFramebuffers(n, framebuffers);
+	}
+	PFNDELETEFRAMEBUFFERS DeleteFramebuffers = Switch_DeleteFramebuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETERENDERBUFFERS)(GLsizei, const GLuint *);
-	PFNDELETERENDERBUFFERS DeleteRenderbuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers)
+	{
+		DeleteRenderbuffers = reinterpret_cast<PFNDELETERENDERBUFFERS>(IntGetProcAddress("glDeleteRenderbuffers"));
+		CheckLazyEntryPoint(DeleteRenderbuffers != 0, "glDeleteRenderbuffers");
+		return DeleteRenderbuffers(n, renderbuffers);
+	}
+	PFNDELETERENDERBUFFERS DeleteRenderbuffers = Switch_DeleteRenderbuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEVERTEXARRAYS)(GLsizei, const GLuint *);
-	PFNDELETEVERTEXARRAYS DeleteVertexArrays = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteVertexArrays(GLsizei n, const GLuint * arrays)
+	{
+		DeleteVertexArrays = reinterpret_cast<PFNDELETEVERTEXARRAYS>(IntGetProcAddress("glDeleteVertexArrays"));
+		CheckLazyEntryPoint(DeleteVertexArrays != 0, "glDeleteVertexArrays");
+		return DeleteVertexArrays(n, arrays);
+	}
+	PFNDELETEVERTEXARRAYS DeleteVertexArrays = Switch_DeleteVertexArrays;
 	typedef void (CODEGEN_FUNCPTR *PFNDISABLEI)(GLenum, GLuint);
-	PFNDISABLEI Disablei = 0;
+	static void CODEGEN_FUNCPTR Switch_Disablei(GLenum target, GLuint index)
+	{
+		Disablei = reinterpret_cast<PFNDISABLEI>(IntGetProcAddress("glDisablei"));
+		CheckLazyEntryPoint(Disablei != 0, "glDisablei");
+		return Disablei(target, index);
+	}
+	PFNDISABLEI Disablei = Switch_Disablei;
 	typedef void (CODEGEN_FUNCPTR *PFNENABLEI)(GLenum, GLuint);
-	PFNENABLEI Enablei = 0;
+	static void CODEGEN_FUNCPTR Switch_Enablei(GLenum target, GLuint index)
+	{
+		Enablei = reinterpret_cast<PFNENABLEI>(IntGetProcAddress("glEnablei"));
+		CheckLazyEntryPoint(Enablei != 0, "glEnablei");
+		return Enablei(target, index);
+	}
+	PFNENABLEI Enablei = Switch_Enablei;
 	typedef void (CODEGEN_FUNCPTR *PFNENDCONDITIONALRENDER)();
-	PFNENDCONDITIONALRENDER EndConditionalRender = 0;
+	static void CODEGEN_FUNCPTR Switch_EndConditionalRender()
+	{
+		EndConditionalRender = reinterpret_cast<PFNENDCONDITIONALRENDER>(IntGetProcAddress("glEndConditionalRender"));
+		CheckLazyEntryPoint(EndConditionalRender != 0, "glEndConditionalRender");
+		return EndConditionalRender();
+	}
+	PFNENDCONDITIONALRENDER EndConditionalRender = Switch_EndConditionalRender;
 	typedef void (CODEGEN_FUNCPTR *PFNENDTRANSFORMFEEDBACK)();
-	PFNENDTRANSFORMFEEDBACK EndTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_EndTransformFeedback()
+	{
+		EndTransformFeedback = reinterpret_cast<PFNENDTRANSFORMFEEDBACK>(IntGetProcAddress("glEndTransformFeedback"));
+		CheckLazyEntryPoint(EndTransformFeedback != 0, "glEndTransformFeedback");
+		return EndTransformFeedback();
+	}
+	PFNENDTRANSFORMFEEDBACK EndTransformFeedback = Switch_EndTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNFLUSHMAPPEDBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr);
-	PFNFLUSHMAPPEDBUFFERRANGE FlushMappedBufferRange = 0;
+	static void CODEGEN_FUNCPTR Switch_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+	{
+		FlushMappedBufferRange = reinterpret_cast<PFNFLUSHMAPPEDBUFFERRANGE>(IntGetProcAddress("glFlushMappedBufferRange"));
+		CheckLazyEntryPoint(FlushMappedBufferRange != 0, "glFlushMappedBufferRange");
+		return FlushMappedBufferRange(target, offset, length);
+	}
+	PFNFLUSHMAPPEDBUFFERRANGE FlushMappedBufferRange = Switch_FlushMappedBufferRange;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERRENDERBUFFER)(GLenum, GLenum, GLenum, GLuint);
-	PFNFRAMEBUFFERRENDERBUFFER FramebufferRenderbuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+	{
+		FramebufferRenderbuffer = reinterpret_cast<PFNFRAMEBUFFERRENDERBUFFER>(IntGetProcAddress("glFramebufferRenderbuffer"));
+		CheckLazyEntryPoint(FramebufferRenderbuffer != 0, "glFramebufferRenderbuffer");
+		return FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	}
+	PFNFRAMEBUFFERRENDERBUFFER FramebufferRenderbuffer = Switch_FramebufferRenderbuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE1D)(GLenum, GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE1D FramebufferTexture1D = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+	{
+		FramebufferTexture1D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE1D>(IntGetProcAddress("glFramebufferTexture1D"));
+		CheckLazyEntryPoint(FramebufferTexture1D != 0, "glFramebufferTexture1D");
+		return FramebufferTexture1D(target, attachment, textarget, texture, level);
+	}
+	PFNFRAMEBUFFERTEXTURE1D FramebufferTexture1D = Switch_FramebufferTexture1D;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE2D)(GLenum, GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE2D FramebufferTexture2D = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+	{
+		FramebufferTexture2D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE2D>(IntGetProcAddress("glFramebufferTexture2D"));
+		CheckLazyEntryPoint(FramebufferTexture2D != 0, "glFramebufferTexture2D");
+		return FramebufferTexture2D(target, attachment, textarget, texture, level);
+	}
+	PFNFRAMEBUFFERTEXTURE2D FramebufferTexture2D = Switch_FramebufferTexture2D;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE3D)(GLenum, GLenum, GLenum, GLuint, GLint, GLint);
-	PFNFRAMEBUFFERTEXTURE3D FramebufferTexture3D = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+	{
+		FramebufferTexture3D = reinterpret_cast<PFNFRAMEBUFFERTEXTURE3D>(IntGetProcAddress("glFramebufferTexture3D"));
+		CheckLazyEntryPoint(FramebufferTexture3D != 0, "glFramebufferTexture3D");
+		return FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	}
+	PFNFRAMEBUFFERTEXTURE3D FramebufferTexture3D = Switch_FramebufferTexture3D;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURELAYER)(GLenum, GLenum, GLuint, GLint, GLint);
-	PFNFRAMEBUFFERTEXTURELAYER FramebufferTextureLayer = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+	{
+		FramebufferTextureLayer = reinterpret_cast<PFNFRAMEBUFFERTEXTURELAYER>(IntGetProcAddress("glFramebufferTextureLayer"));
+		CheckLazyEntryPoint(FramebufferTextureLayer != 0, "glFramebufferTextureLayer");
+		return FramebufferTextureLayer(target, attachment, texture, level, layer);
+	}
+	PFNFRAMEBUFFERTEXTURELAYER FramebufferTextureLayer = Switch_FramebufferTextureLayer;
 	typedef void (CODEGEN_FUNCPTR *PFNGENFRAMEBUFFERS)(GLsizei, GLuint *);
-	PFNGENFRAMEBUFFERS GenFramebuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_GenFramebuffers(GLsizei n, GLuint * framebuffers)
+	{
+		GenFramebuffers = reinterpret_cast<PFNGENFRAMEBUFFERS>(IntGetProcAddress("glGenFramebuffers"));
+		CheckLazyEntryPoint(GenFramebuffers != 0, "glGenFramebuffers");
+		return GenFramebuffers(n, framebuffers);
+	}
+	PFNGENFRAMEBUFFERS GenFramebuffers = Switch_GenFramebuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNGENRENDERBUFFERS)(GLsizei, GLuint *);
-	PFNGENRENDERBUFFERS GenRenderbuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_GenRenderbuffers(GLsizei n, GLuint * renderbuffers)
+	{
+		GenRenderbuffers = reinterpret_cast<PFNGENRENDERBUFFERS>(IntGetProcAddress("glGenRenderbuffers"));
+		CheckLazyEntryPoint(GenRenderbuffers != 0, "glGenRenderbuffers");
+		return GenRenderbuffers(n, renderbuffers);
+	}
+	PFNGENRENDERBUFFERS GenRenderbuffers = Switch_GenRenderbuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNGENVERTEXARRAYS)(GLsizei, GLuint *);
-	PFNGENVERTEXARRAYS GenVertexArrays = 0;
+	static void CODEGEN_FUNCPTR Switch_GenVertexArrays(GLsizei n, GLuint * arrays)
+	{
+		GenVertexArrays = reinterpret_cast<PFNGENVERTEXARRAYS>(IntGetProcAddress("glGenVertexArrays"));
+		CheckLazyEntryPoint(GenVertexArrays != 0, "glGenVertexArrays");
+		return GenVertexArrays(n, arrays);
+	}
+	PFNGENVERTEXARRAYS GenVertexArrays = Switch_GenVertexArrays;
 	typedef void (CODEGEN_FUNCPTR *PFNGENERATEMIPMAP)(GLenum);
-	PFNGENERATEMIPMAP GenerateMipmap = 0;
+	static void CODEGEN_FUNCPTR Switch_GenerateMipmap(GLenum target)
+	{
+		GenerateMipmap = reinterpret_cast<PFNGENERATEMIPMAP>(IntGetProcAddress("glGenerateMipmap"));
+		CheckLazyEntryPoint(GenerateMipmap != 0, "glGenerateMipmap");
+		return GenerateMipmap(target);
+	}
+	PFNGENERATEMIPMAP GenerateMipmap = Switch_GenerateMipmap;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBOOLEANI_V)(GLenum, GLuint, GLboolean *);
-	PFNGETBOOLEANI_V GetBooleani_v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBooleani_v(GLenum target, GLuint index, GLboolean * data)
+	{
+		GetBooleani_v = reinterpret_cast<PFNGETBOOLEANI_V>(IntGetProcAddress("glGetBooleani_v"));
+		CheckLazyEntryPoint(GetBooleani_v != 0, "glGetBooleani_v");
+		return GetBooleani_v(target, index, data);
+	}
+	PFNGETBOOLEANI_V GetBooleani_v = Switch_GetBooleani_v;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATALOCATION)(GLuint, const GLchar *);
-	PFNGETFRAGDATALOCATION GetFragDataLocation = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataLocation(GLuint program, const GLchar * name)
+	{
+		GetFragDataLocation = reinterpret_cast<PFNGETFRAGDATALOCATION>(IntGetProcAddress("glGetFragDataLocation"));
+		CheckLazyEntryPoint(GetFragDataLocation != 0, "glGetFragDataLocation");
+		return GetFragDataLocation(program, name);
+	}
+	PFNGETFRAGDATALOCATION GetFragDataLocation = Switch_GetFragDataLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV)(GLenum, GLenum, GLenum, GLint *);
-	PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV GetFramebufferAttachmentParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+	{
+		GetFramebufferAttachmentParameteriv = reinterpret_cast<PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV>(IntGetProcAddress("glGetFramebufferAttachmentParameteriv"));
+		CheckLazyEntryPoint(GetFramebufferAttachmentParameteriv != 0, "glGetFramebufferAttachmentParameteriv");
+		return GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	}
+	PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV GetFramebufferAttachmentParameteriv = Switch_GetFramebufferAttachmentParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGERI_V)(GLenum, GLuint, GLint *);
-	PFNGETINTEGERI_V GetIntegeri_v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetIntegeri_v(GLenum target, GLuint index, GLint * data)
+	{
+		GetIntegeri_v = reinterpret_cast<PFNGETINTEGERI_V>(IntGetProcAddress("glGetIntegeri_v"));
+		CheckLazyEntryPoint(GetIntegeri_v != 0, "glGetIntegeri_v");
+		return GetIntegeri_v(target, index, data);
+	}
+	PFNGETINTEGERI_V GetIntegeri_v = Switch_GetIntegeri_v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETRENDERBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETRENDERBUFFERPARAMETERIV GetRenderbufferParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetRenderbufferParameteriv = reinterpret_cast<PFNGETRENDERBUFFERPARAMETERIV>(IntGetProcAddress("glGetRenderbufferParameteriv"));
+		CheckLazyEntryPoint(GetRenderbufferParameteriv != 0, "glGetRenderbufferParameteriv");
+		return GetRenderbufferParameteriv(target, pname, params);
+	}
+	PFNGETRENDERBUFFERPARAMETERIV GetRenderbufferParameteriv = Switch_GetRenderbufferParameteriv;
 	typedef const GLubyte * (CODEGEN_FUNCPTR *PFNGETSTRINGI)(GLenum, GLuint);
-	PFNGETSTRINGI GetStringi = 0;
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetStringi(GLenum name, GLuint index)
+	{
+		GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
+		CheckLazyEntryPoint(GetStringi != 0, "glGetStringi");
+		return GetStringi(name, index);
+	}
+	PFNGETSTRINGI GetStringi = Switch_GetStringi;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIIV)(GLenum, GLenum, GLint *);
-	PFNGETTEXPARAMETERIIV GetTexParameterIiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIiv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetTexParameterIiv = reinterpret_cast<PFNGETTEXPARAMETERIIV>(IntGetProcAddress("glGetTexParameterIiv"));
+		CheckLazyEntryPoint(GetTexParameterIiv != 0, "glGetTexParameterIiv");
+		return GetTexParameterIiv(target, pname, params);
+	}
+	PFNGETTEXPARAMETERIIV GetTexParameterIiv = Switch_GetTexParameterIiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTEXPARAMETERIUIV)(GLenum, GLenum, GLuint *);
-	PFNGETTEXPARAMETERIUIV GetTexParameterIuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params)
+	{
+		GetTexParameterIuiv = reinterpret_cast<PFNGETTEXPARAMETERIUIV>(IntGetProcAddress("glGetTexParameterIuiv"));
+		CheckLazyEntryPoint(GetTexParameterIuiv != 0, "glGetTexParameterIuiv");
+		return GetTexParameterIuiv(target, pname, params);
+	}
+	PFNGETTEXPARAMETERIUIV GetTexParameterIuiv = Switch_GetTexParameterIuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETTRANSFORMFEEDBACKVARYING)(GLuint, GLuint, GLsizei, GLsizei *, GLsizei *, GLenum *, GLchar *);
-	PFNGETTRANSFORMFEEDBACKVARYING GetTransformFeedbackVarying = 0;
+	static void CODEGEN_FUNCPTR Switch_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+	{
+		GetTransformFeedbackVarying = reinterpret_cast<PFNGETTRANSFORMFEEDBACKVARYING>(IntGetProcAddress("glGetTransformFeedbackVarying"));
+		CheckLazyEntryPoint(GetTransformFeedbackVarying != 0, "glGetTransformFeedbackVarying");
+		return GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	}
+	PFNGETTRANSFORMFEEDBACKVARYING GetTransformFeedbackVarying = Switch_GetTransformFeedbackVarying;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMUIV)(GLuint, GLint, GLuint *);
-	PFNGETUNIFORMUIV GetUniformuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformuiv(GLuint program, GLint location, GLuint * params)
+	{
+		GetUniformuiv = reinterpret_cast<PFNGETUNIFORMUIV>(IntGetProcAddress("glGetUniformuiv"));
+		CheckLazyEntryPoint(GetUniformuiv != 0, "glGetUniformuiv");
+		return GetUniformuiv(program, location, params);
+	}
+	PFNGETUNIFORMUIV GetUniformuiv = Switch_GetUniformuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIIV)(GLuint, GLenum, GLint *);
-	PFNGETVERTEXATTRIBIIV GetVertexAttribIiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIiv(GLuint index, GLenum pname, GLint * params)
+	{
+		GetVertexAttribIiv = reinterpret_cast<PFNGETVERTEXATTRIBIIV>(IntGetProcAddress("glGetVertexAttribIiv"));
+		CheckLazyEntryPoint(GetVertexAttribIiv != 0, "glGetVertexAttribIiv");
+		return GetVertexAttribIiv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBIIV GetVertexAttribIiv = Switch_GetVertexAttribIiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBIUIV)(GLuint, GLenum, GLuint *);
-	PFNGETVERTEXATTRIBIUIV GetVertexAttribIuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params)
+	{
+		GetVertexAttribIuiv = reinterpret_cast<PFNGETVERTEXATTRIBIUIV>(IntGetProcAddress("glGetVertexAttribIuiv"));
+		CheckLazyEntryPoint(GetVertexAttribIuiv != 0, "glGetVertexAttribIuiv");
+		return GetVertexAttribIuiv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBIUIV GetVertexAttribIuiv = Switch_GetVertexAttribIuiv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISENABLEDI)(GLenum, GLuint);
-	PFNISENABLEDI IsEnabledi = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabledi(GLenum target, GLuint index)
+	{
+		IsEnabledi = reinterpret_cast<PFNISENABLEDI>(IntGetProcAddress("glIsEnabledi"));
+		CheckLazyEntryPoint(IsEnabledi != 0, "glIsEnabledi");
+		return IsEnabledi(target, index);
+	}
+	PFNISENABLEDI IsEnabledi = Switch_IsEnabledi;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISFRAMEBUFFER)(GLuint);
-	PFNISFRAMEBUFFER IsFramebuffer = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsFramebuffer(GLuint framebuffer)
+	{
+		IsFramebuffer = reinterpret_cast<PFNISFRAMEBUFFER>(IntGetProcAddress("glIsFramebuffer"));
+		CheckLazyEntryPoint(IsFramebuffer != 0, "glIsFramebuffer");
+		return IsFramebuffer(framebuffer);
+	}
+	PFNISFRAMEBUFFER IsFramebuffer = Switch_IsFramebuffer;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISRENDERBUFFER)(GLuint);
-	PFNISRENDERBUFFER IsRenderbuffer = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsRenderbuffer(GLuint renderbuffer)
+	{
+		IsRenderbuffer = reinterpret_cast<PFNISRENDERBUFFER>(IntGetProcAddress("glIsRenderbuffer"));
+		CheckLazyEntryPoint(IsRenderbuffer != 0, "glIsRenderbuffer");
+		return IsRenderbuffer(renderbuffer);
+	}
+	PFNISRENDERBUFFER IsRenderbuffer = Switch_IsRenderbuffer;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISVERTEXARRAY)(GLuint);
-	PFNISVERTEXARRAY IsVertexArray = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsVertexArray(GLuint ren_array)
+	{
+		IsVertexArray = reinterpret_cast<PFNISVERTEXARRAY>(IntGetProcAddress("glIsVertexArray"));
+		CheckLazyEntryPoint(IsVertexArray != 0, "glIsVertexArray");
+		return IsVertexArray(ren_array);
+	}
+	PFNISVERTEXARRAY IsVertexArray = Switch_IsVertexArray;
 	typedef void * (CODEGEN_FUNCPTR *PFNMAPBUFFERRANGE)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
-	PFNMAPBUFFERRANGE MapBufferRange = 0;
+	static void * CODEGEN_FUNCPTR Switch_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		MapBufferRange = reinterpret_cast<PFNMAPBUFFERRANGE>(IntGetProcAddress("glMapBufferRange"));
+		CheckLazyEntryPoint(MapBufferRange != 0, "glMapBufferRange");
+		return MapBufferRange(target, offset, length, access);
+	}
+	PFNMAPBUFFERRANGE MapBufferRange = Switch_MapBufferRange;
 	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGE)(GLenum, GLenum, GLsizei, GLsizei);
-	PFNRENDERBUFFERSTORAGE RenderbufferStorage = 0;
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+	{
+		RenderbufferStorage = reinterpret_cast<PFNRENDERBUFFERSTORAGE>(IntGetProcAddress("glRenderbufferStorage"));
+		CheckLazyEntryPoint(RenderbufferStorage != 0, "glRenderbufferStorage");
+		return RenderbufferStorage(target, internalformat, width, height);
+	}
+	PFNRENDERBUFFERSTORAGE RenderbufferStorage = Switch_RenderbufferStorage;
 	typedef void (CODEGEN_FUNCPTR *PFNRENDERBUFFERSTORAGEMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei);
-	PFNRENDERBUFFERSTORAGEMULTISAMPLE RenderbufferStorageMultisample = 0;
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+	{
+		RenderbufferStorageMultisample = reinterpret_cast<PFNRENDERBUFFERSTORAGEMULTISAMPLE>(IntGetProcAddress("glRenderbufferStorageMultisample"));
+		CheckLazyEntryPoint(RenderbufferStorageMultisample != 0, "glRenderbufferStorageMultisample");
+		return RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	}
+	PFNRENDERBUFFERSTORAGEMULTISAMPLE RenderbufferStorageMultisample = Switch_RenderbufferStorageMultisample;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIIV)(GLenum, GLenum, const GLint *);
-	PFNTEXPARAMETERIIV TexParameterIiv = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameterIiv(GLenum target, GLenum pname, const GLint * params)
+	{
+		TexParameterIiv = reinterpret_cast<PFNTEXPARAMETERIIV>(IntGetProcAddress("glTexParameterIiv"));
+		CheckLazyEntryPoint(TexParameterIiv != 0, "glTexParameterIiv");
+		return TexParameterIiv(target, pname, params);
+	}
+	PFNTEXPARAMETERIIV TexParameterIiv = Switch_TexParameterIiv;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXPARAMETERIUIV)(GLenum, GLenum, const GLuint *);
-	PFNTEXPARAMETERIUIV TexParameterIuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_TexParameterIuiv(GLenum target, GLenum pname, const GLuint * params)
+	{
+		TexParameterIuiv = reinterpret_cast<PFNTEXPARAMETERIUIV>(IntGetProcAddress("glTexParameterIuiv"));
+		CheckLazyEntryPoint(TexParameterIuiv != 0, "glTexParameterIuiv");
+		return TexParameterIuiv(target, pname, params);
+	}
+	PFNTEXPARAMETERIUIV TexParameterIuiv = Switch_TexParameterIuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNTRANSFORMFEEDBACKVARYINGS)(GLuint, GLsizei, const GLchar *const*, GLenum);
-	PFNTRANSFORMFEEDBACKVARYINGS TransformFeedbackVaryings = 0;
+	static void CODEGEN_FUNCPTR Switch_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode)
+	{
+		TransformFeedbackVaryings = reinterpret_cast<PFNTRANSFORMFEEDBACKVARYINGS>(IntGetProcAddress("glTransformFeedbackVaryings"));
+		CheckLazyEntryPoint(TransformFeedbackVaryings != 0, "glTransformFeedbackVaryings");
+		return TransformFeedbackVaryings(program, count, varyings, bufferMode);
+	}
+	PFNTRANSFORMFEEDBACKVARYINGS TransformFeedbackVaryings = Switch_TransformFeedbackVaryings;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UI)(GLint, GLuint);
-	PFNUNIFORM1UI Uniform1ui = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1ui(GLint location, GLuint v0)
+	{
+		Uniform1ui = reinterpret_cast<PFNUNIFORM1UI>(IntGetProcAddress("glUniform1ui"));
+		CheckLazyEntryPoint(Uniform1ui != 0, "glUniform1ui");
+		return Uniform1ui(location, v0);
+	}
+	PFNUNIFORM1UI Uniform1ui = Switch_Uniform1ui;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM1UIV Uniform1uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1uiv(GLint location, GLsizei count, const GLuint * value)
+	{
+		Uniform1uiv = reinterpret_cast<PFNUNIFORM1UIV>(IntGetProcAddress("glUniform1uiv"));
+		CheckLazyEntryPoint(Uniform1uiv != 0, "glUniform1uiv");
+		return Uniform1uiv(location, count, value);
+	}
+	PFNUNIFORM1UIV Uniform1uiv = Switch_Uniform1uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UI)(GLint, GLuint, GLuint);
-	PFNUNIFORM2UI Uniform2ui = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2ui(GLint location, GLuint v0, GLuint v1)
+	{
+		Uniform2ui = reinterpret_cast<PFNUNIFORM2UI>(IntGetProcAddress("glUniform2ui"));
+		CheckLazyEntryPoint(Uniform2ui != 0, "glUniform2ui");
+		return Uniform2ui(location, v0, v1);
+	}
+	PFNUNIFORM2UI Uniform2ui = Switch_Uniform2ui;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM2UIV Uniform2uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2uiv(GLint location, GLsizei count, const GLuint * value)
+	{
+		Uniform2uiv = reinterpret_cast<PFNUNIFORM2UIV>(IntGetProcAddress("glUniform2uiv"));
+		CheckLazyEntryPoint(Uniform2uiv != 0, "glUniform2uiv");
+		return Uniform2uiv(location, count, value);
+	}
+	PFNUNIFORM2UIV Uniform2uiv = Switch_Uniform2uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UI)(GLint, GLuint, GLuint, GLuint);
-	PFNUNIFORM3UI Uniform3ui = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+	{
+		Uniform3ui = reinterpret_cast<PFNUNIFORM3UI>(IntGetProcAddress("glUniform3ui"));
+		CheckLazyEntryPoint(Uniform3ui != 0, "glUniform3ui");
+		return Uniform3ui(location, v0, v1, v2);
+	}
+	PFNUNIFORM3UI Uniform3ui = Switch_Uniform3ui;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM3UIV Uniform3uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3uiv(GLint location, GLsizei count, const GLuint * value)
+	{
+		Uniform3uiv = reinterpret_cast<PFNUNIFORM3UIV>(IntGetProcAddress("glUniform3uiv"));
+		CheckLazyEntryPoint(Uniform3uiv != 0, "glUniform3uiv");
+		return Uniform3uiv(location, count, value);
+	}
+	PFNUNIFORM3UIV Uniform3uiv = Switch_Uniform3uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UI)(GLint, GLuint, GLuint, GLuint, GLuint);
-	PFNUNIFORM4UI Uniform4ui = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+	{
+		Uniform4ui = reinterpret_cast<PFNUNIFORM4UI>(IntGetProcAddress("glUniform4ui"));
+		CheckLazyEntryPoint(Uniform4ui != 0, "glUniform4ui");
+		return Uniform4ui(location, v0, v1, v2, v3);
+	}
+	PFNUNIFORM4UI Uniform4ui = Switch_Uniform4ui;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4UIV)(GLint, GLsizei, const GLuint *);
-	PFNUNIFORM4UIV Uniform4uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4uiv(GLint location, GLsizei count, const GLuint * value)
+	{
+		Uniform4uiv = reinterpret_cast<PFNUNIFORM4UIV>(IntGetProcAddress("glUniform4uiv"));
+		CheckLazyEntryPoint(Uniform4uiv != 0, "glUniform4uiv");
+		return Uniform4uiv(location, count, value);
+	}
+	PFNUNIFORM4UIV Uniform4uiv = Switch_Uniform4uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1I)(GLuint, GLint);
-	PFNVERTEXATTRIBI1I VertexAttribI1i = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1i(GLuint index, GLint x)
+	{
+		VertexAttribI1i = reinterpret_cast<PFNVERTEXATTRIBI1I>(IntGetProcAddress("glVertexAttribI1i"));
+		CheckLazyEntryPoint(VertexAttribI1i != 0, "glVertexAttribI1i");
+		return VertexAttribI1i(index, x);
+	}
+	PFNVERTEXATTRIBI1I VertexAttribI1i = Switch_VertexAttribI1i;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI1IV VertexAttribI1iv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1iv(GLuint index, const GLint * v)
+	{
+		VertexAttribI1iv = reinterpret_cast<PFNVERTEXATTRIBI1IV>(IntGetProcAddress("glVertexAttribI1iv"));
+		CheckLazyEntryPoint(VertexAttribI1iv != 0, "glVertexAttribI1iv");
+		return VertexAttribI1iv(index, v);
+	}
+	PFNVERTEXATTRIBI1IV VertexAttribI1iv = Switch_VertexAttribI1iv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UI)(GLuint, GLuint);
-	PFNVERTEXATTRIBI1UI VertexAttribI1ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1ui(GLuint index, GLuint x)
+	{
+		VertexAttribI1ui = reinterpret_cast<PFNVERTEXATTRIBI1UI>(IntGetProcAddress("glVertexAttribI1ui"));
+		CheckLazyEntryPoint(VertexAttribI1ui != 0, "glVertexAttribI1ui");
+		return VertexAttribI1ui(index, x);
+	}
+	PFNVERTEXATTRIBI1UI VertexAttribI1ui = Switch_VertexAttribI1ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI1UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI1UIV VertexAttribI1uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1uiv(GLuint index, const GLuint * v)
+	{
+		VertexAttribI1uiv = reinterpret_cast<PFNVERTEXATTRIBI1UIV>(IntGetProcAddress("glVertexAttribI1uiv"));
+		CheckLazyEntryPoint(VertexAttribI1uiv != 0, "glVertexAttribI1uiv");
+		return VertexAttribI1uiv(index, v);
+	}
+	PFNVERTEXATTRIBI1UIV VertexAttribI1uiv = Switch_VertexAttribI1uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2I)(GLuint, GLint, GLint);
-	PFNVERTEXATTRIBI2I VertexAttribI2i = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2i(GLuint index, GLint x, GLint y)
+	{
+		VertexAttribI2i = reinterpret_cast<PFNVERTEXATTRIBI2I>(IntGetProcAddress("glVertexAttribI2i"));
+		CheckLazyEntryPoint(VertexAttribI2i != 0, "glVertexAttribI2i");
+		return VertexAttribI2i(index, x, y);
+	}
+	PFNVERTEXATTRIBI2I VertexAttribI2i = Switch_VertexAttribI2i;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI2IV VertexAttribI2iv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2iv(GLuint index, const GLint * v)
+	{
+		VertexAttribI2iv = reinterpret_cast<PFNVERTEXATTRIBI2IV>(IntGetProcAddress("glVertexAttribI2iv"));
+		CheckLazyEntryPoint(VertexAttribI2iv != 0, "glVertexAttribI2iv");
+		return VertexAttribI2iv(index, v);
+	}
+	PFNVERTEXATTRIBI2IV VertexAttribI2iv = Switch_VertexAttribI2iv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UI)(GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI2UI VertexAttribI2ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+	{
+		VertexAttribI2ui = reinterpret_cast<PFNVERTEXATTRIBI2UI>(IntGetProcAddress("glVertexAttribI2ui"));
+		CheckLazyEntryPoint(VertexAttribI2ui != 0, "glVertexAttribI2ui");
+		return VertexAttribI2ui(index, x, y);
+	}
+	PFNVERTEXATTRIBI2UI VertexAttribI2ui = Switch_VertexAttribI2ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI2UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI2UIV VertexAttribI2uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2uiv(GLuint index, const GLuint * v)
+	{
+		VertexAttribI2uiv = reinterpret_cast<PFNVERTEXATTRIBI2UIV>(IntGetProcAddress("glVertexAttribI2uiv"));
+		CheckLazyEntryPoint(VertexAttribI2uiv != 0, "glVertexAttribI2uiv");
+		return VertexAttribI2uiv(index, v);
+	}
+	PFNVERTEXATTRIBI2UIV VertexAttribI2uiv = Switch_VertexAttribI2uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3I)(GLuint, GLint, GLint, GLint);
-	PFNVERTEXATTRIBI3I VertexAttribI3i = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+	{
+		VertexAttribI3i = reinterpret_cast<PFNVERTEXATTRIBI3I>(IntGetProcAddress("glVertexAttribI3i"));
+		CheckLazyEntryPoint(VertexAttribI3i != 0, "glVertexAttribI3i");
+		return VertexAttribI3i(index, x, y, z);
+	}
+	PFNVERTEXATTRIBI3I VertexAttribI3i = Switch_VertexAttribI3i;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI3IV VertexAttribI3iv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3iv(GLuint index, const GLint * v)
+	{
+		VertexAttribI3iv = reinterpret_cast<PFNVERTEXATTRIBI3IV>(IntGetProcAddress("glVertexAttribI3iv"));
+		CheckLazyEntryPoint(VertexAttribI3iv != 0, "glVertexAttribI3iv");
+		return VertexAttribI3iv(index, v);
+	}
+	PFNVERTEXATTRIBI3IV VertexAttribI3iv = Switch_VertexAttribI3iv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UI)(GLuint, GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI3UI VertexAttribI3ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+	{
+		VertexAttribI3ui = reinterpret_cast<PFNVERTEXATTRIBI3UI>(IntGetProcAddress("glVertexAttribI3ui"));
+		CheckLazyEntryPoint(VertexAttribI3ui != 0, "glVertexAttribI3ui");
+		return VertexAttribI3ui(index, x, y, z);
+	}
+	PFNVERTEXATTRIBI3UI VertexAttribI3ui = Switch_VertexAttribI3ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI3UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI3UIV VertexAttribI3uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3uiv(GLuint index, const GLuint * v)
+	{
+		VertexAttribI3uiv = reinterpret_cast<PFNVERTEXATTRIBI3UIV>(IntGetProcAddress("glVertexAttribI3uiv"));
+		CheckLazyEntryPoint(VertexAttribI3uiv != 0, "glVertexAttribI3uiv");
+		return VertexAttribI3uiv(index, v);
+	}
+	PFNVERTEXATTRIBI3UIV VertexAttribI3uiv = Switch_VertexAttribI3uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4BV)(GLuint, const GLbyte *);
-	PFNVERTEXATTRIBI4BV VertexAttribI4bv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4bv(GLuint index, const GLbyte * v)
+	{
+		VertexAttribI4bv = reinterpret_cast<PFNVERTEXATTRIBI4BV>(IntGetProcAddress("glVertexAttribI4bv"));
+		CheckLazyEntryPoint(VertexAttribI4bv != 0, "glVertexAttribI4bv");
+		return VertexAttribI4bv(index, v);
+	}
+	PFNVERTEXATTRIBI4BV VertexAttribI4bv = Switch_VertexAttribI4bv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4I)(GLuint, GLint, GLint, GLint, GLint);
-	PFNVERTEXATTRIBI4I VertexAttribI4i = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+	{
+		VertexAttribI4i = reinterpret_cast<PFNVERTEXATTRIBI4I>(IntGetProcAddress("glVertexAttribI4i"));
+		CheckLazyEntryPoint(VertexAttribI4i != 0, "glVertexAttribI4i");
+		return VertexAttribI4i(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIBI4I VertexAttribI4i = Switch_VertexAttribI4i;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4IV)(GLuint, const GLint *);
-	PFNVERTEXATTRIBI4IV VertexAttribI4iv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4iv(GLuint index, const GLint * v)
+	{
+		VertexAttribI4iv = reinterpret_cast<PFNVERTEXATTRIBI4IV>(IntGetProcAddress("glVertexAttribI4iv"));
+		CheckLazyEntryPoint(VertexAttribI4iv != 0, "glVertexAttribI4iv");
+		return VertexAttribI4iv(index, v);
+	}
+	PFNVERTEXATTRIBI4IV VertexAttribI4iv = Switch_VertexAttribI4iv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4SV)(GLuint, const GLshort *);
-	PFNVERTEXATTRIBI4SV VertexAttribI4sv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4sv(GLuint index, const GLshort * v)
+	{
+		VertexAttribI4sv = reinterpret_cast<PFNVERTEXATTRIBI4SV>(IntGetProcAddress("glVertexAttribI4sv"));
+		CheckLazyEntryPoint(VertexAttribI4sv != 0, "glVertexAttribI4sv");
+		return VertexAttribI4sv(index, v);
+	}
+	PFNVERTEXATTRIBI4SV VertexAttribI4sv = Switch_VertexAttribI4sv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UBV)(GLuint, const GLubyte *);
-	PFNVERTEXATTRIBI4UBV VertexAttribI4ubv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ubv(GLuint index, const GLubyte * v)
+	{
+		VertexAttribI4ubv = reinterpret_cast<PFNVERTEXATTRIBI4UBV>(IntGetProcAddress("glVertexAttribI4ubv"));
+		CheckLazyEntryPoint(VertexAttribI4ubv != 0, "glVertexAttribI4ubv");
+		return VertexAttribI4ubv(index, v);
+	}
+	PFNVERTEXATTRIBI4UBV VertexAttribI4ubv = Switch_VertexAttribI4ubv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UI)(GLuint, GLuint, GLuint, GLuint, GLuint);
-	PFNVERTEXATTRIBI4UI VertexAttribI4ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+	{
+		VertexAttribI4ui = reinterpret_cast<PFNVERTEXATTRIBI4UI>(IntGetProcAddress("glVertexAttribI4ui"));
+		CheckLazyEntryPoint(VertexAttribI4ui != 0, "glVertexAttribI4ui");
+		return VertexAttribI4ui(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIBI4UI VertexAttribI4ui = Switch_VertexAttribI4ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4UIV)(GLuint, const GLuint *);
-	PFNVERTEXATTRIBI4UIV VertexAttribI4uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4uiv(GLuint index, const GLuint * v)
+	{
+		VertexAttribI4uiv = reinterpret_cast<PFNVERTEXATTRIBI4UIV>(IntGetProcAddress("glVertexAttribI4uiv"));
+		CheckLazyEntryPoint(VertexAttribI4uiv != 0, "glVertexAttribI4uiv");
+		return VertexAttribI4uiv(index, v);
+	}
+	PFNVERTEXATTRIBI4UIV VertexAttribI4uiv = Switch_VertexAttribI4uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBI4USV)(GLuint, const GLushort *);
-	PFNVERTEXATTRIBI4USV VertexAttribI4usv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4usv(GLuint index, const GLushort * v)
+	{
+		VertexAttribI4usv = reinterpret_cast<PFNVERTEXATTRIBI4USV>(IntGetProcAddress("glVertexAttribI4usv"));
+		CheckLazyEntryPoint(VertexAttribI4usv != 0, "glVertexAttribI4usv");
+		return VertexAttribI4usv(index, v);
+	}
+	PFNVERTEXATTRIBI4USV VertexAttribI4usv = Switch_VertexAttribI4usv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBIPOINTER)(GLuint, GLint, GLenum, GLsizei, const void *);
-	PFNVERTEXATTRIBIPOINTER VertexAttribIPointer = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+	{
+		VertexAttribIPointer = reinterpret_cast<PFNVERTEXATTRIBIPOINTER>(IntGetProcAddress("glVertexAttribIPointer"));
+		CheckLazyEntryPoint(VertexAttribIPointer != 0, "glVertexAttribIPointer");
+		return VertexAttribIPointer(index, size, type, stride, pointer);
+	}
+	PFNVERTEXATTRIBIPOINTER VertexAttribIPointer = Switch_VertexAttribIPointer;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYBUFFERSUBDATA)(GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr);
-	PFNCOPYBUFFERSUBDATA CopyBufferSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+	{
+		CopyBufferSubData = reinterpret_cast<PFNCOPYBUFFERSUBDATA>(IntGetProcAddress("glCopyBufferSubData"));
+		CheckLazyEntryPoint(CopyBufferSubData != 0, "glCopyBufferSubData");
+		return CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	}
+	PFNCOPYBUFFERSUBDATA CopyBufferSubData = Switch_CopyBufferSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYSINSTANCED)(GLenum, GLint, GLsizei, GLsizei);
-	PFNDRAWARRAYSINSTANCED DrawArraysInstanced = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+	{
+		DrawArraysInstanced = reinterpret_cast<PFNDRAWARRAYSINSTANCED>(IntGetProcAddress("glDrawArraysInstanced"));
+		CheckLazyEntryPoint(DrawArraysInstanced != 0, "glDrawArraysInstanced");
+		return DrawArraysInstanced(mode, first, count, instancecount);
+	}
+	PFNDRAWARRAYSINSTANCED DrawArraysInstanced = Switch_DrawArraysInstanced;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCED)(GLenum, GLsizei, GLenum, const void *, GLsizei);
-	PFNDRAWELEMENTSINSTANCED DrawElementsInstanced = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)
+	{
+		DrawElementsInstanced = reinterpret_cast<PFNDRAWELEMENTSINSTANCED>(IntGetProcAddress("glDrawElementsInstanced"));
+		CheckLazyEntryPoint(DrawElementsInstanced != 0, "glDrawElementsInstanced");
+		return DrawElementsInstanced(mode, count, type, indices, instancecount);
+	}
+	PFNDRAWELEMENTSINSTANCED DrawElementsInstanced = Switch_DrawElementsInstanced;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVEUNIFORMBLOCKNAME GetActiveUniformBlockName = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName)
+	{
+		GetActiveUniformBlockName = reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKNAME>(IntGetProcAddress("glGetActiveUniformBlockName"));
+		CheckLazyEntryPoint(GetActiveUniformBlockName != 0, "glGetActiveUniformBlockName");
+		return GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	}
+	PFNGETACTIVEUNIFORMBLOCKNAME GetActiveUniformBlockName = Switch_GetActiveUniformBlockName;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMBLOCKIV)(GLuint, GLuint, GLenum, GLint *);
-	PFNGETACTIVEUNIFORMBLOCKIV GetActiveUniformBlockiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params)
+	{
+		GetActiveUniformBlockiv = reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKIV>(IntGetProcAddress("glGetActiveUniformBlockiv"));
+		CheckLazyEntryPoint(GetActiveUniformBlockiv != 0, "glGetActiveUniformBlockiv");
+		return GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	}
+	PFNGETACTIVEUNIFORMBLOCKIV GetActiveUniformBlockiv = Switch_GetActiveUniformBlockiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMNAME)(GLuint, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVEUNIFORMNAME GetActiveUniformName = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName)
+	{
+		GetActiveUniformName = reinterpret_cast<PFNGETACTIVEUNIFORMNAME>(IntGetProcAddress("glGetActiveUniformName"));
+		CheckLazyEntryPoint(GetActiveUniformName != 0, "glGetActiveUniformName");
+		return GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	}
+	PFNGETACTIVEUNIFORMNAME GetActiveUniformName = Switch_GetActiveUniformName;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEUNIFORMSIV)(GLuint, GLsizei, const GLuint *, GLenum, GLint *);
-	PFNGETACTIVEUNIFORMSIV GetActiveUniformsiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params)
+	{
+		GetActiveUniformsiv = reinterpret_cast<PFNGETACTIVEUNIFORMSIV>(IntGetProcAddress("glGetActiveUniformsiv"));
+		CheckLazyEntryPoint(GetActiveUniformsiv != 0, "glGetActiveUniformsiv");
+		return GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	}
+	PFNGETACTIVEUNIFORMSIV GetActiveUniformsiv = Switch_GetActiveUniformsiv;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNGETUNIFORMBLOCKINDEX)(GLuint, const GLchar *);
-	PFNGETUNIFORMBLOCKINDEX GetUniformBlockIndex = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_GetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName)
+	{
+		GetUniformBlockIndex = reinterpret_cast<PFNGETUNIFORMBLOCKINDEX>(IntGetProcAddress("glGetUniformBlockIndex"));
+		CheckLazyEntryPoint(GetUniformBlockIndex != 0, "glGetUniformBlockIndex");
+		return GetUniformBlockIndex(program, uniformBlockName);
+	}
+	PFNGETUNIFORMBLOCKINDEX GetUniformBlockIndex = Switch_GetUniformBlockIndex;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMINDICES)(GLuint, GLsizei, const GLchar *const*, GLuint *);
-	PFNGETUNIFORMINDICES GetUniformIndices = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices)
+	{
+		GetUniformIndices = reinterpret_cast<PFNGETUNIFORMINDICES>(IntGetProcAddress("glGetUniformIndices"));
+		CheckLazyEntryPoint(GetUniformIndices != 0, "glGetUniformIndices");
+		return GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	}
+	PFNGETUNIFORMINDICES GetUniformIndices = Switch_GetUniformIndices;
 	typedef void (CODEGEN_FUNCPTR *PFNPRIMITIVERESTARTINDEX)(GLuint);
-	PFNPRIMITIVERESTARTINDEX PrimitiveRestartIndex = 0;
+	static void CODEGEN_FUNCPTR Switch_PrimitiveRestartIndex(GLuint index)
+	{
+		PrimitiveRestartIndex = reinterpret_cast<PFNPRIMITIVERESTARTINDEX>(IntGetProcAddress("glPrimitiveRestartIndex"));
+		CheckLazyEntryPoint(PrimitiveRestartIndex != 0, "glPrimitiveRestartIndex");
+		return PrimitiveRestartIndex(index);
+	}
+	PFNPRIMITIVERESTARTINDEX PrimitiveRestartIndex = Switch_PrimitiveRestartIndex;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXBUFFER)(GLenum, GLenum, GLuint);
-	PFNTEXBUFFER TexBuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+	{
+		TexBuffer = reinterpret_cast<PFNTEXBUFFER>(IntGetProcAddress("glTexBuffer"));
+		CheckLazyEntryPoint(TexBuffer != 0, "glTexBuffer");
+		return TexBuffer(target, internalformat, buffer);
+	}
+	PFNTEXBUFFER TexBuffer = Switch_TexBuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMBLOCKBINDING)(GLuint, GLuint, GLuint);
-	PFNUNIFORMBLOCKBINDING UniformBlockBinding = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+	{
+		UniformBlockBinding = reinterpret_cast<PFNUNIFORMBLOCKBINDING>(IntGetProcAddress("glUniformBlockBinding"));
+		CheckLazyEntryPoint(UniformBlockBinding != 0, "glUniformBlockBinding");
+		return UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	}
+	PFNUNIFORMBLOCKBINDING UniformBlockBinding = Switch_UniformBlockBinding;
 	
 	typedef GLenum (CODEGEN_FUNCPTR *PFNCLIENTWAITSYNC)(GLsync, GLbitfield, GLuint64);
-	PFNCLIENTWAITSYNC ClientWaitSync = 0;
+	static GLenum CODEGEN_FUNCPTR Switch_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+	{
+		ClientWaitSync = reinterpret_cast<PFNCLIENTWAITSYNC>(IntGetProcAddress("glClientWaitSync"));
+		CheckLazyEntryPoint(ClientWaitSync != 0, "glClientWaitSync");
+		return ClientWaitSync(sync, flags, timeout);
+	}
+	PFNCLIENTWAITSYNC ClientWaitSync = Switch_ClientWaitSync;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETESYNC)(GLsync);
-	PFNDELETESYNC DeleteSync = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteSync(GLsync sync)
+	{
+		DeleteSync = reinterpret_cast<PFNDELETESYNC>(IntGetProcAddress("glDeleteSync"));
+		CheckLazyEntryPoint(DeleteSync != 0, "glDeleteSync");
+		return DeleteSync(sync);
+	}
+	PFNDELETESYNC DeleteSync = Switch_DeleteSync;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLint);
-	PFNDRAWELEMENTSBASEVERTEX DrawElementsBaseVertex = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+	{
+		DrawElementsBaseVertex = reinterpret_cast<PFNDRAWELEMENTSBASEVERTEX>(IntGetProcAddress("glDrawElementsBaseVertex"));
+		CheckLazyEntryPoint(DrawElementsBaseVertex != 0, "glDrawElementsBaseVertex");
+		return DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	}
+	PFNDRAWELEMENTSBASEVERTEX DrawElementsBaseVertex = Switch_DrawElementsBaseVertex;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCEDBASEVERTEX)(GLenum, GLsizei, GLenum, const void *, GLsizei, GLint);
-	PFNDRAWELEMENTSINSTANCEDBASEVERTEX DrawElementsInstancedBaseVertex = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex)
+	{
+		DrawElementsInstancedBaseVertex = reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEVERTEX>(IntGetProcAddress("glDrawElementsInstancedBaseVertex"));
+		CheckLazyEntryPoint(DrawElementsInstancedBaseVertex != 0, "glDrawElementsInstancedBaseVertex");
+		return DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	}
+	PFNDRAWELEMENTSINSTANCEDBASEVERTEX DrawElementsInstancedBaseVertex = Switch_DrawElementsInstancedBaseVertex;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWRANGEELEMENTSBASEVERTEX)(GLenum, GLuint, GLuint, GLsizei, GLenum, const void *, GLint);
-	PFNDRAWRANGEELEMENTSBASEVERTEX DrawRangeElementsBaseVertex = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex)
+	{
+		DrawRangeElementsBaseVertex = reinterpret_cast<PFNDRAWRANGEELEMENTSBASEVERTEX>(IntGetProcAddress("glDrawRangeElementsBaseVertex"));
+		CheckLazyEntryPoint(DrawRangeElementsBaseVertex != 0, "glDrawRangeElementsBaseVertex");
+		return DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	}
+	PFNDRAWRANGEELEMENTSBASEVERTEX DrawRangeElementsBaseVertex = Switch_DrawRangeElementsBaseVertex;
 	typedef GLsync (CODEGEN_FUNCPTR *PFNFENCESYNC)(GLenum, GLbitfield);
-	PFNFENCESYNC FenceSync = 0;
+	static GLsync CODEGEN_FUNCPTR Switch_FenceSync(GLenum condition, GLbitfield flags)
+	{
+		FenceSync = reinterpret_cast<PFNFENCESYNC>(IntGetProcAddress("glFenceSync"));
+		CheckLazyEntryPoint(FenceSync != 0, "glFenceSync");
+		return FenceSync(condition, flags);
+	}
+	PFNFENCESYNC FenceSync = Switch_FenceSync;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERTEXTURE)(GLenum, GLenum, GLuint, GLint);
-	PFNFRAMEBUFFERTEXTURE FramebufferTexture = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+	{
+		FramebufferTexture = reinterpret_cast<PFNFRAMEBUFFERTEXTURE>(IntGetProcAddress("glFramebufferTexture"));
+		CheckLazyEntryPoint(FramebufferTexture != 0, "glFramebufferTexture");
+		return FramebufferTexture(target, attachment, texture, level);
+	}
+	PFNFRAMEBUFFERTEXTURE FramebufferTexture = Switch_FramebufferTexture;
 	typedef void (CODEGEN_FUNCPTR *PFNGETBUFFERPARAMETERI64V)(GLenum, GLenum, GLint64 *);
-	PFNGETBUFFERPARAMETERI64V GetBufferParameteri64v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params)
+	{
+		GetBufferParameteri64v = reinterpret_cast<PFNGETBUFFERPARAMETERI64V>(IntGetProcAddress("glGetBufferParameteri64v"));
+		CheckLazyEntryPoint(GetBufferParameteri64v != 0, "glGetBufferParameteri64v");
+		return GetBufferParameteri64v(target, pname, params);
+	}
+	PFNGETBUFFERPARAMETERI64V GetBufferParameteri64v = Switch_GetBufferParameteri64v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64I_V)(GLenum, GLuint, GLint64 *);
-	PFNGETINTEGER64I_V GetInteger64i_v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetInteger64i_v(GLenum target, GLuint index, GLint64 * data)
+	{
+		GetInteger64i_v = reinterpret_cast<PFNGETINTEGER64I_V>(IntGetProcAddress("glGetInteger64i_v"));
+		CheckLazyEntryPoint(GetInteger64i_v != 0, "glGetInteger64i_v");
+		return GetInteger64i_v(target, index, data);
+	}
+	PFNGETINTEGER64I_V GetInteger64i_v = Switch_GetInteger64i_v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTEGER64V)(GLenum, GLint64 *);
-	PFNGETINTEGER64V GetInteger64v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetInteger64v(GLenum pname, GLint64 * data)
+	{
+		GetInteger64v = reinterpret_cast<PFNGETINTEGER64V>(IntGetProcAddress("glGetInteger64v"));
+		CheckLazyEntryPoint(GetInteger64v != 0, "glGetInteger64v");
+		return GetInteger64v(pname, data);
+	}
+	PFNGETINTEGER64V GetInteger64v = Switch_GetInteger64v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETMULTISAMPLEFV)(GLenum, GLuint, GLfloat *);
-	PFNGETMULTISAMPLEFV GetMultisamplefv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetMultisamplefv(GLenum pname, GLuint index, GLfloat * val)
+	{
+		GetMultisamplefv = reinterpret_cast<PFNGETMULTISAMPLEFV>(IntGetProcAddress("glGetMultisamplefv"));
+		CheckLazyEntryPoint(GetMultisamplefv != 0, "glGetMultisamplefv");
+		return GetMultisamplefv(pname, index, val);
+	}
+	PFNGETMULTISAMPLEFV GetMultisamplefv = Switch_GetMultisamplefv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSYNCIV)(GLsync, GLenum, GLsizei, GLsizei *, GLint *);
-	PFNGETSYNCIV GetSynciv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei * length, GLint * values)
+	{
+		GetSynciv = reinterpret_cast<PFNGETSYNCIV>(IntGetProcAddress("glGetSynciv"));
+		CheckLazyEntryPoint(GetSynciv != 0, "glGetSynciv");
+		return GetSynciv(sync, pname, bufSize, length, values);
+	}
+	PFNGETSYNCIV GetSynciv = Switch_GetSynciv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSYNC)(GLsync);
-	PFNISSYNC IsSync = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSync(GLsync sync)
+	{
+		IsSync = reinterpret_cast<PFNISSYNC>(IntGetProcAddress("glIsSync"));
+		CheckLazyEntryPoint(IsSync != 0, "glIsSync");
+		return IsSync(sync);
+	}
+	PFNISSYNC IsSync = Switch_IsSync;
 	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTSBASEVERTEX)(GLenum, const GLsizei *, GLenum, const void *const*, GLsizei, const GLint *);
-	PFNMULTIDRAWELEMENTSBASEVERTEX MultiDrawElementsBaseVertex = 0;
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex)
+	{
+		MultiDrawElementsBaseVertex = reinterpret_cast<PFNMULTIDRAWELEMENTSBASEVERTEX>(IntGetProcAddress("glMultiDrawElementsBaseVertex"));
+		CheckLazyEntryPoint(MultiDrawElementsBaseVertex != 0, "glMultiDrawElementsBaseVertex");
+		return MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	}
+	PFNMULTIDRAWELEMENTSBASEVERTEX MultiDrawElementsBaseVertex = Switch_MultiDrawElementsBaseVertex;
 	typedef void (CODEGEN_FUNCPTR *PFNPROVOKINGVERTEX)(GLenum);
-	PFNPROVOKINGVERTEX ProvokingVertex = 0;
+	static void CODEGEN_FUNCPTR Switch_ProvokingVertex(GLenum mode)
+	{
+		ProvokingVertex = reinterpret_cast<PFNPROVOKINGVERTEX>(IntGetProcAddress("glProvokingVertex"));
+		CheckLazyEntryPoint(ProvokingVertex != 0, "glProvokingVertex");
+		return ProvokingVertex(mode);
+	}
+	PFNPROVOKINGVERTEX ProvokingVertex = Switch_ProvokingVertex;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLEMASKI)(GLuint, GLbitfield);
-	PFNSAMPLEMASKI SampleMaski = 0;
+	static void CODEGEN_FUNCPTR Switch_SampleMaski(GLuint maskNumber, GLbitfield mask)
+	{
+		SampleMaski = reinterpret_cast<PFNSAMPLEMASKI>(IntGetProcAddress("glSampleMaski"));
+		CheckLazyEntryPoint(SampleMaski != 0, "glSampleMaski");
+		return SampleMaski(maskNumber, mask);
+	}
+	PFNSAMPLEMASKI SampleMaski = Switch_SampleMaski;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE2DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean);
-	PFNTEXIMAGE2DMULTISAMPLE TexImage2DMultisample = 0;
+	static void CODEGEN_FUNCPTR Switch_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+	{
+		TexImage2DMultisample = reinterpret_cast<PFNTEXIMAGE2DMULTISAMPLE>(IntGetProcAddress("glTexImage2DMultisample"));
+		CheckLazyEntryPoint(TexImage2DMultisample != 0, "glTexImage2DMultisample");
+		return TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	}
+	PFNTEXIMAGE2DMULTISAMPLE TexImage2DMultisample = Switch_TexImage2DMultisample;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXIMAGE3DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean);
-	PFNTEXIMAGE3DMULTISAMPLE TexImage3DMultisample = 0;
+	static void CODEGEN_FUNCPTR Switch_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+	{
+		TexImage3DMultisample = reinterpret_cast<PFNTEXIMAGE3DMULTISAMPLE>(IntGetProcAddress("glTexImage3DMultisample"));
+		CheckLazyEntryPoint(TexImage3DMultisample != 0, "glTexImage3DMultisample");
+		return TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	}
+	PFNTEXIMAGE3DMULTISAMPLE TexImage3DMultisample = Switch_TexImage3DMultisample;
 	typedef void (CODEGEN_FUNCPTR *PFNWAITSYNC)(GLsync, GLbitfield, GLuint64);
-	PFNWAITSYNC WaitSync = 0;
+	static void CODEGEN_FUNCPTR Switch_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+	{
+		WaitSync = reinterpret_cast<PFNWAITSYNC>(IntGetProcAddress("glWaitSync"));
+		CheckLazyEntryPoint(WaitSync != 0, "glWaitSync");
+		return WaitSync(sync, flags, timeout);
+	}
+	PFNWAITSYNC WaitSync = Switch_WaitSync;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBINDFRAGDATALOCATIONINDEXED)(GLuint, GLuint, GLuint, const GLchar *);
-	PFNBINDFRAGDATALOCATIONINDEXED BindFragDataLocationIndexed = 0;
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name)
+	{
+		BindFragDataLocationIndexed = reinterpret_cast<PFNBINDFRAGDATALOCATIONINDEXED>(IntGetProcAddress("glBindFragDataLocationIndexed"));
+		CheckLazyEntryPoint(BindFragDataLocationIndexed != 0, "glBindFragDataLocationIndexed");
+		return BindFragDataLocationIndexed(program, colorNumber, index, name);
+	}
+	PFNBINDFRAGDATALOCATIONINDEXED BindFragDataLocationIndexed = Switch_BindFragDataLocationIndexed;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDSAMPLER)(GLuint, GLuint);
-	PFNBINDSAMPLER BindSampler = 0;
+	static void CODEGEN_FUNCPTR Switch_BindSampler(GLuint unit, GLuint sampler)
+	{
+		BindSampler = reinterpret_cast<PFNBINDSAMPLER>(IntGetProcAddress("glBindSampler"));
+		CheckLazyEntryPoint(BindSampler != 0, "glBindSampler");
+		return BindSampler(unit, sampler);
+	}
+	PFNBINDSAMPLER BindSampler = Switch_BindSampler;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETESAMPLERS)(GLsizei, const GLuint *);
-	PFNDELETESAMPLERS DeleteSamplers = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteSamplers(GLsizei count, const GLuint * samplers)
+	{
+		DeleteSamplers = reinterpret_cast<PFNDELETESAMPLERS>(IntGetProcAddress("glDeleteSamplers"));
+		CheckLazyEntryPoint(DeleteSamplers != 0, "glDeleteSamplers");
+		return DeleteSamplers(count, samplers);
+	}
+	PFNDELETESAMPLERS DeleteSamplers = Switch_DeleteSamplers;
 	typedef void (CODEGEN_FUNCPTR *PFNGENSAMPLERS)(GLsizei, GLuint *);
-	PFNGENSAMPLERS GenSamplers = 0;
+	static void CODEGEN_FUNCPTR Switch_GenSamplers(GLsizei count, GLuint * samplers)
+	{
+		GenSamplers = reinterpret_cast<PFNGENSAMPLERS>(IntGetProcAddress("glGenSamplers"));
+		CheckLazyEntryPoint(GenSamplers != 0, "glGenSamplers");
+		return GenSamplers(count, samplers);
+	}
+	PFNGENSAMPLERS GenSamplers = Switch_GenSamplers;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETFRAGDATAINDEX)(GLuint, const GLchar *);
-	PFNGETFRAGDATAINDEX GetFragDataIndex = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataIndex(GLuint program, const GLchar * name)
+	{
+		GetFragDataIndex = reinterpret_cast<PFNGETFRAGDATAINDEX>(IntGetProcAddress("glGetFragDataIndex"));
+		CheckLazyEntryPoint(GetFragDataIndex != 0, "glGetFragDataIndex");
+		return GetFragDataIndex(program, name);
+	}
+	PFNGETFRAGDATAINDEX GetFragDataIndex = Switch_GetFragDataIndex;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTI64V)(GLuint, GLenum, GLint64 *);
-	PFNGETQUERYOBJECTI64V GetQueryObjecti64v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params)
+	{
+		GetQueryObjecti64v = reinterpret_cast<PFNGETQUERYOBJECTI64V>(IntGetProcAddress("glGetQueryObjecti64v"));
+		CheckLazyEntryPoint(GetQueryObjecti64v != 0, "glGetQueryObjecti64v");
+		return GetQueryObjecti64v(id, pname, params);
+	}
+	PFNGETQUERYOBJECTI64V GetQueryObjecti64v = Switch_GetQueryObjecti64v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYOBJECTUI64V)(GLuint, GLenum, GLuint64 *);
-	PFNGETQUERYOBJECTUI64V GetQueryObjectui64v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params)
+	{
+		GetQueryObjectui64v = reinterpret_cast<PFNGETQUERYOBJECTUI64V>(IntGetProcAddress("glGetQueryObjectui64v"));
+		CheckLazyEntryPoint(GetQueryObjectui64v != 0, "glGetQueryObjectui64v");
+		return GetQueryObjectui64v(id, pname, params);
+	}
+	PFNGETQUERYOBJECTUI64V GetQueryObjectui64v = Switch_GetQueryObjectui64v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIIV)(GLuint, GLenum, GLint *);
-	PFNGETSAMPLERPARAMETERIIV GetSamplerParameterIiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params)
+	{
+		GetSamplerParameterIiv = reinterpret_cast<PFNGETSAMPLERPARAMETERIIV>(IntGetProcAddress("glGetSamplerParameterIiv"));
+		CheckLazyEntryPoint(GetSamplerParameterIiv != 0, "glGetSamplerParameterIiv");
+		return GetSamplerParameterIiv(sampler, pname, params);
+	}
+	PFNGETSAMPLERPARAMETERIIV GetSamplerParameterIiv = Switch_GetSamplerParameterIiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIUIV)(GLuint, GLenum, GLuint *);
-	PFNGETSAMPLERPARAMETERIUIV GetSamplerParameterIuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params)
+	{
+		GetSamplerParameterIuiv = reinterpret_cast<PFNGETSAMPLERPARAMETERIUIV>(IntGetProcAddress("glGetSamplerParameterIuiv"));
+		CheckLazyEntryPoint(GetSamplerParameterIuiv != 0, "glGetSamplerParameterIuiv");
+		return GetSamplerParameterIuiv(sampler, pname, params);
+	}
+	PFNGETSAMPLERPARAMETERIUIV GetSamplerParameterIuiv = Switch_GetSamplerParameterIuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERFV)(GLuint, GLenum, GLfloat *);
-	PFNGETSAMPLERPARAMETERFV GetSamplerParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params)
+	{
+		GetSamplerParameterfv = reinterpret_cast<PFNGETSAMPLERPARAMETERFV>(IntGetProcAddress("glGetSamplerParameterfv"));
+		CheckLazyEntryPoint(GetSamplerParameterfv != 0, "glGetSamplerParameterfv");
+		return GetSamplerParameterfv(sampler, pname, params);
+	}
+	PFNGETSAMPLERPARAMETERFV GetSamplerParameterfv = Switch_GetSamplerParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSAMPLERPARAMETERIV)(GLuint, GLenum, GLint *);
-	PFNGETSAMPLERPARAMETERIV GetSamplerParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params)
+	{
+		GetSamplerParameteriv = reinterpret_cast<PFNGETSAMPLERPARAMETERIV>(IntGetProcAddress("glGetSamplerParameteriv"));
+		CheckLazyEntryPoint(GetSamplerParameteriv != 0, "glGetSamplerParameteriv");
+		return GetSamplerParameteriv(sampler, pname, params);
+	}
+	PFNGETSAMPLERPARAMETERIV GetSamplerParameteriv = Switch_GetSamplerParameteriv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISSAMPLER)(GLuint);
-	PFNISSAMPLER IsSampler = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSampler(GLuint sampler)
+	{
+		IsSampler = reinterpret_cast<PFNISSAMPLER>(IntGetProcAddress("glIsSampler"));
+		CheckLazyEntryPoint(IsSampler != 0, "glIsSampler");
+		return IsSampler(sampler);
+	}
+	PFNISSAMPLER IsSampler = Switch_IsSampler;
 	typedef void (CODEGEN_FUNCPTR *PFNQUERYCOUNTER)(GLuint, GLenum);
-	PFNQUERYCOUNTER QueryCounter = 0;
+	static void CODEGEN_FUNCPTR Switch_QueryCounter(GLuint id, GLenum target)
+	{
+		QueryCounter = reinterpret_cast<PFNQUERYCOUNTER>(IntGetProcAddress("glQueryCounter"));
+		CheckLazyEntryPoint(QueryCounter != 0, "glQueryCounter");
+		return QueryCounter(id, target);
+	}
+	PFNQUERYCOUNTER QueryCounter = Switch_QueryCounter;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIIV)(GLuint, GLenum, const GLint *);
-	PFNSAMPLERPARAMETERIIV SamplerParameterIiv = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param)
+	{
+		SamplerParameterIiv = reinterpret_cast<PFNSAMPLERPARAMETERIIV>(IntGetProcAddress("glSamplerParameterIiv"));
+		CheckLazyEntryPoint(SamplerParameterIiv != 0, "glSamplerParameterIiv");
+		return SamplerParameterIiv(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERIIV SamplerParameterIiv = Switch_SamplerParameterIiv;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIUIV)(GLuint, GLenum, const GLuint *);
-	PFNSAMPLERPARAMETERIUIV SamplerParameterIuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param)
+	{
+		SamplerParameterIuiv = reinterpret_cast<PFNSAMPLERPARAMETERIUIV>(IntGetProcAddress("glSamplerParameterIuiv"));
+		CheckLazyEntryPoint(SamplerParameterIuiv != 0, "glSamplerParameterIuiv");
+		return SamplerParameterIuiv(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERIUIV SamplerParameterIuiv = Switch_SamplerParameterIuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERF)(GLuint, GLenum, GLfloat);
-	PFNSAMPLERPARAMETERF SamplerParameterf = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+	{
+		SamplerParameterf = reinterpret_cast<PFNSAMPLERPARAMETERF>(IntGetProcAddress("glSamplerParameterf"));
+		CheckLazyEntryPoint(SamplerParameterf != 0, "glSamplerParameterf");
+		return SamplerParameterf(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERF SamplerParameterf = Switch_SamplerParameterf;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERFV)(GLuint, GLenum, const GLfloat *);
-	PFNSAMPLERPARAMETERFV SamplerParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param)
+	{
+		SamplerParameterfv = reinterpret_cast<PFNSAMPLERPARAMETERFV>(IntGetProcAddress("glSamplerParameterfv"));
+		CheckLazyEntryPoint(SamplerParameterfv != 0, "glSamplerParameterfv");
+		return SamplerParameterfv(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERFV SamplerParameterfv = Switch_SamplerParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERI)(GLuint, GLenum, GLint);
-	PFNSAMPLERPARAMETERI SamplerParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+	{
+		SamplerParameteri = reinterpret_cast<PFNSAMPLERPARAMETERI>(IntGetProcAddress("glSamplerParameteri"));
+		CheckLazyEntryPoint(SamplerParameteri != 0, "glSamplerParameteri");
+		return SamplerParameteri(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERI SamplerParameteri = Switch_SamplerParameteri;
 	typedef void (CODEGEN_FUNCPTR *PFNSAMPLERPARAMETERIV)(GLuint, GLenum, const GLint *);
-	PFNSAMPLERPARAMETERIV SamplerParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param)
+	{
+		SamplerParameteriv = reinterpret_cast<PFNSAMPLERPARAMETERIV>(IntGetProcAddress("glSamplerParameteriv"));
+		CheckLazyEntryPoint(SamplerParameteriv != 0, "glSamplerParameteriv");
+		return SamplerParameteriv(sampler, pname, param);
+	}
+	PFNSAMPLERPARAMETERIV SamplerParameteriv = Switch_SamplerParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBDIVISOR)(GLuint, GLuint);
-	PFNVERTEXATTRIBDIVISOR VertexAttribDivisor = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribDivisor(GLuint index, GLuint divisor)
+	{
+		VertexAttribDivisor = reinterpret_cast<PFNVERTEXATTRIBDIVISOR>(IntGetProcAddress("glVertexAttribDivisor"));
+		CheckLazyEntryPoint(VertexAttribDivisor != 0, "glVertexAttribDivisor");
+		return VertexAttribDivisor(index, divisor);
+	}
+	PFNVERTEXATTRIBDIVISOR VertexAttribDivisor = Switch_VertexAttribDivisor;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP1UI VertexAttribP1ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+	{
+		VertexAttribP1ui = reinterpret_cast<PFNVERTEXATTRIBP1UI>(IntGetProcAddress("glVertexAttribP1ui"));
+		CheckLazyEntryPoint(VertexAttribP1ui != 0, "glVertexAttribP1ui");
+		return VertexAttribP1ui(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP1UI VertexAttribP1ui = Switch_VertexAttribP1ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP1UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP1UIV VertexAttribP1uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+	{
+		VertexAttribP1uiv = reinterpret_cast<PFNVERTEXATTRIBP1UIV>(IntGetProcAddress("glVertexAttribP1uiv"));
+		CheckLazyEntryPoint(VertexAttribP1uiv != 0, "glVertexAttribP1uiv");
+		return VertexAttribP1uiv(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP1UIV VertexAttribP1uiv = Switch_VertexAttribP1uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP2UI VertexAttribP2ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+	{
+		VertexAttribP2ui = reinterpret_cast<PFNVERTEXATTRIBP2UI>(IntGetProcAddress("glVertexAttribP2ui"));
+		CheckLazyEntryPoint(VertexAttribP2ui != 0, "glVertexAttribP2ui");
+		return VertexAttribP2ui(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP2UI VertexAttribP2ui = Switch_VertexAttribP2ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP2UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP2UIV VertexAttribP2uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+	{
+		VertexAttribP2uiv = reinterpret_cast<PFNVERTEXATTRIBP2UIV>(IntGetProcAddress("glVertexAttribP2uiv"));
+		CheckLazyEntryPoint(VertexAttribP2uiv != 0, "glVertexAttribP2uiv");
+		return VertexAttribP2uiv(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP2UIV VertexAttribP2uiv = Switch_VertexAttribP2uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP3UI VertexAttribP3ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+	{
+		VertexAttribP3ui = reinterpret_cast<PFNVERTEXATTRIBP3UI>(IntGetProcAddress("glVertexAttribP3ui"));
+		CheckLazyEntryPoint(VertexAttribP3ui != 0, "glVertexAttribP3ui");
+		return VertexAttribP3ui(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP3UI VertexAttribP3ui = Switch_VertexAttribP3ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP3UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP3UIV VertexAttribP3uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+	{
+		VertexAttribP3uiv = reinterpret_cast<PFNVERTEXATTRIBP3UIV>(IntGetProcAddress("glVertexAttribP3uiv"));
+		CheckLazyEntryPoint(VertexAttribP3uiv != 0, "glVertexAttribP3uiv");
+		return VertexAttribP3uiv(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP3UIV VertexAttribP3uiv = Switch_VertexAttribP3uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UI)(GLuint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBP4UI VertexAttribP4ui = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+	{
+		VertexAttribP4ui = reinterpret_cast<PFNVERTEXATTRIBP4UI>(IntGetProcAddress("glVertexAttribP4ui"));
+		CheckLazyEntryPoint(VertexAttribP4ui != 0, "glVertexAttribP4ui");
+		return VertexAttribP4ui(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP4UI VertexAttribP4ui = Switch_VertexAttribP4ui;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBP4UIV)(GLuint, GLenum, GLboolean, const GLuint *);
-	PFNVERTEXATTRIBP4UIV VertexAttribP4uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value)
+	{
+		VertexAttribP4uiv = reinterpret_cast<PFNVERTEXATTRIBP4UIV>(IntGetProcAddress("glVertexAttribP4uiv"));
+		CheckLazyEntryPoint(VertexAttribP4uiv != 0, "glVertexAttribP4uiv");
+		return VertexAttribP4uiv(index, type, normalized, value);
+	}
+	PFNVERTEXATTRIBP4UIV VertexAttribP4uiv = Switch_VertexAttribP4uiv;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBEGINQUERYINDEXED)(GLenum, GLuint, GLuint);
-	PFNBEGINQUERYINDEXED BeginQueryIndexed = 0;
+	static void CODEGEN_FUNCPTR Switch_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
+	{
+		BeginQueryIndexed = reinterpret_cast<PFNBEGINQUERYINDEXED>(IntGetProcAddress("glBeginQueryIndexed"));
+		CheckLazyEntryPoint(BeginQueryIndexed != 0, "glBeginQueryIndexed");
+		return BeginQueryIndexed(target, index, id);
+	}
+	PFNBEGINQUERYINDEXED BeginQueryIndexed = Switch_BeginQueryIndexed;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDTRANSFORMFEEDBACK)(GLenum, GLuint);
-	PFNBINDTRANSFORMFEEDBACK BindTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_BindTransformFeedback(GLenum target, GLuint id)
+	{
+		BindTransformFeedback = reinterpret_cast<PFNBINDTRANSFORMFEEDBACK>(IntGetProcAddress("glBindTransformFeedback"));
+		CheckLazyEntryPoint(BindTransformFeedback != 0, "glBindTransformFeedback");
+		return BindTransformFeedback(target, id);
+	}
+	PFNBINDTRANSFORMFEEDBACK BindTransformFeedback = Switch_BindTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDEQUATIONSEPARATEI)(GLuint, GLenum, GLenum);
-	PFNBLENDEQUATIONSEPARATEI BlendEquationSeparatei = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+	{
+		BlendEquationSeparatei = reinterpret_cast<PFNBLENDEQUATIONSEPARATEI>(IntGetProcAddress("glBlendEquationSeparatei"));
+		CheckLazyEntryPoint(BlendEquationSeparatei != 0, "glBlendEquationSeparatei");
+		return BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	}
+	PFNBLENDEQUATIONSEPARATEI BlendEquationSeparatei = Switch_BlendEquationSeparatei;
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDEQUATIONI)(GLuint, GLenum);
-	PFNBLENDEQUATIONI BlendEquationi = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendEquationi(GLuint buf, GLenum mode)
+	{
+		BlendEquationi = reinterpret_cast<PFNBLENDEQUATIONI>(IntGetProcAddress("glBlendEquationi"));
+		CheckLazyEntryPoint(BlendEquationi != 0, "glBlendEquationi");
+		return BlendEquationi(buf, mode);
+	}
+	PFNBLENDEQUATIONI BlendEquationi = Switch_BlendEquationi;
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNCSEPARATEI)(GLuint, GLenum, GLenum, GLenum, GLenum);
-	PFNBLENDFUNCSEPARATEI BlendFuncSeparatei = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+	{
+		BlendFuncSeparatei = reinterpret_cast<PFNBLENDFUNCSEPARATEI>(IntGetProcAddress("glBlendFuncSeparatei"));
+		CheckLazyEntryPoint(BlendFuncSeparatei != 0, "glBlendFuncSeparatei");
+		return BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	}
+	PFNBLENDFUNCSEPARATEI BlendFuncSeparatei = Switch_BlendFuncSeparatei;
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNCI)(GLuint, GLenum, GLenum);
-	PFNBLENDFUNCI BlendFunci = 0;
+	static void CODEGEN_FUNCPTR Switch_BlendFunci(GLuint buf, GLenum src, GLenum dst)
+	{
+		BlendFunci = reinterpret_cast<PFNBLENDFUNCI>(IntGetProcAddress("glBlendFunci"));
+		CheckLazyEntryPoint(BlendFunci != 0, "glBlendFunci");
+		return BlendFunci(buf, src, dst);
+	}
+	PFNBLENDFUNCI BlendFunci = Switch_BlendFunci;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETETRANSFORMFEEDBACKS)(GLsizei, const GLuint *);
-	PFNDELETETRANSFORMFEEDBACKS DeleteTransformFeedbacks = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteTransformFeedbacks(GLsizei n, const GLuint * ids)
+	{
+		DeleteTransformFeedbacks = reinterpret_cast<PFNDELETETRANSFORMFEEDBACKS>(IntGetProcAddress("glDeleteTransformFeedbacks"));
+		CheckLazyEntryPoint(DeleteTransformFeedbacks != 0, "glDeleteTransformFeedbacks");
+		return DeleteTransformFeedbacks(n, ids);
+	}
+	PFNDELETETRANSFORMFEEDBACKS DeleteTransformFeedbacks = Switch_DeleteTransformFeedbacks;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYSINDIRECT)(GLenum, const void *);
-	PFNDRAWARRAYSINDIRECT DrawArraysIndirect = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawArraysIndirect(GLenum mode, const void * indirect)
+	{
+		DrawArraysIndirect = reinterpret_cast<PFNDRAWARRAYSINDIRECT>(IntGetProcAddress("glDrawArraysIndirect"));
+		CheckLazyEntryPoint(DrawArraysIndirect != 0, "glDrawArraysIndirect");
+		return DrawArraysIndirect(mode, indirect);
+	}
+	PFNDRAWARRAYSINDIRECT DrawArraysIndirect = Switch_DrawArraysIndirect;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINDIRECT)(GLenum, GLenum, const void *);
-	PFNDRAWELEMENTSINDIRECT DrawElementsIndirect = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsIndirect(GLenum mode, GLenum type, const void * indirect)
+	{
+		DrawElementsIndirect = reinterpret_cast<PFNDRAWELEMENTSINDIRECT>(IntGetProcAddress("glDrawElementsIndirect"));
+		CheckLazyEntryPoint(DrawElementsIndirect != 0, "glDrawElementsIndirect");
+		return DrawElementsIndirect(mode, type, indirect);
+	}
+	PFNDRAWELEMENTSINDIRECT DrawElementsIndirect = Switch_DrawElementsIndirect;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWTRANSFORMFEEDBACK)(GLenum, GLuint);
-	PFNDRAWTRANSFORMFEEDBACK DrawTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedback(GLenum mode, GLuint id)
+	{
+		DrawTransformFeedback = reinterpret_cast<PFNDRAWTRANSFORMFEEDBACK>(IntGetProcAddress("glDrawTransformFeedback"));
+		CheckLazyEntryPoint(DrawTransformFeedback != 0, "glDrawTransformFeedback");
+		return DrawTransformFeedback(mode, id);
+	}
+	PFNDRAWTRANSFORMFEEDBACK DrawTransformFeedback = Switch_DrawTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWTRANSFORMFEEDBACKSTREAM)(GLenum, GLuint, GLuint);
-	PFNDRAWTRANSFORMFEEDBACKSTREAM DrawTransformFeedbackStream = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+	{
+		DrawTransformFeedbackStream = reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKSTREAM>(IntGetProcAddress("glDrawTransformFeedbackStream"));
+		CheckLazyEntryPoint(DrawTransformFeedbackStream != 0, "glDrawTransformFeedbackStream");
+		return DrawTransformFeedbackStream(mode, id, stream);
+	}
+	PFNDRAWTRANSFORMFEEDBACKSTREAM DrawTransformFeedbackStream = Switch_DrawTransformFeedbackStream;
 	typedef void (CODEGEN_FUNCPTR *PFNENDQUERYINDEXED)(GLenum, GLuint);
-	PFNENDQUERYINDEXED EndQueryIndexed = 0;
+	static void CODEGEN_FUNCPTR Switch_EndQueryIndexed(GLenum target, GLuint index)
+	{
+		EndQueryIndexed = reinterpret_cast<PFNENDQUERYINDEXED>(IntGetProcAddress("glEndQueryIndexed"));
+		CheckLazyEntryPoint(EndQueryIndexed != 0, "glEndQueryIndexed");
+		return EndQueryIndexed(target, index);
+	}
+	PFNENDQUERYINDEXED EndQueryIndexed = Switch_EndQueryIndexed;
 	typedef void (CODEGEN_FUNCPTR *PFNGENTRANSFORMFEEDBACKS)(GLsizei, GLuint *);
-	PFNGENTRANSFORMFEEDBACKS GenTransformFeedbacks = 0;
+	static void CODEGEN_FUNCPTR Switch_GenTransformFeedbacks(GLsizei n, GLuint * ids)
+	{
+		GenTransformFeedbacks = reinterpret_cast<PFNGENTRANSFORMFEEDBACKS>(IntGetProcAddress("glGenTransformFeedbacks"));
+		CheckLazyEntryPoint(GenTransformFeedbacks != 0, "glGenTransformFeedbacks");
+		return GenTransformFeedbacks(n, ids);
+	}
+	PFNGENTRANSFORMFEEDBACKS GenTransformFeedbacks = Switch_GenTransformFeedbacks;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVESUBROUTINENAME)(GLuint, GLenum, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVESUBROUTINENAME GetActiveSubroutineName = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name)
+	{
+		GetActiveSubroutineName = reinterpret_cast<PFNGETACTIVESUBROUTINENAME>(IntGetProcAddress("glGetActiveSubroutineName"));
+		CheckLazyEntryPoint(GetActiveSubroutineName != 0, "glGetActiveSubroutineName");
+		return GetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+	}
+	PFNGETACTIVESUBROUTINENAME GetActiveSubroutineName = Switch_GetActiveSubroutineName;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVESUBROUTINEUNIFORMNAME)(GLuint, GLenum, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETACTIVESUBROUTINEUNIFORMNAME GetActiveSubroutineUniformName = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei * length, GLchar * name)
+	{
+		GetActiveSubroutineUniformName = reinterpret_cast<PFNGETACTIVESUBROUTINEUNIFORMNAME>(IntGetProcAddress("glGetActiveSubroutineUniformName"));
+		CheckLazyEntryPoint(GetActiveSubroutineUniformName != 0, "glGetActiveSubroutineUniformName");
+		return GetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+	}
+	PFNGETACTIVESUBROUTINEUNIFORMNAME GetActiveSubroutineUniformName = Switch_GetActiveSubroutineUniformName;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVESUBROUTINEUNIFORMIV)(GLuint, GLenum, GLuint, GLenum, GLint *);
-	PFNGETACTIVESUBROUTINEUNIFORMIV GetActiveSubroutineUniformiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values)
+	{
+		GetActiveSubroutineUniformiv = reinterpret_cast<PFNGETACTIVESUBROUTINEUNIFORMIV>(IntGetProcAddress("glGetActiveSubroutineUniformiv"));
+		CheckLazyEntryPoint(GetActiveSubroutineUniformiv != 0, "glGetActiveSubroutineUniformiv");
+		return GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	}
+	PFNGETACTIVESUBROUTINEUNIFORMIV GetActiveSubroutineUniformiv = Switch_GetActiveSubroutineUniformiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMSTAGEIV)(GLuint, GLenum, GLenum, GLint *);
-	PFNGETPROGRAMSTAGEIV GetProgramStageiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values)
+	{
+		GetProgramStageiv = reinterpret_cast<PFNGETPROGRAMSTAGEIV>(IntGetProcAddress("glGetProgramStageiv"));
+		CheckLazyEntryPoint(GetProgramStageiv != 0, "glGetProgramStageiv");
+		return GetProgramStageiv(program, shadertype, pname, values);
+	}
+	PFNGETPROGRAMSTAGEIV GetProgramStageiv = Switch_GetProgramStageiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETQUERYINDEXEDIV)(GLenum, GLuint, GLenum, GLint *);
-	PFNGETQUERYINDEXEDIV GetQueryIndexediv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params)
+	{
+		GetQueryIndexediv = reinterpret_cast<PFNGETQUERYINDEXEDIV>(IntGetProcAddress("glGetQueryIndexediv"));
+		CheckLazyEntryPoint(GetQueryIndexediv != 0, "glGetQueryIndexediv");
+		return GetQueryIndexediv(target, index, pname, params);
+	}
+	PFNGETQUERYINDEXEDIV GetQueryIndexediv = Switch_GetQueryIndexediv;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNGETSUBROUTINEINDEX)(GLuint, GLenum, const GLchar *);
-	PFNGETSUBROUTINEINDEX GetSubroutineIndex = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_GetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name)
+	{
+		GetSubroutineIndex = reinterpret_cast<PFNGETSUBROUTINEINDEX>(IntGetProcAddress("glGetSubroutineIndex"));
+		CheckLazyEntryPoint(GetSubroutineIndex != 0, "glGetSubroutineIndex");
+		return GetSubroutineIndex(program, shadertype, name);
+	}
+	PFNGETSUBROUTINEINDEX GetSubroutineIndex = Switch_GetSubroutineIndex;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETSUBROUTINEUNIFORMLOCATION)(GLuint, GLenum, const GLchar *);
-	PFNGETSUBROUTINEUNIFORMLOCATION GetSubroutineUniformLocation = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name)
+	{
+		GetSubroutineUniformLocation = reinterpret_cast<PFNGETSUBROUTINEUNIFORMLOCATION>(IntGetProcAddress("glGetSubroutineUniformLocation"));
+		CheckLazyEntryPoint(GetSubroutineUniformLocation != 0, "glGetSubroutineUniformLocation");
+		return GetSubroutineUniformLocation(program, shadertype, name);
+	}
+	PFNGETSUBROUTINEUNIFORMLOCATION GetSubroutineUniformLocation = Switch_GetSubroutineUniformLocation;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMSUBROUTINEUIV)(GLenum, GLint, GLuint *);
-	PFNGETUNIFORMSUBROUTINEUIV GetUniformSubroutineuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params)
+	{
+		GetUniformSubroutineuiv = reinterpret_cast<PFNGETUNIFORMSUBROUTINEUIV>(IntGetProcAddress("glGetUniformSubroutineuiv"));
+		CheckLazyEntryPoint(GetUniformSubroutineuiv != 0, "glGetUniformSubroutineuiv");
+		return GetUniformSubroutineuiv(shadertype, location, params);
+	}
+	PFNGETUNIFORMSUBROUTINEUIV GetUniformSubroutineuiv = Switch_GetUniformSubroutineuiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETUNIFORMDV)(GLuint, GLint, GLdouble *);
-	PFNGETUNIFORMDV GetUniformdv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetUniformdv(GLuint program, GLint location, GLdouble * params)
+	{
+		GetUniformdv = reinterpret_cast<PFNGETUNIFORMDV>(IntGetProcAddress("glGetUniformdv"));
+		CheckLazyEntryPoint(GetUniformdv != 0, "glGetUniformdv");
+		return GetUniformdv(program, location, params);
+	}
+	PFNGETUNIFORMDV GetUniformdv = Switch_GetUniformdv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISTRANSFORMFEEDBACK)(GLuint);
-	PFNISTRANSFORMFEEDBACK IsTransformFeedback = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsTransformFeedback(GLuint id)
+	{
+		IsTransformFeedback = reinterpret_cast<PFNISTRANSFORMFEEDBACK>(IntGetProcAddress("glIsTransformFeedback"));
+		CheckLazyEntryPoint(IsTransformFeedback != 0, "glIsTransformFeedback");
+		return IsTransformFeedback(id);
+	}
+	PFNISTRANSFORMFEEDBACK IsTransformFeedback = Switch_IsTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNMINSAMPLESHADING)(GLfloat);
-	PFNMINSAMPLESHADING MinSampleShading = 0;
+	static void CODEGEN_FUNCPTR Switch_MinSampleShading(GLfloat value)
+	{
+		MinSampleShading = reinterpret_cast<PFNMINSAMPLESHADING>(IntGetProcAddress("glMinSampleShading"));
+		CheckLazyEntryPoint(MinSampleShading != 0, "glMinSampleShading");
+		return MinSampleShading(value);
+	}
+	PFNMINSAMPLESHADING MinSampleShading = Switch_MinSampleShading;
 	typedef void (CODEGEN_FUNCPTR *PFNPATCHPARAMETERFV)(GLenum, const GLfloat *);
-	PFNPATCHPARAMETERFV PatchParameterfv = 0;
+	static void CODEGEN_FUNCPTR Switch_PatchParameterfv(GLenum pname, const GLfloat * values)
+	{
+		PatchParameterfv = reinterpret_cast<PFNPATCHPARAMETERFV>(IntGetProcAddress("glPatchParameterfv"));
+		CheckLazyEntryPoint(PatchParameterfv != 0, "glPatchParameterfv");
+		return PatchParameterfv(pname, values);
+	}
+	PFNPATCHPARAMETERFV PatchParameterfv = Switch_PatchParameterfv;
 	typedef void (CODEGEN_FUNCPTR *PFNPATCHPARAMETERI)(GLenum, GLint);
-	PFNPATCHPARAMETERI PatchParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_PatchParameteri(GLenum pname, GLint value)
+	{
+		PatchParameteri = reinterpret_cast<PFNPATCHPARAMETERI>(IntGetProcAddress("glPatchParameteri"));
+		CheckLazyEntryPoint(PatchParameteri != 0, "glPatchParameteri");
+		return PatchParameteri(pname, value);
+	}
+	PFNPATCHPARAMETERI PatchParameteri = Switch_PatchParameteri;
 	typedef void (CODEGEN_FUNCPTR *PFNPAUSETRANSFORMFEEDBACK)();
-	PFNPAUSETRANSFORMFEEDBACK PauseTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_PauseTransformFeedback()
+	{
+		PauseTransformFeedback = reinterpret_cast<PFNPAUSETRANSFORMFEEDBACK>(IntGetProcAddress("glPauseTransformFeedback"));
+		CheckLazyEntryPoint(PauseTransformFeedback != 0, "glPauseTransformFeedback");
+		return PauseTransformFeedback();
+	}
+	PFNPAUSETRANSFORMFEEDBACK PauseTransformFeedback = Switch_PauseTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNRESUMETRANSFORMFEEDBACK)();
-	PFNRESUMETRANSFORMFEEDBACK ResumeTransformFeedback = 0;
+	static void CODEGEN_FUNCPTR Switch_ResumeTransformFeedback()
+	{
+		ResumeTransformFeedback = reinterpret_cast<PFNRESUMETRANSFORMFEEDBACK>(IntGetProcAddress("glResumeTransformFeedback"));
+		CheckLazyEntryPoint(ResumeTransformFeedback != 0, "glResumeTransformFeedback");
+		return ResumeTransformFeedback();
+	}
+	PFNRESUMETRANSFORMFEEDBACK ResumeTransformFeedback = Switch_ResumeTransformFeedback;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1D)(GLint, GLdouble);
-	PFNUNIFORM1D Uniform1d = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1d(GLint location, GLdouble x)
+	{
+		Uniform1d = reinterpret_cast<PFNUNIFORM1D>(IntGetProcAddress("glUniform1d"));
+		CheckLazyEntryPoint(Uniform1d != 0, "glUniform1d");
+		return Uniform1d(location, x);
+	}
+	PFNUNIFORM1D Uniform1d = Switch_Uniform1d;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM1DV)(GLint, GLsizei, const GLdouble *);
-	PFNUNIFORM1DV Uniform1dv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform1dv(GLint location, GLsizei count, const GLdouble * value)
+	{
+		Uniform1dv = reinterpret_cast<PFNUNIFORM1DV>(IntGetProcAddress("glUniform1dv"));
+		CheckLazyEntryPoint(Uniform1dv != 0, "glUniform1dv");
+		return Uniform1dv(location, count, value);
+	}
+	PFNUNIFORM1DV Uniform1dv = Switch_Uniform1dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2D)(GLint, GLdouble, GLdouble);
-	PFNUNIFORM2D Uniform2d = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2d(GLint location, GLdouble x, GLdouble y)
+	{
+		Uniform2d = reinterpret_cast<PFNUNIFORM2D>(IntGetProcAddress("glUniform2d"));
+		CheckLazyEntryPoint(Uniform2d != 0, "glUniform2d");
+		return Uniform2d(location, x, y);
+	}
+	PFNUNIFORM2D Uniform2d = Switch_Uniform2d;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM2DV)(GLint, GLsizei, const GLdouble *);
-	PFNUNIFORM2DV Uniform2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform2dv(GLint location, GLsizei count, const GLdouble * value)
+	{
+		Uniform2dv = reinterpret_cast<PFNUNIFORM2DV>(IntGetProcAddress("glUniform2dv"));
+		CheckLazyEntryPoint(Uniform2dv != 0, "glUniform2dv");
+		return Uniform2dv(location, count, value);
+	}
+	PFNUNIFORM2DV Uniform2dv = Switch_Uniform2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3D)(GLint, GLdouble, GLdouble, GLdouble);
-	PFNUNIFORM3D Uniform3d = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+	{
+		Uniform3d = reinterpret_cast<PFNUNIFORM3D>(IntGetProcAddress("glUniform3d"));
+		CheckLazyEntryPoint(Uniform3d != 0, "glUniform3d");
+		return Uniform3d(location, x, y, z);
+	}
+	PFNUNIFORM3D Uniform3d = Switch_Uniform3d;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM3DV)(GLint, GLsizei, const GLdouble *);
-	PFNUNIFORM3DV Uniform3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform3dv(GLint location, GLsizei count, const GLdouble * value)
+	{
+		Uniform3dv = reinterpret_cast<PFNUNIFORM3DV>(IntGetProcAddress("glUniform3dv"));
+		CheckLazyEntryPoint(Uniform3dv != 0, "glUniform3dv");
+		return Uniform3dv(location, count, value);
+	}
+	PFNUNIFORM3DV Uniform3dv = Switch_Uniform3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4D)(GLint, GLdouble, GLdouble, GLdouble, GLdouble);
-	PFNUNIFORM4D Uniform4d = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+	{
+		Uniform4d = reinterpret_cast<PFNUNIFORM4D>(IntGetProcAddress("glUniform4d"));
+		CheckLazyEntryPoint(Uniform4d != 0, "glUniform4d");
+		return Uniform4d(location, x, y, z, w);
+	}
+	PFNUNIFORM4D Uniform4d = Switch_Uniform4d;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORM4DV)(GLint, GLsizei, const GLdouble *);
-	PFNUNIFORM4DV Uniform4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_Uniform4dv(GLint location, GLsizei count, const GLdouble * value)
+	{
+		Uniform4dv = reinterpret_cast<PFNUNIFORM4DV>(IntGetProcAddress("glUniform4dv"));
+		CheckLazyEntryPoint(Uniform4dv != 0, "glUniform4dv");
+		return Uniform4dv(location, count, value);
+	}
+	PFNUNIFORM4DV Uniform4dv = Switch_Uniform4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX2DV UniformMatrix2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix2dv = reinterpret_cast<PFNUNIFORMMATRIX2DV>(IntGetProcAddress("glUniformMatrix2dv"));
+		CheckLazyEntryPoint(UniformMatrix2dv != 0, "glUniformMatrix2dv");
+		return UniformMatrix2dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2DV UniformMatrix2dv = Switch_UniformMatrix2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X3DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX2X3DV UniformMatrix2x3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix2x3dv = reinterpret_cast<PFNUNIFORMMATRIX2X3DV>(IntGetProcAddress("glUniformMatrix2x3dv"));
+		CheckLazyEntryPoint(UniformMatrix2x3dv != 0, "glUniformMatrix2x3dv");
+		return UniformMatrix2x3dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2X3DV UniformMatrix2x3dv = Switch_UniformMatrix2x3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX2X4DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX2X4DV UniformMatrix2x4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix2x4dv = reinterpret_cast<PFNUNIFORMMATRIX2X4DV>(IntGetProcAddress("glUniformMatrix2x4dv"));
+		CheckLazyEntryPoint(UniformMatrix2x4dv != 0, "glUniformMatrix2x4dv");
+		return UniformMatrix2x4dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX2X4DV UniformMatrix2x4dv = Switch_UniformMatrix2x4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX3DV UniformMatrix3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix3dv = reinterpret_cast<PFNUNIFORMMATRIX3DV>(IntGetProcAddress("glUniformMatrix3dv"));
+		CheckLazyEntryPoint(UniformMatrix3dv != 0, "glUniformMatrix3dv");
+		return UniformMatrix3dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3DV UniformMatrix3dv = Switch_UniformMatrix3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X2DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX3X2DV UniformMatrix3x2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix3x2dv = reinterpret_cast<PFNUNIFORMMATRIX3X2DV>(IntGetProcAddress("glUniformMatrix3x2dv"));
+		CheckLazyEntryPoint(UniformMatrix3x2dv != 0, "glUniformMatrix3x2dv");
+		return UniformMatrix3x2dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3X2DV UniformMatrix3x2dv = Switch_UniformMatrix3x2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX3X4DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX3X4DV UniformMatrix3x4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix3x4dv = reinterpret_cast<PFNUNIFORMMATRIX3X4DV>(IntGetProcAddress("glUniformMatrix3x4dv"));
+		CheckLazyEntryPoint(UniformMatrix3x4dv != 0, "glUniformMatrix3x4dv");
+		return UniformMatrix3x4dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX3X4DV UniformMatrix3x4dv = Switch_UniformMatrix3x4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX4DV UniformMatrix4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix4dv = reinterpret_cast<PFNUNIFORMMATRIX4DV>(IntGetProcAddress("glUniformMatrix4dv"));
+		CheckLazyEntryPoint(UniformMatrix4dv != 0, "glUniformMatrix4dv");
+		return UniformMatrix4dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4DV UniformMatrix4dv = Switch_UniformMatrix4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X2DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX4X2DV UniformMatrix4x2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix4x2dv = reinterpret_cast<PFNUNIFORMMATRIX4X2DV>(IntGetProcAddress("glUniformMatrix4x2dv"));
+		CheckLazyEntryPoint(UniformMatrix4x2dv != 0, "glUniformMatrix4x2dv");
+		return UniformMatrix4x2dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4X2DV UniformMatrix4x2dv = Switch_UniformMatrix4x2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMMATRIX4X3DV)(GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNUNIFORMMATRIX4X3DV UniformMatrix4x3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		UniformMatrix4x3dv = reinterpret_cast<PFNUNIFORMMATRIX4X3DV>(IntGetProcAddress("glUniformMatrix4x3dv"));
+		CheckLazyEntryPoint(UniformMatrix4x3dv != 0, "glUniformMatrix4x3dv");
+		return UniformMatrix4x3dv(location, count, transpose, value);
+	}
+	PFNUNIFORMMATRIX4X3DV UniformMatrix4x3dv = Switch_UniformMatrix4x3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNUNIFORMSUBROUTINESUIV)(GLenum, GLsizei, const GLuint *);
-	PFNUNIFORMSUBROUTINESUIV UniformSubroutinesuiv = 0;
+	static void CODEGEN_FUNCPTR Switch_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices)
+	{
+		UniformSubroutinesuiv = reinterpret_cast<PFNUNIFORMSUBROUTINESUIV>(IntGetProcAddress("glUniformSubroutinesuiv"));
+		CheckLazyEntryPoint(UniformSubroutinesuiv != 0, "glUniformSubroutinesuiv");
+		return UniformSubroutinesuiv(shadertype, count, indices);
+	}
+	PFNUNIFORMSUBROUTINESUIV UniformSubroutinesuiv = Switch_UniformSubroutinesuiv;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNACTIVESHADERPROGRAM)(GLuint, GLuint);
-	PFNACTIVESHADERPROGRAM ActiveShaderProgram = 0;
+	static void CODEGEN_FUNCPTR Switch_ActiveShaderProgram(GLuint pipeline, GLuint program)
+	{
+		ActiveShaderProgram = reinterpret_cast<PFNACTIVESHADERPROGRAM>(IntGetProcAddress("glActiveShaderProgram"));
+		CheckLazyEntryPoint(ActiveShaderProgram != 0, "glActiveShaderProgram");
+		return ActiveShaderProgram(pipeline, program);
+	}
+	PFNACTIVESHADERPROGRAM ActiveShaderProgram = Switch_ActiveShaderProgram;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDPROGRAMPIPELINE)(GLuint);
-	PFNBINDPROGRAMPIPELINE BindProgramPipeline = 0;
+	static void CODEGEN_FUNCPTR Switch_BindProgramPipeline(GLuint pipeline)
+	{
+		BindProgramPipeline = reinterpret_cast<PFNBINDPROGRAMPIPELINE>(IntGetProcAddress("glBindProgramPipeline"));
+		CheckLazyEntryPoint(BindProgramPipeline != 0, "glBindProgramPipeline");
+		return BindProgramPipeline(pipeline);
+	}
+	PFNBINDPROGRAMPIPELINE BindProgramPipeline = Switch_BindProgramPipeline;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARDEPTHF)(GLfloat);
-	PFNCLEARDEPTHF ClearDepthf = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearDepthf(GLfloat d)
+	{
+		ClearDepthf = reinterpret_cast<PFNCLEARDEPTHF>(IntGetProcAddress("glClearDepthf"));
+		CheckLazyEntryPoint(ClearDepthf != 0, "glClearDepthf");
+		return ClearDepthf(d);
+	}
+	PFNCLEARDEPTHF ClearDepthf = Switch_ClearDepthf;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNCREATESHADERPROGRAMV)(GLenum, GLsizei, const GLchar *const*);
-	PFNCREATESHADERPROGRAMV CreateShaderProgramv = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_CreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const* strings)
+	{
+		CreateShaderProgramv = reinterpret_cast<PFNCREATESHADERPROGRAMV>(IntGetProcAddress("glCreateShaderProgramv"));
+		CheckLazyEntryPoint(CreateShaderProgramv != 0, "glCreateShaderProgramv");
+		return CreateShaderProgramv(type, count, strings);
+	}
+	PFNCREATESHADERPROGRAMV CreateShaderProgramv = Switch_CreateShaderProgramv;
 	typedef void (CODEGEN_FUNCPTR *PFNDELETEPROGRAMPIPELINES)(GLsizei, const GLuint *);
-	PFNDELETEPROGRAMPIPELINES DeleteProgramPipelines = 0;
+	static void CODEGEN_FUNCPTR Switch_DeleteProgramPipelines(GLsizei n, const GLuint * pipelines)
+	{
+		DeleteProgramPipelines = reinterpret_cast<PFNDELETEPROGRAMPIPELINES>(IntGetProcAddress("glDeleteProgramPipelines"));
+		CheckLazyEntryPoint(DeleteProgramPipelines != 0, "glDeleteProgramPipelines");
+		return DeleteProgramPipelines(n, pipelines);
+	}
+	PFNDELETEPROGRAMPIPELINES DeleteProgramPipelines = Switch_DeleteProgramPipelines;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGEARRAYV)(GLuint, GLsizei, const GLdouble *);
-	PFNDEPTHRANGEARRAYV DepthRangeArrayv = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v)
+	{
+		DepthRangeArrayv = reinterpret_cast<PFNDEPTHRANGEARRAYV>(IntGetProcAddress("glDepthRangeArrayv"));
+		CheckLazyEntryPoint(DepthRangeArrayv != 0, "glDepthRangeArrayv");
+		return DepthRangeArrayv(first, count, v);
+	}
+	PFNDEPTHRANGEARRAYV DepthRangeArrayv = Switch_DepthRangeArrayv;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGEINDEXED)(GLuint, GLdouble, GLdouble);
-	PFNDEPTHRANGEINDEXED DepthRangeIndexed = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
+	{
+		DepthRangeIndexed = reinterpret_cast<PFNDEPTHRANGEINDEXED>(IntGetProcAddress("glDepthRangeIndexed"));
+		CheckLazyEntryPoint(DepthRangeIndexed != 0, "glDepthRangeIndexed");
+		return DepthRangeIndexed(index, n, f);
+	}
+	PFNDEPTHRANGEINDEXED DepthRangeIndexed = Switch_DepthRangeIndexed;
 	typedef void (CODEGEN_FUNCPTR *PFNDEPTHRANGEF)(GLfloat, GLfloat);
-	PFNDEPTHRANGEF DepthRangef = 0;
+	static void CODEGEN_FUNCPTR Switch_DepthRangef(GLfloat n, GLfloat f)
+	{
+		DepthRangef = reinterpret_cast<PFNDEPTHRANGEF>(IntGetProcAddress("glDepthRangef"));
+		CheckLazyEntryPoint(DepthRangef != 0, "glDepthRangef");
+		return DepthRangef(n, f);
+	}
+	PFNDEPTHRANGEF DepthRangef = Switch_DepthRangef;
 	typedef void (CODEGEN_FUNCPTR *PFNGENPROGRAMPIPELINES)(GLsizei, GLuint *);
-	PFNGENPROGRAMPIPELINES GenProgramPipelines = 0;
+	static void CODEGEN_FUNCPTR Switch_GenProgramPipelines(GLsizei n, GLuint * pipelines)
+	{
+		GenProgramPipelines = reinterpret_cast<PFNGENPROGRAMPIPELINES>(IntGetProcAddress("glGenProgramPipelines"));
+		CheckLazyEntryPoint(GenProgramPipelines != 0, "glGenProgramPipelines");
+		return GenProgramPipelines(n, pipelines);
+	}
+	PFNGENPROGRAMPIPELINES GenProgramPipelines = Switch_GenProgramPipelines;
 	typedef void (CODEGEN_FUNCPTR *PFNGETDOUBLEI_V)(GLenum, GLuint, GLdouble *);
-	PFNGETDOUBLEI_V GetDoublei_v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetDoublei_v(GLenum target, GLuint index, GLdouble * data)
+	{
+		GetDoublei_v = reinterpret_cast<PFNGETDOUBLEI_V>(IntGetProcAddress("glGetDoublei_v"));
+		CheckLazyEntryPoint(GetDoublei_v != 0, "glGetDoublei_v");
+		return GetDoublei_v(target, index, data);
+	}
+	PFNGETDOUBLEI_V GetDoublei_v = Switch_GetDoublei_v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETFLOATI_V)(GLenum, GLuint, GLfloat *);
-	PFNGETFLOATI_V GetFloati_v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetFloati_v(GLenum target, GLuint index, GLfloat * data)
+	{
+		GetFloati_v = reinterpret_cast<PFNGETFLOATI_V>(IntGetProcAddress("glGetFloati_v"));
+		CheckLazyEntryPoint(GetFloati_v != 0, "glGetFloati_v");
+		return GetFloati_v(target, index, data);
+	}
+	PFNGETFLOATI_V GetFloati_v = Switch_GetFloati_v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMBINARY)(GLuint, GLsizei, GLsizei *, GLenum *, void *);
-	PFNGETPROGRAMBINARY GetProgramBinary = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary)
+	{
+		GetProgramBinary = reinterpret_cast<PFNGETPROGRAMBINARY>(IntGetProcAddress("glGetProgramBinary"));
+		CheckLazyEntryPoint(GetProgramBinary != 0, "glGetProgramBinary");
+		return GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	}
+	PFNGETPROGRAMBINARY GetProgramBinary = Switch_GetProgramBinary;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMPIPELINEINFOLOG)(GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETPROGRAMPIPELINEINFOLOG GetProgramPipelineInfoLog = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog)
+	{
+		GetProgramPipelineInfoLog = reinterpret_cast<PFNGETPROGRAMPIPELINEINFOLOG>(IntGetProcAddress("glGetProgramPipelineInfoLog"));
+		CheckLazyEntryPoint(GetProgramPipelineInfoLog != 0, "glGetProgramPipelineInfoLog");
+		return GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	}
+	PFNGETPROGRAMPIPELINEINFOLOG GetProgramPipelineInfoLog = Switch_GetProgramPipelineInfoLog;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMPIPELINEIV)(GLuint, GLenum, GLint *);
-	PFNGETPROGRAMPIPELINEIV GetProgramPipelineiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params)
+	{
+		GetProgramPipelineiv = reinterpret_cast<PFNGETPROGRAMPIPELINEIV>(IntGetProcAddress("glGetProgramPipelineiv"));
+		CheckLazyEntryPoint(GetProgramPipelineiv != 0, "glGetProgramPipelineiv");
+		return GetProgramPipelineiv(pipeline, pname, params);
+	}
+	PFNGETPROGRAMPIPELINEIV GetProgramPipelineiv = Switch_GetProgramPipelineiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETSHADERPRECISIONFORMAT)(GLenum, GLenum, GLint *, GLint *);
-	PFNGETSHADERPRECISIONFORMAT GetShaderPrecisionFormat = 0;
+	static void CODEGEN_FUNCPTR Switch_GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision)
+	{
+		GetShaderPrecisionFormat = reinterpret_cast<PFNGETSHADERPRECISIONFORMAT>(IntGetProcAddress("glGetShaderPrecisionFormat"));
+		CheckLazyEntryPoint(GetShaderPrecisionFormat != 0, "glGetShaderPrecisionFormat");
+		return GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	}
+	PFNGETSHADERPRECISIONFORMAT GetShaderPrecisionFormat = Switch_GetShaderPrecisionFormat;
 	typedef void (CODEGEN_FUNCPTR *PFNGETVERTEXATTRIBLDV)(GLuint, GLenum, GLdouble *);
-	PFNGETVERTEXATTRIBLDV GetVertexAttribLdv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params)
+	{
+		GetVertexAttribLdv = reinterpret_cast<PFNGETVERTEXATTRIBLDV>(IntGetProcAddress("glGetVertexAttribLdv"));
+		CheckLazyEntryPoint(GetVertexAttribLdv != 0, "glGetVertexAttribLdv");
+		return GetVertexAttribLdv(index, pname, params);
+	}
+	PFNGETVERTEXATTRIBLDV GetVertexAttribLdv = Switch_GetVertexAttribLdv;
 	typedef GLboolean (CODEGEN_FUNCPTR *PFNISPROGRAMPIPELINE)(GLuint);
-	PFNISPROGRAMPIPELINE IsProgramPipeline = 0;
+	static GLboolean CODEGEN_FUNCPTR Switch_IsProgramPipeline(GLuint pipeline)
+	{
+		IsProgramPipeline = reinterpret_cast<PFNISPROGRAMPIPELINE>(IntGetProcAddress("glIsProgramPipeline"));
+		CheckLazyEntryPoint(IsProgramPipeline != 0, "glIsProgramPipeline");
+		return IsProgramPipeline(pipeline);
+	}
+	PFNISPROGRAMPIPELINE IsProgramPipeline = Switch_IsProgramPipeline;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMBINARY)(GLuint, GLenum, const void *, GLsizei);
-	PFNPROGRAMBINARY ProgramBinary = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length)
+	{
+		ProgramBinary = reinterpret_cast<PFNPROGRAMBINARY>(IntGetProcAddress("glProgramBinary"));
+		CheckLazyEntryPoint(ProgramBinary != 0, "glProgramBinary");
+		return ProgramBinary(program, binaryFormat, binary, length);
+	}
+	PFNPROGRAMBINARY ProgramBinary = Switch_ProgramBinary;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMPARAMETERI)(GLuint, GLenum, GLint);
-	PFNPROGRAMPARAMETERI ProgramParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramParameteri(GLuint program, GLenum pname, GLint value)
+	{
+		ProgramParameteri = reinterpret_cast<PFNPROGRAMPARAMETERI>(IntGetProcAddress("glProgramParameteri"));
+		CheckLazyEntryPoint(ProgramParameteri != 0, "glProgramParameteri");
+		return ProgramParameteri(program, pname, value);
+	}
+	PFNPROGRAMPARAMETERI ProgramParameteri = Switch_ProgramParameteri;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1D)(GLuint, GLint, GLdouble);
-	PFNPROGRAMUNIFORM1D ProgramUniform1d = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1d(GLuint program, GLint location, GLdouble v0)
+	{
+		ProgramUniform1d = reinterpret_cast<PFNPROGRAMUNIFORM1D>(IntGetProcAddress("glProgramUniform1d"));
+		CheckLazyEntryPoint(ProgramUniform1d != 0, "glProgramUniform1d");
+		return ProgramUniform1d(program, location, v0);
+	}
+	PFNPROGRAMUNIFORM1D ProgramUniform1d = Switch_ProgramUniform1d;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1DV)(GLuint, GLint, GLsizei, const GLdouble *);
-	PFNPROGRAMUNIFORM1DV ProgramUniform1dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+	{
+		ProgramUniform1dv = reinterpret_cast<PFNPROGRAMUNIFORM1DV>(IntGetProcAddress("glProgramUniform1dv"));
+		CheckLazyEntryPoint(ProgramUniform1dv != 0, "glProgramUniform1dv");
+		return ProgramUniform1dv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM1DV ProgramUniform1dv = Switch_ProgramUniform1dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1F)(GLuint, GLint, GLfloat);
-	PFNPROGRAMUNIFORM1F ProgramUniform1f = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
+	{
+		ProgramUniform1f = reinterpret_cast<PFNPROGRAMUNIFORM1F>(IntGetProcAddress("glProgramUniform1f"));
+		CheckLazyEntryPoint(ProgramUniform1f != 0, "glProgramUniform1f");
+		return ProgramUniform1f(program, location, v0);
+	}
+	PFNPROGRAMUNIFORM1F ProgramUniform1f = Switch_ProgramUniform1f;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1FV)(GLuint, GLint, GLsizei, const GLfloat *);
-	PFNPROGRAMUNIFORM1FV ProgramUniform1fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+	{
+		ProgramUniform1fv = reinterpret_cast<PFNPROGRAMUNIFORM1FV>(IntGetProcAddress("glProgramUniform1fv"));
+		CheckLazyEntryPoint(ProgramUniform1fv != 0, "glProgramUniform1fv");
+		return ProgramUniform1fv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM1FV ProgramUniform1fv = Switch_ProgramUniform1fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1I)(GLuint, GLint, GLint);
-	PFNPROGRAMUNIFORM1I ProgramUniform1i = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1i(GLuint program, GLint location, GLint v0)
+	{
+		ProgramUniform1i = reinterpret_cast<PFNPROGRAMUNIFORM1I>(IntGetProcAddress("glProgramUniform1i"));
+		CheckLazyEntryPoint(ProgramUniform1i != 0, "glProgramUniform1i");
+		return ProgramUniform1i(program, location, v0);
+	}
+	PFNPROGRAMUNIFORM1I ProgramUniform1i = Switch_ProgramUniform1i;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1IV)(GLuint, GLint, GLsizei, const GLint *);
-	PFNPROGRAMUNIFORM1IV ProgramUniform1iv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+	{
+		ProgramUniform1iv = reinterpret_cast<PFNPROGRAMUNIFORM1IV>(IntGetProcAddress("glProgramUniform1iv"));
+		CheckLazyEntryPoint(ProgramUniform1iv != 0, "glProgramUniform1iv");
+		return ProgramUniform1iv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM1IV ProgramUniform1iv = Switch_ProgramUniform1iv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1UI)(GLuint, GLint, GLuint);
-	PFNPROGRAMUNIFORM1UI ProgramUniform1ui = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
+	{
+		ProgramUniform1ui = reinterpret_cast<PFNPROGRAMUNIFORM1UI>(IntGetProcAddress("glProgramUniform1ui"));
+		CheckLazyEntryPoint(ProgramUniform1ui != 0, "glProgramUniform1ui");
+		return ProgramUniform1ui(program, location, v0);
+	}
+	PFNPROGRAMUNIFORM1UI ProgramUniform1ui = Switch_ProgramUniform1ui;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM1UIV)(GLuint, GLint, GLsizei, const GLuint *);
-	PFNPROGRAMUNIFORM1UIV ProgramUniform1uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+	{
+		ProgramUniform1uiv = reinterpret_cast<PFNPROGRAMUNIFORM1UIV>(IntGetProcAddress("glProgramUniform1uiv"));
+		CheckLazyEntryPoint(ProgramUniform1uiv != 0, "glProgramUniform1uiv");
+		return ProgramUniform1uiv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM1UIV ProgramUniform1uiv = Switch_ProgramUniform1uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2D)(GLuint, GLint, GLdouble, GLdouble);
-	PFNPROGRAMUNIFORM2D ProgramUniform2d = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
+	{
+		ProgramUniform2d = reinterpret_cast<PFNPROGRAMUNIFORM2D>(IntGetProcAddress("glProgramUniform2d"));
+		CheckLazyEntryPoint(ProgramUniform2d != 0, "glProgramUniform2d");
+		return ProgramUniform2d(program, location, v0, v1);
+	}
+	PFNPROGRAMUNIFORM2D ProgramUniform2d = Switch_ProgramUniform2d;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2DV)(GLuint, GLint, GLsizei, const GLdouble *);
-	PFNPROGRAMUNIFORM2DV ProgramUniform2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+	{
+		ProgramUniform2dv = reinterpret_cast<PFNPROGRAMUNIFORM2DV>(IntGetProcAddress("glProgramUniform2dv"));
+		CheckLazyEntryPoint(ProgramUniform2dv != 0, "glProgramUniform2dv");
+		return ProgramUniform2dv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM2DV ProgramUniform2dv = Switch_ProgramUniform2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2F)(GLuint, GLint, GLfloat, GLfloat);
-	PFNPROGRAMUNIFORM2F ProgramUniform2f = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+	{
+		ProgramUniform2f = reinterpret_cast<PFNPROGRAMUNIFORM2F>(IntGetProcAddress("glProgramUniform2f"));
+		CheckLazyEntryPoint(ProgramUniform2f != 0, "glProgramUniform2f");
+		return ProgramUniform2f(program, location, v0, v1);
+	}
+	PFNPROGRAMUNIFORM2F ProgramUniform2f = Switch_ProgramUniform2f;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2FV)(GLuint, GLint, GLsizei, const GLfloat *);
-	PFNPROGRAMUNIFORM2FV ProgramUniform2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+	{
+		ProgramUniform2fv = reinterpret_cast<PFNPROGRAMUNIFORM2FV>(IntGetProcAddress("glProgramUniform2fv"));
+		CheckLazyEntryPoint(ProgramUniform2fv != 0, "glProgramUniform2fv");
+		return ProgramUniform2fv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM2FV ProgramUniform2fv = Switch_ProgramUniform2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2I)(GLuint, GLint, GLint, GLint);
-	PFNPROGRAMUNIFORM2I ProgramUniform2i = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
+	{
+		ProgramUniform2i = reinterpret_cast<PFNPROGRAMUNIFORM2I>(IntGetProcAddress("glProgramUniform2i"));
+		CheckLazyEntryPoint(ProgramUniform2i != 0, "glProgramUniform2i");
+		return ProgramUniform2i(program, location, v0, v1);
+	}
+	PFNPROGRAMUNIFORM2I ProgramUniform2i = Switch_ProgramUniform2i;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2IV)(GLuint, GLint, GLsizei, const GLint *);
-	PFNPROGRAMUNIFORM2IV ProgramUniform2iv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+	{
+		ProgramUniform2iv = reinterpret_cast<PFNPROGRAMUNIFORM2IV>(IntGetProcAddress("glProgramUniform2iv"));
+		CheckLazyEntryPoint(ProgramUniform2iv != 0, "glProgramUniform2iv");
+		return ProgramUniform2iv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM2IV ProgramUniform2iv = Switch_ProgramUniform2iv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2UI)(GLuint, GLint, GLuint, GLuint);
-	PFNPROGRAMUNIFORM2UI ProgramUniform2ui = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
+	{
+		ProgramUniform2ui = reinterpret_cast<PFNPROGRAMUNIFORM2UI>(IntGetProcAddress("glProgramUniform2ui"));
+		CheckLazyEntryPoint(ProgramUniform2ui != 0, "glProgramUniform2ui");
+		return ProgramUniform2ui(program, location, v0, v1);
+	}
+	PFNPROGRAMUNIFORM2UI ProgramUniform2ui = Switch_ProgramUniform2ui;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM2UIV)(GLuint, GLint, GLsizei, const GLuint *);
-	PFNPROGRAMUNIFORM2UIV ProgramUniform2uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+	{
+		ProgramUniform2uiv = reinterpret_cast<PFNPROGRAMUNIFORM2UIV>(IntGetProcAddress("glProgramUniform2uiv"));
+		CheckLazyEntryPoint(ProgramUniform2uiv != 0, "glProgramUniform2uiv");
+		return ProgramUniform2uiv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM2UIV ProgramUniform2uiv = Switch_ProgramUniform2uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3D)(GLuint, GLint, GLdouble, GLdouble, GLdouble);
-	PFNPROGRAMUNIFORM3D ProgramUniform3d = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+	{
+		ProgramUniform3d = reinterpret_cast<PFNPROGRAMUNIFORM3D>(IntGetProcAddress("glProgramUniform3d"));
+		CheckLazyEntryPoint(ProgramUniform3d != 0, "glProgramUniform3d");
+		return ProgramUniform3d(program, location, v0, v1, v2);
+	}
+	PFNPROGRAMUNIFORM3D ProgramUniform3d = Switch_ProgramUniform3d;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3DV)(GLuint, GLint, GLsizei, const GLdouble *);
-	PFNPROGRAMUNIFORM3DV ProgramUniform3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+	{
+		ProgramUniform3dv = reinterpret_cast<PFNPROGRAMUNIFORM3DV>(IntGetProcAddress("glProgramUniform3dv"));
+		CheckLazyEntryPoint(ProgramUniform3dv != 0, "glProgramUniform3dv");
+		return ProgramUniform3dv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM3DV ProgramUniform3dv = Switch_ProgramUniform3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3F)(GLuint, GLint, GLfloat, GLfloat, GLfloat);
-	PFNPROGRAMUNIFORM3F ProgramUniform3f = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+	{
+		ProgramUniform3f = reinterpret_cast<PFNPROGRAMUNIFORM3F>(IntGetProcAddress("glProgramUniform3f"));
+		CheckLazyEntryPoint(ProgramUniform3f != 0, "glProgramUniform3f");
+		return ProgramUniform3f(program, location, v0, v1, v2);
+	}
+	PFNPROGRAMUNIFORM3F ProgramUniform3f = Switch_ProgramUniform3f;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3FV)(GLuint, GLint, GLsizei, const GLfloat *);
-	PFNPROGRAMUNIFORM3FV ProgramUniform3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+	{
+		ProgramUniform3fv = reinterpret_cast<PFNPROGRAMUNIFORM3FV>(IntGetProcAddress("glProgramUniform3fv"));
+		CheckLazyEntryPoint(ProgramUniform3fv != 0, "glProgramUniform3fv");
+		return ProgramUniform3fv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM3FV ProgramUniform3fv = Switch_ProgramUniform3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3I)(GLuint, GLint, GLint, GLint, GLint);
-	PFNPROGRAMUNIFORM3I ProgramUniform3i = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+	{
+		ProgramUniform3i = reinterpret_cast<PFNPROGRAMUNIFORM3I>(IntGetProcAddress("glProgramUniform3i"));
+		CheckLazyEntryPoint(ProgramUniform3i != 0, "glProgramUniform3i");
+		return ProgramUniform3i(program, location, v0, v1, v2);
+	}
+	PFNPROGRAMUNIFORM3I ProgramUniform3i = Switch_ProgramUniform3i;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3IV)(GLuint, GLint, GLsizei, const GLint *);
-	PFNPROGRAMUNIFORM3IV ProgramUniform3iv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+	{
+		ProgramUniform3iv = reinterpret_cast<PFNPROGRAMUNIFORM3IV>(IntGetProcAddress("glProgramUniform3iv"));
+		CheckLazyEntryPoint(ProgramUniform3iv != 0, "glProgramUniform3iv");
+		return ProgramUniform3iv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM3IV ProgramUniform3iv = Switch_ProgramUniform3iv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3UI)(GLuint, GLint, GLuint, GLuint, GLuint);
-	PFNPROGRAMUNIFORM3UI ProgramUniform3ui = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+	{
+		ProgramUniform3ui = reinterpret_cast<PFNPROGRAMUNIFORM3UI>(IntGetProcAddress("glProgramUniform3ui"));
+		CheckLazyEntryPoint(ProgramUniform3ui != 0, "glProgramUniform3ui");
+		return ProgramUniform3ui(program, location, v0, v1, v2);
+	}
+	PFNPROGRAMUNIFORM3UI ProgramUniform3ui = Switch_ProgramUniform3ui;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM3UIV)(GLuint, GLint, GLsizei, const GLuint *);
-	PFNPROGRAMUNIFORM3UIV ProgramUniform3uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+	{
+		ProgramUniform3uiv = reinterpret_cast<PFNPROGRAMUNIFORM3UIV>(IntGetProcAddress("glProgramUniform3uiv"));
+		CheckLazyEntryPoint(ProgramUniform3uiv != 0, "glProgramUniform3uiv");
+		return ProgramUniform3uiv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM3UIV ProgramUniform3uiv = Switch_ProgramUniform3uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4D)(GLuint, GLint, GLdouble, GLdouble, GLdouble, GLdouble);
-	PFNPROGRAMUNIFORM4D ProgramUniform4d = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
+	{
+		ProgramUniform4d = reinterpret_cast<PFNPROGRAMUNIFORM4D>(IntGetProcAddress("glProgramUniform4d"));
+		CheckLazyEntryPoint(ProgramUniform4d != 0, "glProgramUniform4d");
+		return ProgramUniform4d(program, location, v0, v1, v2, v3);
+	}
+	PFNPROGRAMUNIFORM4D ProgramUniform4d = Switch_ProgramUniform4d;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4DV)(GLuint, GLint, GLsizei, const GLdouble *);
-	PFNPROGRAMUNIFORM4DV ProgramUniform4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value)
+	{
+		ProgramUniform4dv = reinterpret_cast<PFNPROGRAMUNIFORM4DV>(IntGetProcAddress("glProgramUniform4dv"));
+		CheckLazyEntryPoint(ProgramUniform4dv != 0, "glProgramUniform4dv");
+		return ProgramUniform4dv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM4DV ProgramUniform4dv = Switch_ProgramUniform4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4F)(GLuint, GLint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNPROGRAMUNIFORM4F ProgramUniform4f = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+	{
+		ProgramUniform4f = reinterpret_cast<PFNPROGRAMUNIFORM4F>(IntGetProcAddress("glProgramUniform4f"));
+		CheckLazyEntryPoint(ProgramUniform4f != 0, "glProgramUniform4f");
+		return ProgramUniform4f(program, location, v0, v1, v2, v3);
+	}
+	PFNPROGRAMUNIFORM4F ProgramUniform4f = Switch_ProgramUniform4f;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4FV)(GLuint, GLint, GLsizei, const GLfloat *);
-	PFNPROGRAMUNIFORM4FV ProgramUniform4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value)
+	{
+		ProgramUniform4fv = reinterpret_cast<PFNPROGRAMUNIFORM4FV>(IntGetProcAddress("glProgramUniform4fv"));
+		CheckLazyEntryPoint(ProgramUniform4fv != 0, "glProgramUniform4fv");
+		return ProgramUniform4fv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM4FV ProgramUniform4fv = Switch_ProgramUniform4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4I)(GLuint, GLint, GLint, GLint, GLint, GLint);
-	PFNPROGRAMUNIFORM4I ProgramUniform4i = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+	{
+		ProgramUniform4i = reinterpret_cast<PFNPROGRAMUNIFORM4I>(IntGetProcAddress("glProgramUniform4i"));
+		CheckLazyEntryPoint(ProgramUniform4i != 0, "glProgramUniform4i");
+		return ProgramUniform4i(program, location, v0, v1, v2, v3);
+	}
+	PFNPROGRAMUNIFORM4I ProgramUniform4i = Switch_ProgramUniform4i;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4IV)(GLuint, GLint, GLsizei, const GLint *);
-	PFNPROGRAMUNIFORM4IV ProgramUniform4iv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value)
+	{
+		ProgramUniform4iv = reinterpret_cast<PFNPROGRAMUNIFORM4IV>(IntGetProcAddress("glProgramUniform4iv"));
+		CheckLazyEntryPoint(ProgramUniform4iv != 0, "glProgramUniform4iv");
+		return ProgramUniform4iv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM4IV ProgramUniform4iv = Switch_ProgramUniform4iv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4UI)(GLuint, GLint, GLuint, GLuint, GLuint, GLuint);
-	PFNPROGRAMUNIFORM4UI ProgramUniform4ui = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+	{
+		ProgramUniform4ui = reinterpret_cast<PFNPROGRAMUNIFORM4UI>(IntGetProcAddress("glProgramUniform4ui"));
+		CheckLazyEntryPoint(ProgramUniform4ui != 0, "glProgramUniform4ui");
+		return ProgramUniform4ui(program, location, v0, v1, v2, v3);
+	}
+	PFNPROGRAMUNIFORM4UI ProgramUniform4ui = Switch_ProgramUniform4ui;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORM4UIV)(GLuint, GLint, GLsizei, const GLuint *);
-	PFNPROGRAMUNIFORM4UIV ProgramUniform4uiv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value)
+	{
+		ProgramUniform4uiv = reinterpret_cast<PFNPROGRAMUNIFORM4UIV>(IntGetProcAddress("glProgramUniform4uiv"));
+		CheckLazyEntryPoint(ProgramUniform4uiv != 0, "glProgramUniform4uiv");
+		return ProgramUniform4uiv(program, location, count, value);
+	}
+	PFNPROGRAMUNIFORM4UIV ProgramUniform4uiv = Switch_ProgramUniform4uiv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX2DV ProgramUniformMatrix2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix2dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2DV>(IntGetProcAddress("glProgramUniformMatrix2dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2dv != 0, "glProgramUniformMatrix2dv");
+		return ProgramUniformMatrix2dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2DV ProgramUniformMatrix2dv = Switch_ProgramUniformMatrix2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX2FV ProgramUniformMatrix2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix2fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2FV>(IntGetProcAddress("glProgramUniformMatrix2fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2fv != 0, "glProgramUniformMatrix2fv");
+		return ProgramUniformMatrix2fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2FV ProgramUniformMatrix2fv = Switch_ProgramUniformMatrix2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2X3DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX2X3DV ProgramUniformMatrix2x3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix2x3dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X3DV>(IntGetProcAddress("glProgramUniformMatrix2x3dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2x3dv != 0, "glProgramUniformMatrix2x3dv");
+		return ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2X3DV ProgramUniformMatrix2x3dv = Switch_ProgramUniformMatrix2x3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2X3FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX2X3FV ProgramUniformMatrix2x3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix2x3fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X3FV>(IntGetProcAddress("glProgramUniformMatrix2x3fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2x3fv != 0, "glProgramUniformMatrix2x3fv");
+		return ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2X3FV ProgramUniformMatrix2x3fv = Switch_ProgramUniformMatrix2x3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2X4DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX2X4DV ProgramUniformMatrix2x4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix2x4dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X4DV>(IntGetProcAddress("glProgramUniformMatrix2x4dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2x4dv != 0, "glProgramUniformMatrix2x4dv");
+		return ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2X4DV ProgramUniformMatrix2x4dv = Switch_ProgramUniformMatrix2x4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX2X4FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX2X4FV ProgramUniformMatrix2x4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix2x4fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X4FV>(IntGetProcAddress("glProgramUniformMatrix2x4fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix2x4fv != 0, "glProgramUniformMatrix2x4fv");
+		return ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX2X4FV ProgramUniformMatrix2x4fv = Switch_ProgramUniformMatrix2x4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX3DV ProgramUniformMatrix3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix3dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3DV>(IntGetProcAddress("glProgramUniformMatrix3dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3dv != 0, "glProgramUniformMatrix3dv");
+		return ProgramUniformMatrix3dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3DV ProgramUniformMatrix3dv = Switch_ProgramUniformMatrix3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX3FV ProgramUniformMatrix3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix3fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3FV>(IntGetProcAddress("glProgramUniformMatrix3fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3fv != 0, "glProgramUniformMatrix3fv");
+		return ProgramUniformMatrix3fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3FV ProgramUniformMatrix3fv = Switch_ProgramUniformMatrix3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3X2DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX3X2DV ProgramUniformMatrix3x2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix3x2dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X2DV>(IntGetProcAddress("glProgramUniformMatrix3x2dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3x2dv != 0, "glProgramUniformMatrix3x2dv");
+		return ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3X2DV ProgramUniformMatrix3x2dv = Switch_ProgramUniformMatrix3x2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3X2FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX3X2FV ProgramUniformMatrix3x2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix3x2fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X2FV>(IntGetProcAddress("glProgramUniformMatrix3x2fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3x2fv != 0, "glProgramUniformMatrix3x2fv");
+		return ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3X2FV ProgramUniformMatrix3x2fv = Switch_ProgramUniformMatrix3x2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3X4DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX3X4DV ProgramUniformMatrix3x4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix3x4dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X4DV>(IntGetProcAddress("glProgramUniformMatrix3x4dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3x4dv != 0, "glProgramUniformMatrix3x4dv");
+		return ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3X4DV ProgramUniformMatrix3x4dv = Switch_ProgramUniformMatrix3x4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX3X4FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX3X4FV ProgramUniformMatrix3x4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix3x4fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X4FV>(IntGetProcAddress("glProgramUniformMatrix3x4fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix3x4fv != 0, "glProgramUniformMatrix3x4fv");
+		return ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX3X4FV ProgramUniformMatrix3x4fv = Switch_ProgramUniformMatrix3x4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX4DV ProgramUniformMatrix4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix4dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4DV>(IntGetProcAddress("glProgramUniformMatrix4dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4dv != 0, "glProgramUniformMatrix4dv");
+		return ProgramUniformMatrix4dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4DV ProgramUniformMatrix4dv = Switch_ProgramUniformMatrix4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX4FV ProgramUniformMatrix4fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix4fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4FV>(IntGetProcAddress("glProgramUniformMatrix4fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4fv != 0, "glProgramUniformMatrix4fv");
+		return ProgramUniformMatrix4fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4FV ProgramUniformMatrix4fv = Switch_ProgramUniformMatrix4fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4X2DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX4X2DV ProgramUniformMatrix4x2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix4x2dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X2DV>(IntGetProcAddress("glProgramUniformMatrix4x2dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4x2dv != 0, "glProgramUniformMatrix4x2dv");
+		return ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4X2DV ProgramUniformMatrix4x2dv = Switch_ProgramUniformMatrix4x2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4X2FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX4X2FV ProgramUniformMatrix4x2fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix4x2fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X2FV>(IntGetProcAddress("glProgramUniformMatrix4x2fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4x2fv != 0, "glProgramUniformMatrix4x2fv");
+		return ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4X2FV ProgramUniformMatrix4x2fv = Switch_ProgramUniformMatrix4x2fv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4X3DV)(GLuint, GLint, GLsizei, GLboolean, const GLdouble *);
-	PFNPROGRAMUNIFORMMATRIX4X3DV ProgramUniformMatrix4x3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value)
+	{
+		ProgramUniformMatrix4x3dv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X3DV>(IntGetProcAddress("glProgramUniformMatrix4x3dv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4x3dv != 0, "glProgramUniformMatrix4x3dv");
+		return ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4X3DV ProgramUniformMatrix4x3dv = Switch_ProgramUniformMatrix4x3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNPROGRAMUNIFORMMATRIX4X3FV)(GLuint, GLint, GLsizei, GLboolean, const GLfloat *);
-	PFNPROGRAMUNIFORMMATRIX4X3FV ProgramUniformMatrix4x3fv = 0;
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+	{
+		ProgramUniformMatrix4x3fv = reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X3FV>(IntGetProcAddress("glProgramUniformMatrix4x3fv"));
+		CheckLazyEntryPoint(ProgramUniformMatrix4x3fv != 0, "glProgramUniformMatrix4x3fv");
+		return ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	}
+	PFNPROGRAMUNIFORMMATRIX4X3FV ProgramUniformMatrix4x3fv = Switch_ProgramUniformMatrix4x3fv;
 	typedef void (CODEGEN_FUNCPTR *PFNRELEASESHADERCOMPILER)();
-	PFNRELEASESHADERCOMPILER ReleaseShaderCompiler = 0;
+	static void CODEGEN_FUNCPTR Switch_ReleaseShaderCompiler()
+	{
+		ReleaseShaderCompiler = reinterpret_cast<PFNRELEASESHADERCOMPILER>(IntGetProcAddress("glReleaseShaderCompiler"));
+		CheckLazyEntryPoint(ReleaseShaderCompiler != 0, "glReleaseShaderCompiler");
+		return ReleaseShaderCompiler();
+	}
+	PFNRELEASESHADERCOMPILER ReleaseShaderCompiler = Switch_ReleaseShaderCompiler;
 	typedef void (CODEGEN_FUNCPTR *PFNSCISSORARRAYV)(GLuint, GLsizei, const GLint *);
-	PFNSCISSORARRAYV ScissorArrayv = 0;
+	static void CODEGEN_FUNCPTR Switch_ScissorArrayv(GLuint first, GLsizei count, const GLint * v)
+	{
+		ScissorArrayv = reinterpret_cast<PFNSCISSORARRAYV>(IntGetProcAddress("glScissorArrayv"));
+		CheckLazyEntryPoint(ScissorArrayv != 0, "glScissorArrayv");
+		return ScissorArrayv(first, count, v);
+	}
+	PFNSCISSORARRAYV ScissorArrayv = Switch_ScissorArrayv;
 	typedef void (CODEGEN_FUNCPTR *PFNSCISSORINDEXED)(GLuint, GLint, GLint, GLsizei, GLsizei);
-	PFNSCISSORINDEXED ScissorIndexed = 0;
+	static void CODEGEN_FUNCPTR Switch_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+	{
+		ScissorIndexed = reinterpret_cast<PFNSCISSORINDEXED>(IntGetProcAddress("glScissorIndexed"));
+		CheckLazyEntryPoint(ScissorIndexed != 0, "glScissorIndexed");
+		return ScissorIndexed(index, left, bottom, width, height);
+	}
+	PFNSCISSORINDEXED ScissorIndexed = Switch_ScissorIndexed;
 	typedef void (CODEGEN_FUNCPTR *PFNSCISSORINDEXEDV)(GLuint, const GLint *);
-	PFNSCISSORINDEXEDV ScissorIndexedv = 0;
+	static void CODEGEN_FUNCPTR Switch_ScissorIndexedv(GLuint index, const GLint * v)
+	{
+		ScissorIndexedv = reinterpret_cast<PFNSCISSORINDEXEDV>(IntGetProcAddress("glScissorIndexedv"));
+		CheckLazyEntryPoint(ScissorIndexedv != 0, "glScissorIndexedv");
+		return ScissorIndexedv(index, v);
+	}
+	PFNSCISSORINDEXEDV ScissorIndexedv = Switch_ScissorIndexedv;
 	typedef void (CODEGEN_FUNCPTR *PFNSHADERBINARY)(GLsizei, const GLuint *, GLenum, const void *, GLsizei);
-	PFNSHADERBINARY ShaderBinary = 0;
+	static void CODEGEN_FUNCPTR Switch_ShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryformat, const void * binary, GLsizei length)
+	{
+		ShaderBinary = reinterpret_cast<PFNSHADERBINARY>(IntGetProcAddress("glShaderBinary"));
+		CheckLazyEntryPoint(ShaderBinary != 0, "glShaderBinary");
+		return ShaderBinary(count, shaders, binaryformat, binary, length);
+	}
+	PFNSHADERBINARY ShaderBinary = Switch_ShaderBinary;
 	typedef void (CODEGEN_FUNCPTR *PFNUSEPROGRAMSTAGES)(GLuint, GLbitfield, GLuint);
-	PFNUSEPROGRAMSTAGES UseProgramStages = 0;
+	static void CODEGEN_FUNCPTR Switch_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
+	{
+		UseProgramStages = reinterpret_cast<PFNUSEPROGRAMSTAGES>(IntGetProcAddress("glUseProgramStages"));
+		CheckLazyEntryPoint(UseProgramStages != 0, "glUseProgramStages");
+		return UseProgramStages(pipeline, stages, program);
+	}
+	PFNUSEPROGRAMSTAGES UseProgramStages = Switch_UseProgramStages;
 	typedef void (CODEGEN_FUNCPTR *PFNVALIDATEPROGRAMPIPELINE)(GLuint);
-	PFNVALIDATEPROGRAMPIPELINE ValidateProgramPipeline = 0;
+	static void CODEGEN_FUNCPTR Switch_ValidateProgramPipeline(GLuint pipeline)
+	{
+		ValidateProgramPipeline = reinterpret_cast<PFNVALIDATEPROGRAMPIPELINE>(IntGetProcAddress("glValidateProgramPipeline"));
+		CheckLazyEntryPoint(ValidateProgramPipeline != 0, "glValidateProgramPipeline");
+		return ValidateProgramPipeline(pipeline);
+	}
+	PFNVALIDATEPROGRAMPIPELINE ValidateProgramPipeline = Switch_ValidateProgramPipeline;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL1D)(GLuint, GLdouble);
-	PFNVERTEXATTRIBL1D VertexAttribL1d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL1d(GLuint index, GLdouble x)
+	{
+		VertexAttribL1d = reinterpret_cast<PFNVERTEXATTRIBL1D>(IntGetProcAddress("glVertexAttribL1d"));
+		CheckLazyEntryPoint(VertexAttribL1d != 0, "glVertexAttribL1d");
+		return VertexAttribL1d(index, x);
+	}
+	PFNVERTEXATTRIBL1D VertexAttribL1d = Switch_VertexAttribL1d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL1DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIBL1DV VertexAttribL1dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL1dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttribL1dv = reinterpret_cast<PFNVERTEXATTRIBL1DV>(IntGetProcAddress("glVertexAttribL1dv"));
+		CheckLazyEntryPoint(VertexAttribL1dv != 0, "glVertexAttribL1dv");
+		return VertexAttribL1dv(index, v);
+	}
+	PFNVERTEXATTRIBL1DV VertexAttribL1dv = Switch_VertexAttribL1dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL2D)(GLuint, GLdouble, GLdouble);
-	PFNVERTEXATTRIBL2D VertexAttribL2d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
+	{
+		VertexAttribL2d = reinterpret_cast<PFNVERTEXATTRIBL2D>(IntGetProcAddress("glVertexAttribL2d"));
+		CheckLazyEntryPoint(VertexAttribL2d != 0, "glVertexAttribL2d");
+		return VertexAttribL2d(index, x, y);
+	}
+	PFNVERTEXATTRIBL2D VertexAttribL2d = Switch_VertexAttribL2d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL2DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIBL2DV VertexAttribL2dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL2dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttribL2dv = reinterpret_cast<PFNVERTEXATTRIBL2DV>(IntGetProcAddress("glVertexAttribL2dv"));
+		CheckLazyEntryPoint(VertexAttribL2dv != 0, "glVertexAttribL2dv");
+		return VertexAttribL2dv(index, v);
+	}
+	PFNVERTEXATTRIBL2DV VertexAttribL2dv = Switch_VertexAttribL2dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL3D)(GLuint, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIBL3D VertexAttribL3d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+	{
+		VertexAttribL3d = reinterpret_cast<PFNVERTEXATTRIBL3D>(IntGetProcAddress("glVertexAttribL3d"));
+		CheckLazyEntryPoint(VertexAttribL3d != 0, "glVertexAttribL3d");
+		return VertexAttribL3d(index, x, y, z);
+	}
+	PFNVERTEXATTRIBL3D VertexAttribL3d = Switch_VertexAttribL3d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL3DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIBL3DV VertexAttribL3dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL3dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttribL3dv = reinterpret_cast<PFNVERTEXATTRIBL3DV>(IntGetProcAddress("glVertexAttribL3dv"));
+		CheckLazyEntryPoint(VertexAttribL3dv != 0, "glVertexAttribL3dv");
+		return VertexAttribL3dv(index, v);
+	}
+	PFNVERTEXATTRIBL3DV VertexAttribL3dv = Switch_VertexAttribL3dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL4D)(GLuint, GLdouble, GLdouble, GLdouble, GLdouble);
-	PFNVERTEXATTRIBL4D VertexAttribL4d = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+	{
+		VertexAttribL4d = reinterpret_cast<PFNVERTEXATTRIBL4D>(IntGetProcAddress("glVertexAttribL4d"));
+		CheckLazyEntryPoint(VertexAttribL4d != 0, "glVertexAttribL4d");
+		return VertexAttribL4d(index, x, y, z, w);
+	}
+	PFNVERTEXATTRIBL4D VertexAttribL4d = Switch_VertexAttribL4d;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBL4DV)(GLuint, const GLdouble *);
-	PFNVERTEXATTRIBL4DV VertexAttribL4dv = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL4dv(GLuint index, const GLdouble * v)
+	{
+		VertexAttribL4dv = reinterpret_cast<PFNVERTEXATTRIBL4DV>(IntGetProcAddress("glVertexAttribL4dv"));
+		CheckLazyEntryPoint(VertexAttribL4dv != 0, "glVertexAttribL4dv");
+		return VertexAttribL4dv(index, v);
+	}
+	PFNVERTEXATTRIBL4DV VertexAttribL4dv = Switch_VertexAttribL4dv;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBLPOINTER)(GLuint, GLint, GLenum, GLsizei, const void *);
-	PFNVERTEXATTRIBLPOINTER VertexAttribLPointer = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)
+	{
+		VertexAttribLPointer = reinterpret_cast<PFNVERTEXATTRIBLPOINTER>(IntGetProcAddress("glVertexAttribLPointer"));
+		CheckLazyEntryPoint(VertexAttribLPointer != 0, "glVertexAttribLPointer");
+		return VertexAttribLPointer(index, size, type, stride, pointer);
+	}
+	PFNVERTEXATTRIBLPOINTER VertexAttribLPointer = Switch_VertexAttribLPointer;
 	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORTARRAYV)(GLuint, GLsizei, const GLfloat *);
-	PFNVIEWPORTARRAYV ViewportArrayv = 0;
+	static void CODEGEN_FUNCPTR Switch_ViewportArrayv(GLuint first, GLsizei count, const GLfloat * v)
+	{
+		ViewportArrayv = reinterpret_cast<PFNVIEWPORTARRAYV>(IntGetProcAddress("glViewportArrayv"));
+		CheckLazyEntryPoint(ViewportArrayv != 0, "glViewportArrayv");
+		return ViewportArrayv(first, count, v);
+	}
+	PFNVIEWPORTARRAYV ViewportArrayv = Switch_ViewportArrayv;
 	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORTINDEXEDF)(GLuint, GLfloat, GLfloat, GLfloat, GLfloat);
-	PFNVIEWPORTINDEXEDF ViewportIndexedf = 0;
+	static void CODEGEN_FUNCPTR Switch_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+	{
+		ViewportIndexedf = reinterpret_cast<PFNVIEWPORTINDEXEDF>(IntGetProcAddress("glViewportIndexedf"));
+		CheckLazyEntryPoint(ViewportIndexedf != 0, "glViewportIndexedf");
+		return ViewportIndexedf(index, x, y, w, h);
+	}
+	PFNVIEWPORTINDEXEDF ViewportIndexedf = Switch_ViewportIndexedf;
 	typedef void (CODEGEN_FUNCPTR *PFNVIEWPORTINDEXEDFV)(GLuint, const GLfloat *);
-	PFNVIEWPORTINDEXEDFV ViewportIndexedfv = 0;
+	static void CODEGEN_FUNCPTR Switch_ViewportIndexedfv(GLuint index, const GLfloat * v)
+	{
+		ViewportIndexedfv = reinterpret_cast<PFNVIEWPORTINDEXEDFV>(IntGetProcAddress("glViewportIndexedfv"));
+		CheckLazyEntryPoint(ViewportIndexedfv != 0, "glViewportIndexedfv");
+		return ViewportIndexedfv(index, v);
+	}
+	PFNVIEWPORTINDEXEDFV ViewportIndexedfv = Switch_ViewportIndexedfv;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBINDIMAGETEXTURE)(GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum);
-	PFNBINDIMAGETEXTURE BindImageTexture = 0;
+	static void CODEGEN_FUNCPTR Switch_BindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+	{
+		BindImageTexture = reinterpret_cast<PFNBINDIMAGETEXTURE>(IntGetProcAddress("glBindImageTexture"));
+		CheckLazyEntryPoint(BindImageTexture != 0, "glBindImageTexture");
+		return BindImageTexture(unit, texture, level, layered, layer, access, format);
+	}
+	PFNBINDIMAGETEXTURE BindImageTexture = Switch_BindImageTexture;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWARRAYSINSTANCEDBASEINSTANCE)(GLenum, GLint, GLsizei, GLsizei, GLuint);
-	PFNDRAWARRAYSINSTANCEDBASEINSTANCE DrawArraysInstancedBaseInstance = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+	{
+		DrawArraysInstancedBaseInstance = reinterpret_cast<PFNDRAWARRAYSINSTANCEDBASEINSTANCE>(IntGetProcAddress("glDrawArraysInstancedBaseInstance"));
+		CheckLazyEntryPoint(DrawArraysInstancedBaseInstance != 0, "glDrawArraysInstancedBaseInstance");
+		return DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	}
+	PFNDRAWARRAYSINSTANCEDBASEINSTANCE DrawArraysInstancedBaseInstance = Switch_DrawArraysInstancedBaseInstance;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCEDBASEINSTANCE)(GLenum, GLsizei, GLenum, const void *, GLsizei, GLuint);
-	PFNDRAWELEMENTSINSTANCEDBASEINSTANCE DrawElementsInstancedBaseInstance = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance)
+	{
+		DrawElementsInstancedBaseInstance = reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEINSTANCE>(IntGetProcAddress("glDrawElementsInstancedBaseInstance"));
+		CheckLazyEntryPoint(DrawElementsInstancedBaseInstance != 0, "glDrawElementsInstancedBaseInstance");
+		return DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	}
+	PFNDRAWELEMENTSINSTANCEDBASEINSTANCE DrawElementsInstancedBaseInstance = Switch_DrawElementsInstancedBaseInstance;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE)(GLenum, GLsizei, GLenum, const void *, GLsizei, GLint, GLuint);
-	PFNDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE DrawElementsInstancedBaseVertexBaseInstance = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)
+	{
+		DrawElementsInstancedBaseVertexBaseInstance = reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE>(IntGetProcAddress("glDrawElementsInstancedBaseVertexBaseInstance"));
+		CheckLazyEntryPoint(DrawElementsInstancedBaseVertexBaseInstance != 0, "glDrawElementsInstancedBaseVertexBaseInstance");
+		return DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	}
+	PFNDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE DrawElementsInstancedBaseVertexBaseInstance = Switch_DrawElementsInstancedBaseVertexBaseInstance;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWTRANSFORMFEEDBACKINSTANCED)(GLenum, GLuint, GLsizei);
-	PFNDRAWTRANSFORMFEEDBACKINSTANCED DrawTransformFeedbackInstanced = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
+	{
+		DrawTransformFeedbackInstanced = reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKINSTANCED>(IntGetProcAddress("glDrawTransformFeedbackInstanced"));
+		CheckLazyEntryPoint(DrawTransformFeedbackInstanced != 0, "glDrawTransformFeedbackInstanced");
+		return DrawTransformFeedbackInstanced(mode, id, instancecount);
+	}
+	PFNDRAWTRANSFORMFEEDBACKINSTANCED DrawTransformFeedbackInstanced = Switch_DrawTransformFeedbackInstanced;
 	typedef void (CODEGEN_FUNCPTR *PFNDRAWTRANSFORMFEEDBACKSTREAMINSTANCED)(GLenum, GLuint, GLuint, GLsizei);
-	PFNDRAWTRANSFORMFEEDBACKSTREAMINSTANCED DrawTransformFeedbackStreamInstanced = 0;
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
+	{
+		DrawTransformFeedbackStreamInstanced = reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKSTREAMINSTANCED>(IntGetProcAddress("glDrawTransformFeedbackStreamInstanced"));
+		CheckLazyEntryPoint(DrawTransformFeedbackStreamInstanced != 0, "glDrawTransformFeedbackStreamInstanced");
+		return DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	}
+	PFNDRAWTRANSFORMFEEDBACKSTREAMINSTANCED DrawTransformFeedbackStreamInstanced = Switch_DrawTransformFeedbackStreamInstanced;
 	typedef void (CODEGEN_FUNCPTR *PFNGETACTIVEATOMICCOUNTERBUFFERIV)(GLuint, GLuint, GLenum, GLint *);
-	PFNGETACTIVEATOMICCOUNTERBUFFERIV GetActiveAtomicCounterBufferiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params)
+	{
+		GetActiveAtomicCounterBufferiv = reinterpret_cast<PFNGETACTIVEATOMICCOUNTERBUFFERIV>(IntGetProcAddress("glGetActiveAtomicCounterBufferiv"));
+		CheckLazyEntryPoint(GetActiveAtomicCounterBufferiv != 0, "glGetActiveAtomicCounterBufferiv");
+		return GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	}
+	PFNGETACTIVEATOMICCOUNTERBUFFERIV GetActiveAtomicCounterBufferiv = Switch_GetActiveAtomicCounterBufferiv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTERNALFORMATIV)(GLenum, GLenum, GLenum, GLsizei, GLint *);
-	PFNGETINTERNALFORMATIV GetInternalformativ = 0;
+	static void CODEGEN_FUNCPTR Switch_GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint * params)
+	{
+		GetInternalformativ = reinterpret_cast<PFNGETINTERNALFORMATIV>(IntGetProcAddress("glGetInternalformativ"));
+		CheckLazyEntryPoint(GetInternalformativ != 0, "glGetInternalformativ");
+		return GetInternalformativ(target, internalformat, pname, bufSize, params);
+	}
+	PFNGETINTERNALFORMATIV GetInternalformativ = Switch_GetInternalformativ;
 	typedef void (CODEGEN_FUNCPTR *PFNMEMORYBARRIER)(GLbitfield);
-	PFNMEMORYBARRIER MemoryBarrier_ = 0;
+	static void CODEGEN_FUNCPTR Switch_MemoryBarrier_(GLbitfield barriers)
+	{
+		MemoryBarrier_ = reinterpret_cast<PFNMEMORYBARRIER>(IntGetProcAddress("glMemoryBarrier_"));
+		CheckLazyEntryPoint(MemoryBarrier_ != 0, "glMemoryBarrier_");
+		return MemoryBarrier_(barriers);
+	}
+	PFNMEMORYBARRIER MemoryBarrier_ = Switch_MemoryBarrier_;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSTORAGE1D)(GLenum, GLsizei, GLenum, GLsizei);
-	PFNTEXSTORAGE1D TexStorage1D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+	{
+		TexStorage1D = reinterpret_cast<PFNTEXSTORAGE1D>(IntGetProcAddress("glTexStorage1D"));
+		CheckLazyEntryPoint(TexStorage1D != 0, "glTexStorage1D");
+		return TexStorage1D(target, levels, internalformat, width);
+	}
+	PFNTEXSTORAGE1D TexStorage1D = Switch_TexStorage1D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSTORAGE2D)(GLenum, GLsizei, GLenum, GLsizei, GLsizei);
-	PFNTEXSTORAGE2D TexStorage2D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+	{
+		TexStorage2D = reinterpret_cast<PFNTEXSTORAGE2D>(IntGetProcAddress("glTexStorage2D"));
+		CheckLazyEntryPoint(TexStorage2D != 0, "glTexStorage2D");
+		return TexStorage2D(target, levels, internalformat, width, height);
+	}
+	PFNTEXSTORAGE2D TexStorage2D = Switch_TexStorage2D;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSTORAGE3D)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei);
-	PFNTEXSTORAGE3D TexStorage3D = 0;
+	static void CODEGEN_FUNCPTR Switch_TexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+	{
+		TexStorage3D = reinterpret_cast<PFNTEXSTORAGE3D>(IntGetProcAddress("glTexStorage3D"));
+		CheckLazyEntryPoint(TexStorage3D != 0, "glTexStorage3D");
+		return TexStorage3D(target, levels, internalformat, width, height, depth);
+	}
+	PFNTEXSTORAGE3D TexStorage3D = Switch_TexStorage3D;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBINDVERTEXBUFFER)(GLuint, GLuint, GLintptr, GLsizei);
-	PFNBINDVERTEXBUFFER BindVertexBuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_BindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+	{
+		BindVertexBuffer = reinterpret_cast<PFNBINDVERTEXBUFFER>(IntGetProcAddress("glBindVertexBuffer"));
+		CheckLazyEntryPoint(BindVertexBuffer != 0, "glBindVertexBuffer");
+		return BindVertexBuffer(bindingindex, buffer, offset, stride);
+	}
+	PFNBINDVERTEXBUFFER BindVertexBuffer = Switch_BindVertexBuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERDATA)(GLenum, GLenum, GLenum, GLenum, const void *);
-	PFNCLEARBUFFERDATA ClearBufferData = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data)
+	{
+		ClearBufferData = reinterpret_cast<PFNCLEARBUFFERDATA>(IntGetProcAddress("glClearBufferData"));
+		CheckLazyEntryPoint(ClearBufferData != 0, "glClearBufferData");
+		return ClearBufferData(target, internalformat, format, type, data);
+	}
+	PFNCLEARBUFFERDATA ClearBufferData = Switch_ClearBufferData;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARBUFFERSUBDATA)(GLenum, GLenum, GLintptr, GLsizeiptr, GLenum, GLenum, const void *);
-	PFNCLEARBUFFERSUBDATA ClearBufferSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data)
+	{
+		ClearBufferSubData = reinterpret_cast<PFNCLEARBUFFERSUBDATA>(IntGetProcAddress("glClearBufferSubData"));
+		CheckLazyEntryPoint(ClearBufferSubData != 0, "glClearBufferSubData");
+		return ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	}
+	PFNCLEARBUFFERSUBDATA ClearBufferSubData = Switch_ClearBufferSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNCOPYIMAGESUBDATA)(GLuint, GLenum, GLint, GLint, GLint, GLint, GLuint, GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei);
-	PFNCOPYIMAGESUBDATA CopyImageSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+	{
+		CopyImageSubData = reinterpret_cast<PFNCOPYIMAGESUBDATA>(IntGetProcAddress("glCopyImageSubData"));
+		CheckLazyEntryPoint(CopyImageSubData != 0, "glCopyImageSubData");
+		return CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	}
+	PFNCOPYIMAGESUBDATA CopyImageSubData = Switch_CopyImageSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECALLBACK)(GLDEBUGPROC, const void *);
-	PFNDEBUGMESSAGECALLBACK DebugMessageCallback = 0;
+	static void CODEGEN_FUNCPTR Switch_DebugMessageCallback(GLDEBUGPROC callback, const void * userParam)
+	{
+		DebugMessageCallback = reinterpret_cast<PFNDEBUGMESSAGECALLBACK>(IntGetProcAddress("glDebugMessageCallback"));
+		CheckLazyEntryPoint(DebugMessageCallback != 0, "glDebugMessageCallback");
+		return DebugMessageCallback(callback, userParam);
+	}
+	PFNDEBUGMESSAGECALLBACK DebugMessageCallback = Switch_DebugMessageCallback;
 	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGECONTROL)(GLenum, GLenum, GLenum, GLsizei, const GLuint *, GLboolean);
-	PFNDEBUGMESSAGECONTROL DebugMessageControl = 0;
+	static void CODEGEN_FUNCPTR Switch_DebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled)
+	{
+		DebugMessageControl = reinterpret_cast<PFNDEBUGMESSAGECONTROL>(IntGetProcAddress("glDebugMessageControl"));
+		CheckLazyEntryPoint(DebugMessageControl != 0, "glDebugMessageControl");
+		return DebugMessageControl(source, type, severity, count, ids, enabled);
+	}
+	PFNDEBUGMESSAGECONTROL DebugMessageControl = Switch_DebugMessageControl;
 	typedef void (CODEGEN_FUNCPTR *PFNDEBUGMESSAGEINSERT)(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *);
-	PFNDEBUGMESSAGEINSERT DebugMessageInsert = 0;
+	static void CODEGEN_FUNCPTR Switch_DebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf)
+	{
+		DebugMessageInsert = reinterpret_cast<PFNDEBUGMESSAGEINSERT>(IntGetProcAddress("glDebugMessageInsert"));
+		CheckLazyEntryPoint(DebugMessageInsert != 0, "glDebugMessageInsert");
+		return DebugMessageInsert(source, type, id, severity, length, buf);
+	}
+	PFNDEBUGMESSAGEINSERT DebugMessageInsert = Switch_DebugMessageInsert;
 	typedef void (CODEGEN_FUNCPTR *PFNDISPATCHCOMPUTE)(GLuint, GLuint, GLuint);
-	PFNDISPATCHCOMPUTE DispatchCompute = 0;
+	static void CODEGEN_FUNCPTR Switch_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+	{
+		DispatchCompute = reinterpret_cast<PFNDISPATCHCOMPUTE>(IntGetProcAddress("glDispatchCompute"));
+		CheckLazyEntryPoint(DispatchCompute != 0, "glDispatchCompute");
+		return DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	}
+	PFNDISPATCHCOMPUTE DispatchCompute = Switch_DispatchCompute;
 	typedef void (CODEGEN_FUNCPTR *PFNDISPATCHCOMPUTEINDIRECT)(GLintptr);
-	PFNDISPATCHCOMPUTEINDIRECT DispatchComputeIndirect = 0;
+	static void CODEGEN_FUNCPTR Switch_DispatchComputeIndirect(GLintptr indirect)
+	{
+		DispatchComputeIndirect = reinterpret_cast<PFNDISPATCHCOMPUTEINDIRECT>(IntGetProcAddress("glDispatchComputeIndirect"));
+		CheckLazyEntryPoint(DispatchComputeIndirect != 0, "glDispatchComputeIndirect");
+		return DispatchComputeIndirect(indirect);
+	}
+	PFNDISPATCHCOMPUTEINDIRECT DispatchComputeIndirect = Switch_DispatchComputeIndirect;
 	typedef void (CODEGEN_FUNCPTR *PFNFRAMEBUFFERPARAMETERI)(GLenum, GLenum, GLint);
-	PFNFRAMEBUFFERPARAMETERI FramebufferParameteri = 0;
+	static void CODEGEN_FUNCPTR Switch_FramebufferParameteri(GLenum target, GLenum pname, GLint param)
+	{
+		FramebufferParameteri = reinterpret_cast<PFNFRAMEBUFFERPARAMETERI>(IntGetProcAddress("glFramebufferParameteri"));
+		CheckLazyEntryPoint(FramebufferParameteri != 0, "glFramebufferParameteri");
+		return FramebufferParameteri(target, pname, param);
+	}
+	PFNFRAMEBUFFERPARAMETERI FramebufferParameteri = Switch_FramebufferParameteri;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNGETDEBUGMESSAGELOG)(GLuint, GLsizei, GLenum *, GLenum *, GLuint *, GLenum *, GLsizei *, GLchar *);
-	PFNGETDEBUGMESSAGELOG GetDebugMessageLog = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_GetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog)
+	{
+		GetDebugMessageLog = reinterpret_cast<PFNGETDEBUGMESSAGELOG>(IntGetProcAddress("glGetDebugMessageLog"));
+		CheckLazyEntryPoint(GetDebugMessageLog != 0, "glGetDebugMessageLog");
+		return GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	}
+	PFNGETDEBUGMESSAGELOG GetDebugMessageLog = Switch_GetDebugMessageLog;
 	typedef void (CODEGEN_FUNCPTR *PFNGETFRAMEBUFFERPARAMETERIV)(GLenum, GLenum, GLint *);
-	PFNGETFRAMEBUFFERPARAMETERIV GetFramebufferParameteriv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params)
+	{
+		GetFramebufferParameteriv = reinterpret_cast<PFNGETFRAMEBUFFERPARAMETERIV>(IntGetProcAddress("glGetFramebufferParameteriv"));
+		CheckLazyEntryPoint(GetFramebufferParameteriv != 0, "glGetFramebufferParameteriv");
+		return GetFramebufferParameteriv(target, pname, params);
+	}
+	PFNGETFRAMEBUFFERPARAMETERIV GetFramebufferParameteriv = Switch_GetFramebufferParameteriv;
 	typedef void (CODEGEN_FUNCPTR *PFNGETINTERNALFORMATI64V)(GLenum, GLenum, GLenum, GLsizei, GLint64 *);
-	PFNGETINTERNALFORMATI64V GetInternalformati64v = 0;
+	static void CODEGEN_FUNCPTR Switch_GetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 * params)
+	{
+		GetInternalformati64v = reinterpret_cast<PFNGETINTERNALFORMATI64V>(IntGetProcAddress("glGetInternalformati64v"));
+		CheckLazyEntryPoint(GetInternalformati64v != 0, "glGetInternalformati64v");
+		return GetInternalformati64v(target, internalformat, pname, bufSize, params);
+	}
+	PFNGETINTERNALFORMATI64V GetInternalformati64v = Switch_GetInternalformati64v;
 	typedef void (CODEGEN_FUNCPTR *PFNGETOBJECTLABEL)(GLenum, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETOBJECTLABEL GetObjectLabel = 0;
+	static void CODEGEN_FUNCPTR Switch_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label)
+	{
+		GetObjectLabel = reinterpret_cast<PFNGETOBJECTLABEL>(IntGetProcAddress("glGetObjectLabel"));
+		CheckLazyEntryPoint(GetObjectLabel != 0, "glGetObjectLabel");
+		return GetObjectLabel(identifier, name, bufSize, length, label);
+	}
+	PFNGETOBJECTLABEL GetObjectLabel = Switch_GetObjectLabel;
 	typedef void (CODEGEN_FUNCPTR *PFNGETOBJECTPTRLABEL)(const void *, GLsizei, GLsizei *, GLchar *);
-	PFNGETOBJECTPTRLABEL GetObjectPtrLabel = 0;
+	static void CODEGEN_FUNCPTR Switch_GetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label)
+	{
+		GetObjectPtrLabel = reinterpret_cast<PFNGETOBJECTPTRLABEL>(IntGetProcAddress("glGetObjectPtrLabel"));
+		CheckLazyEntryPoint(GetObjectPtrLabel != 0, "glGetObjectPtrLabel");
+		return GetObjectPtrLabel(ptr, bufSize, length, label);
+	}
+	PFNGETOBJECTPTRLABEL GetObjectPtrLabel = Switch_GetObjectPtrLabel;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMINTERFACEIV)(GLuint, GLenum, GLenum, GLint *);
-	PFNGETPROGRAMINTERFACEIV GetProgramInterfaceiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params)
+	{
+		GetProgramInterfaceiv = reinterpret_cast<PFNGETPROGRAMINTERFACEIV>(IntGetProcAddress("glGetProgramInterfaceiv"));
+		CheckLazyEntryPoint(GetProgramInterfaceiv != 0, "glGetProgramInterfaceiv");
+		return GetProgramInterfaceiv(program, programInterface, pname, params);
+	}
+	PFNGETPROGRAMINTERFACEIV GetProgramInterfaceiv = Switch_GetProgramInterfaceiv;
 	typedef GLuint (CODEGEN_FUNCPTR *PFNGETPROGRAMRESOURCEINDEX)(GLuint, GLenum, const GLchar *);
-	PFNGETPROGRAMRESOURCEINDEX GetProgramResourceIndex = 0;
+	static GLuint CODEGEN_FUNCPTR Switch_GetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name)
+	{
+		GetProgramResourceIndex = reinterpret_cast<PFNGETPROGRAMRESOURCEINDEX>(IntGetProcAddress("glGetProgramResourceIndex"));
+		CheckLazyEntryPoint(GetProgramResourceIndex != 0, "glGetProgramResourceIndex");
+		return GetProgramResourceIndex(program, programInterface, name);
+	}
+	PFNGETPROGRAMRESOURCEINDEX GetProgramResourceIndex = Switch_GetProgramResourceIndex;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETPROGRAMRESOURCELOCATION)(GLuint, GLenum, const GLchar *);
-	PFNGETPROGRAMRESOURCELOCATION GetProgramResourceLocation = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name)
+	{
+		GetProgramResourceLocation = reinterpret_cast<PFNGETPROGRAMRESOURCELOCATION>(IntGetProcAddress("glGetProgramResourceLocation"));
+		CheckLazyEntryPoint(GetProgramResourceLocation != 0, "glGetProgramResourceLocation");
+		return GetProgramResourceLocation(program, programInterface, name);
+	}
+	PFNGETPROGRAMRESOURCELOCATION GetProgramResourceLocation = Switch_GetProgramResourceLocation;
 	typedef GLint (CODEGEN_FUNCPTR *PFNGETPROGRAMRESOURCELOCATIONINDEX)(GLuint, GLenum, const GLchar *);
-	PFNGETPROGRAMRESOURCELOCATIONINDEX GetProgramResourceLocationIndex = 0;
+	static GLint CODEGEN_FUNCPTR Switch_GetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name)
+	{
+		GetProgramResourceLocationIndex = reinterpret_cast<PFNGETPROGRAMRESOURCELOCATIONINDEX>(IntGetProcAddress("glGetProgramResourceLocationIndex"));
+		CheckLazyEntryPoint(GetProgramResourceLocationIndex != 0, "glGetProgramResourceLocationIndex");
+		return GetProgramResourceLocationIndex(program, programInterface, name);
+	}
+	PFNGETPROGRAMRESOURCELOCATIONINDEX GetProgramResourceLocationIndex = Switch_GetProgramResourceLocationIndex;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMRESOURCENAME)(GLuint, GLenum, GLuint, GLsizei, GLsizei *, GLchar *);
-	PFNGETPROGRAMRESOURCENAME GetProgramResourceName = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+	{
+		GetProgramResourceName = reinterpret_cast<PFNGETPROGRAMRESOURCENAME>(IntGetProcAddress("glGetProgramResourceName"));
+		CheckLazyEntryPoint(GetProgramResourceName != 0, "glGetProgramResourceName");
+		return GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	}
+	PFNGETPROGRAMRESOURCENAME GetProgramResourceName = Switch_GetProgramResourceName;
 	typedef void (CODEGEN_FUNCPTR *PFNGETPROGRAMRESOURCEIV)(GLuint, GLenum, GLuint, GLsizei, const GLenum *, GLsizei, GLsizei *, GLint *);
-	PFNGETPROGRAMRESOURCEIV GetProgramResourceiv = 0;
+	static void CODEGEN_FUNCPTR Switch_GetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei bufSize, GLsizei * length, GLint * params)
+	{
+		GetProgramResourceiv = reinterpret_cast<PFNGETPROGRAMRESOURCEIV>(IntGetProcAddress("glGetProgramResourceiv"));
+		CheckLazyEntryPoint(GetProgramResourceiv != 0, "glGetProgramResourceiv");
+		return GetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+	}
+	PFNGETPROGRAMRESOURCEIV GetProgramResourceiv = Switch_GetProgramResourceiv;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATEBUFFERDATA)(GLuint);
-	PFNINVALIDATEBUFFERDATA InvalidateBufferData = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateBufferData(GLuint buffer)
+	{
+		InvalidateBufferData = reinterpret_cast<PFNINVALIDATEBUFFERDATA>(IntGetProcAddress("glInvalidateBufferData"));
+		CheckLazyEntryPoint(InvalidateBufferData != 0, "glInvalidateBufferData");
+		return InvalidateBufferData(buffer);
+	}
+	PFNINVALIDATEBUFFERDATA InvalidateBufferData = Switch_InvalidateBufferData;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATEBUFFERSUBDATA)(GLuint, GLintptr, GLsizeiptr);
-	PFNINVALIDATEBUFFERSUBDATA InvalidateBufferSubData = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
+	{
+		InvalidateBufferSubData = reinterpret_cast<PFNINVALIDATEBUFFERSUBDATA>(IntGetProcAddress("glInvalidateBufferSubData"));
+		CheckLazyEntryPoint(InvalidateBufferSubData != 0, "glInvalidateBufferSubData");
+		return InvalidateBufferSubData(buffer, offset, length);
+	}
+	PFNINVALIDATEBUFFERSUBDATA InvalidateBufferSubData = Switch_InvalidateBufferSubData;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATEFRAMEBUFFER)(GLenum, GLsizei, const GLenum *);
-	PFNINVALIDATEFRAMEBUFFER InvalidateFramebuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments)
+	{
+		InvalidateFramebuffer = reinterpret_cast<PFNINVALIDATEFRAMEBUFFER>(IntGetProcAddress("glInvalidateFramebuffer"));
+		CheckLazyEntryPoint(InvalidateFramebuffer != 0, "glInvalidateFramebuffer");
+		return InvalidateFramebuffer(target, numAttachments, attachments);
+	}
+	PFNINVALIDATEFRAMEBUFFER InvalidateFramebuffer = Switch_InvalidateFramebuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATESUBFRAMEBUFFER)(GLenum, GLsizei, const GLenum *, GLint, GLint, GLsizei, GLsizei);
-	PFNINVALIDATESUBFRAMEBUFFER InvalidateSubFramebuffer = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		InvalidateSubFramebuffer = reinterpret_cast<PFNINVALIDATESUBFRAMEBUFFER>(IntGetProcAddress("glInvalidateSubFramebuffer"));
+		CheckLazyEntryPoint(InvalidateSubFramebuffer != 0, "glInvalidateSubFramebuffer");
+		return InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	}
+	PFNINVALIDATESUBFRAMEBUFFER InvalidateSubFramebuffer = Switch_InvalidateSubFramebuffer;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATETEXIMAGE)(GLuint, GLint);
-	PFNINVALIDATETEXIMAGE InvalidateTexImage = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateTexImage(GLuint texture, GLint level)
+	{
+		InvalidateTexImage = reinterpret_cast<PFNINVALIDATETEXIMAGE>(IntGetProcAddress("glInvalidateTexImage"));
+		CheckLazyEntryPoint(InvalidateTexImage != 0, "glInvalidateTexImage");
+		return InvalidateTexImage(texture, level);
+	}
+	PFNINVALIDATETEXIMAGE InvalidateTexImage = Switch_InvalidateTexImage;
 	typedef void (CODEGEN_FUNCPTR *PFNINVALIDATETEXSUBIMAGE)(GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei);
-	PFNINVALIDATETEXSUBIMAGE InvalidateTexSubImage = 0;
+	static void CODEGEN_FUNCPTR Switch_InvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+	{
+		InvalidateTexSubImage = reinterpret_cast<PFNINVALIDATETEXSUBIMAGE>(IntGetProcAddress("glInvalidateTexSubImage"));
+		CheckLazyEntryPoint(InvalidateTexSubImage != 0, "glInvalidateTexSubImage");
+		return InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	}
+	PFNINVALIDATETEXSUBIMAGE InvalidateTexSubImage = Switch_InvalidateTexSubImage;
 	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWARRAYSINDIRECT)(GLenum, const void *, GLsizei, GLsizei);
-	PFNMULTIDRAWARRAYSINDIRECT MultiDrawArraysIndirect = 0;
+	static void CODEGEN_FUNCPTR Switch_MultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride)
+	{
+		MultiDrawArraysIndirect = reinterpret_cast<PFNMULTIDRAWARRAYSINDIRECT>(IntGetProcAddress("glMultiDrawArraysIndirect"));
+		CheckLazyEntryPoint(MultiDrawArraysIndirect != 0, "glMultiDrawArraysIndirect");
+		return MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	}
+	PFNMULTIDRAWARRAYSINDIRECT MultiDrawArraysIndirect = Switch_MultiDrawArraysIndirect;
 	typedef void (CODEGEN_FUNCPTR *PFNMULTIDRAWELEMENTSINDIRECT)(GLenum, GLenum, const void *, GLsizei, GLsizei);
-	PFNMULTIDRAWELEMENTSINDIRECT MultiDrawElementsIndirect = 0;
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride)
+	{
+		MultiDrawElementsIndirect = reinterpret_cast<PFNMULTIDRAWELEMENTSINDIRECT>(IntGetProcAddress("glMultiDrawElementsIndirect"));
+		CheckLazyEntryPoint(MultiDrawElementsIndirect != 0, "glMultiDrawElementsIndirect");
+		return MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	}
+	PFNMULTIDRAWELEMENTSINDIRECT MultiDrawElementsIndirect = Switch_MultiDrawElementsIndirect;
 	typedef void (CODEGEN_FUNCPTR *PFNOBJECTLABEL)(GLenum, GLuint, GLsizei, const GLchar *);
-	PFNOBJECTLABEL ObjectLabel = 0;
+	static void CODEGEN_FUNCPTR Switch_ObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label)
+	{
+		ObjectLabel = reinterpret_cast<PFNOBJECTLABEL>(IntGetProcAddress("glObjectLabel"));
+		CheckLazyEntryPoint(ObjectLabel != 0, "glObjectLabel");
+		return ObjectLabel(identifier, name, length, label);
+	}
+	PFNOBJECTLABEL ObjectLabel = Switch_ObjectLabel;
 	typedef void (CODEGEN_FUNCPTR *PFNOBJECTPTRLABEL)(const void *, GLsizei, const GLchar *);
-	PFNOBJECTPTRLABEL ObjectPtrLabel = 0;
+	static void CODEGEN_FUNCPTR Switch_ObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label)
+	{
+		ObjectPtrLabel = reinterpret_cast<PFNOBJECTPTRLABEL>(IntGetProcAddress("glObjectPtrLabel"));
+		CheckLazyEntryPoint(ObjectPtrLabel != 0, "glObjectPtrLabel");
+		return ObjectPtrLabel(ptr, length, label);
+	}
+	PFNOBJECTPTRLABEL ObjectPtrLabel = Switch_ObjectPtrLabel;
 	typedef void (CODEGEN_FUNCPTR *PFNPOPDEBUGGROUP)();
-	PFNPOPDEBUGGROUP PopDebugGroup = 0;
+	static void CODEGEN_FUNCPTR Switch_PopDebugGroup()
+	{
+		PopDebugGroup = reinterpret_cast<PFNPOPDEBUGGROUP>(IntGetProcAddress("glPopDebugGroup"));
+		CheckLazyEntryPoint(PopDebugGroup != 0, "glPopDebugGroup");
+		return PopDebugGroup();
+	}
+	PFNPOPDEBUGGROUP PopDebugGroup = Switch_PopDebugGroup;
 	typedef void (CODEGEN_FUNCPTR *PFNPUSHDEBUGGROUP)(GLenum, GLuint, GLsizei, const GLchar *);
-	PFNPUSHDEBUGGROUP PushDebugGroup = 0;
+	static void CODEGEN_FUNCPTR Switch_PushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message)
+	{
+		PushDebugGroup = reinterpret_cast<PFNPUSHDEBUGGROUP>(IntGetProcAddress("glPushDebugGroup"));
+		CheckLazyEntryPoint(PushDebugGroup != 0, "glPushDebugGroup");
+		return PushDebugGroup(source, id, length, message);
+	}
+	PFNPUSHDEBUGGROUP PushDebugGroup = Switch_PushDebugGroup;
 	typedef void (CODEGEN_FUNCPTR *PFNSHADERSTORAGEBLOCKBINDING)(GLuint, GLuint, GLuint);
-	PFNSHADERSTORAGEBLOCKBINDING ShaderStorageBlockBinding = 0;
+	static void CODEGEN_FUNCPTR Switch_ShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+	{
+		ShaderStorageBlockBinding = reinterpret_cast<PFNSHADERSTORAGEBLOCKBINDING>(IntGetProcAddress("glShaderStorageBlockBinding"));
+		CheckLazyEntryPoint(ShaderStorageBlockBinding != 0, "glShaderStorageBlockBinding");
+		return ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	}
+	PFNSHADERSTORAGEBLOCKBINDING ShaderStorageBlockBinding = Switch_ShaderStorageBlockBinding;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXBUFFERRANGE)(GLenum, GLenum, GLuint, GLintptr, GLsizeiptr);
-	PFNTEXBUFFERRANGE TexBufferRange = 0;
+	static void CODEGEN_FUNCPTR Switch_TexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+	{
+		TexBufferRange = reinterpret_cast<PFNTEXBUFFERRANGE>(IntGetProcAddress("glTexBufferRange"));
+		CheckLazyEntryPoint(TexBufferRange != 0, "glTexBufferRange");
+		return TexBufferRange(target, internalformat, buffer, offset, size);
+	}
+	PFNTEXBUFFERRANGE TexBufferRange = Switch_TexBufferRange;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSTORAGE2DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean);
-	PFNTEXSTORAGE2DMULTISAMPLE TexStorage2DMultisample = 0;
+	static void CODEGEN_FUNCPTR Switch_TexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+	{
+		TexStorage2DMultisample = reinterpret_cast<PFNTEXSTORAGE2DMULTISAMPLE>(IntGetProcAddress("glTexStorage2DMultisample"));
+		CheckLazyEntryPoint(TexStorage2DMultisample != 0, "glTexStorage2DMultisample");
+		return TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	}
+	PFNTEXSTORAGE2DMULTISAMPLE TexStorage2DMultisample = Switch_TexStorage2DMultisample;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXSTORAGE3DMULTISAMPLE)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean);
-	PFNTEXSTORAGE3DMULTISAMPLE TexStorage3DMultisample = 0;
+	static void CODEGEN_FUNCPTR Switch_TexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+	{
+		TexStorage3DMultisample = reinterpret_cast<PFNTEXSTORAGE3DMULTISAMPLE>(IntGetProcAddress("glTexStorage3DMultisample"));
+		CheckLazyEntryPoint(TexStorage3DMultisample != 0, "glTexStorage3DMultisample");
+		return TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	}
+	PFNTEXSTORAGE3DMULTISAMPLE TexStorage3DMultisample = Switch_TexStorage3DMultisample;
 	typedef void (CODEGEN_FUNCPTR *PFNTEXTUREVIEW)(GLuint, GLenum, GLuint, GLenum, GLuint, GLuint, GLuint, GLuint);
-	PFNTEXTUREVIEW TextureView = 0;
+	static void CODEGEN_FUNCPTR Switch_TextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+	{
+		TextureView = reinterpret_cast<PFNTEXTUREVIEW>(IntGetProcAddress("glTextureView"));
+		CheckLazyEntryPoint(TextureView != 0, "glTextureView");
+		return TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	}
+	PFNTEXTUREVIEW TextureView = Switch_TextureView;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBBINDING)(GLuint, GLuint);
-	PFNVERTEXATTRIBBINDING VertexAttribBinding = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
+	{
+		VertexAttribBinding = reinterpret_cast<PFNVERTEXATTRIBBINDING>(IntGetProcAddress("glVertexAttribBinding"));
+		CheckLazyEntryPoint(VertexAttribBinding != 0, "glVertexAttribBinding");
+		return VertexAttribBinding(attribindex, bindingindex);
+	}
+	PFNVERTEXATTRIBBINDING VertexAttribBinding = Switch_VertexAttribBinding;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBFORMAT)(GLuint, GLint, GLenum, GLboolean, GLuint);
-	PFNVERTEXATTRIBFORMAT VertexAttribFormat = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+	{
+		VertexAttribFormat = reinterpret_cast<PFNVERTEXATTRIBFORMAT>(IntGetProcAddress("glVertexAttribFormat"));
+		CheckLazyEntryPoint(VertexAttribFormat != 0, "glVertexAttribFormat");
+		return VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	}
+	PFNVERTEXATTRIBFORMAT VertexAttribFormat = Switch_VertexAttribFormat;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBIFORMAT)(GLuint, GLint, GLenum, GLuint);
-	PFNVERTEXATTRIBIFORMAT VertexAttribIFormat = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+	{
+		VertexAttribIFormat = reinterpret_cast<PFNVERTEXATTRIBIFORMAT>(IntGetProcAddress("glVertexAttribIFormat"));
+		CheckLazyEntryPoint(VertexAttribIFormat != 0, "glVertexAttribIFormat");
+		return VertexAttribIFormat(attribindex, size, type, relativeoffset);
+	}
+	PFNVERTEXATTRIBIFORMAT VertexAttribIFormat = Switch_VertexAttribIFormat;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXATTRIBLFORMAT)(GLuint, GLint, GLenum, GLuint);
-	PFNVERTEXATTRIBLFORMAT VertexAttribLFormat = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+	{
+		VertexAttribLFormat = reinterpret_cast<PFNVERTEXATTRIBLFORMAT>(IntGetProcAddress("glVertexAttribLFormat"));
+		CheckLazyEntryPoint(VertexAttribLFormat != 0, "glVertexAttribLFormat");
+		return VertexAttribLFormat(attribindex, size, type, relativeoffset);
+	}
+	PFNVERTEXATTRIBLFORMAT VertexAttribLFormat = Switch_VertexAttribLFormat;
 	typedef void (CODEGEN_FUNCPTR *PFNVERTEXBINDINGDIVISOR)(GLuint, GLuint);
-	PFNVERTEXBINDINGDIVISOR VertexBindingDivisor = 0;
+	static void CODEGEN_FUNCPTR Switch_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
+	{
+		VertexBindingDivisor = reinterpret_cast<PFNVERTEXBINDINGDIVISOR>(IntGetProcAddress("glVertexBindingDivisor"));
+		CheckLazyEntryPoint(VertexBindingDivisor != 0, "glVertexBindingDivisor");
+		return VertexBindingDivisor(bindingindex, divisor);
+	}
+	PFNVERTEXBINDINGDIVISOR VertexBindingDivisor = Switch_VertexBindingDivisor;
 	
 	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERSBASE)(GLenum, GLuint, GLsizei, const GLuint *);
-	PFNBINDBUFFERSBASE BindBuffersBase = 0;
+	static void CODEGEN_FUNCPTR Switch_BindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers)
+	{
+		BindBuffersBase = reinterpret_cast<PFNBINDBUFFERSBASE>(IntGetProcAddress("glBindBuffersBase"));
+		CheckLazyEntryPoint(BindBuffersBase != 0, "glBindBuffersBase");
+		return BindBuffersBase(target, first, count, buffers);
+	}
+	PFNBINDBUFFERSBASE BindBuffersBase = Switch_BindBuffersBase;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDBUFFERSRANGE)(GLenum, GLuint, GLsizei, const GLuint *, const GLintptr *, const GLsizeiptr *);
-	PFNBINDBUFFERSRANGE BindBuffersRange = 0;
+	static void CODEGEN_FUNCPTR Switch_BindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes)
+	{
+		BindBuffersRange = reinterpret_cast<PFNBINDBUFFERSRANGE>(IntGetProcAddress("glBindBuffersRange"));
+		CheckLazyEntryPoint(BindBuffersRange != 0, "glBindBuffersRange");
+		return BindBuffersRange(target, first, count, buffers, offsets, sizes);
+	}
+	PFNBINDBUFFERSRANGE BindBuffersRange = Switch_BindBuffersRange;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDIMAGETEXTURES)(GLuint, GLsizei, const GLuint *);
-	PFNBINDIMAGETEXTURES BindImageTextures = 0;
+	static void CODEGEN_FUNCPTR Switch_BindImageTextures(GLuint first, GLsizei count, const GLuint * textures)
+	{
+		BindImageTextures = reinterpret_cast<PFNBINDIMAGETEXTURES>(IntGetProcAddress("glBindImageTextures"));
+		CheckLazyEntryPoint(BindImageTextures != 0, "glBindImageTextures");
+		return BindImageTextures(first, count, textures);
+	}
+	PFNBINDIMAGETEXTURES BindImageTextures = Switch_BindImageTextures;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDSAMPLERS)(GLuint, GLsizei, const GLuint *);
-	PFNBINDSAMPLERS BindSamplers = 0;
+	static void CODEGEN_FUNCPTR Switch_BindSamplers(GLuint first, GLsizei count, const GLuint * samplers)
+	{
+		BindSamplers = reinterpret_cast<PFNBINDSAMPLERS>(IntGetProcAddress("glBindSamplers"));
+		CheckLazyEntryPoint(BindSamplers != 0, "glBindSamplers");
+		return BindSamplers(first, count, samplers);
+	}
+	PFNBINDSAMPLERS BindSamplers = Switch_BindSamplers;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDTEXTURES)(GLuint, GLsizei, const GLuint *);
-	PFNBINDTEXTURES BindTextures = 0;
+	static void CODEGEN_FUNCPTR Switch_BindTextures(GLuint first, GLsizei count, const GLuint * textures)
+	{
+		BindTextures = reinterpret_cast<PFNBINDTEXTURES>(IntGetProcAddress("glBindTextures"));
+		CheckLazyEntryPoint(BindTextures != 0, "glBindTextures");
+		return BindTextures(first, count, textures);
+	}
+	PFNBINDTEXTURES BindTextures = Switch_BindTextures;
 	typedef void (CODEGEN_FUNCPTR *PFNBINDVERTEXBUFFERS)(GLuint, GLsizei, const GLuint *, const GLintptr *, const GLsizei *);
-	PFNBINDVERTEXBUFFERS BindVertexBuffers = 0;
+	static void CODEGEN_FUNCPTR Switch_BindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides)
+	{
+		BindVertexBuffers = reinterpret_cast<PFNBINDVERTEXBUFFERS>(IntGetProcAddress("glBindVertexBuffers"));
+		CheckLazyEntryPoint(BindVertexBuffers != 0, "glBindVertexBuffers");
+		return BindVertexBuffers(first, count, buffers, offsets, strides);
+	}
+	PFNBINDVERTEXBUFFERS BindVertexBuffers = Switch_BindVertexBuffers;
 	typedef void (CODEGEN_FUNCPTR *PFNBUFFERSTORAGE)(GLenum, GLsizeiptr, const void *, GLbitfield);
-	PFNBUFFERSTORAGE BufferStorage = 0;
+	static void CODEGEN_FUNCPTR Switch_BufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags)
+	{
+		BufferStorage = reinterpret_cast<PFNBUFFERSTORAGE>(IntGetProcAddress("glBufferStorage"));
+		CheckLazyEntryPoint(BufferStorage != 0, "glBufferStorage");
+		return BufferStorage(target, size, data, flags);
+	}
+	PFNBUFFERSTORAGE BufferStorage = Switch_BufferStorage;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARTEXIMAGE)(GLuint, GLint, GLenum, GLenum, const void *);
-	PFNCLEARTEXIMAGE ClearTexImage = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data)
+	{
+		ClearTexImage = reinterpret_cast<PFNCLEARTEXIMAGE>(IntGetProcAddress("glClearTexImage"));
+		CheckLazyEntryPoint(ClearTexImage != 0, "glClearTexImage");
+		return ClearTexImage(texture, level, format, type, data);
+	}
+	PFNCLEARTEXIMAGE ClearTexImage = Switch_ClearTexImage;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEARTEXSUBIMAGE)(GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void *);
-	PFNCLEARTEXSUBIMAGE ClearTexSubImage = 0;
+	static void CODEGEN_FUNCPTR Switch_ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data)
+	{
+		ClearTexSubImage = reinterpret_cast<PFNCLEARTEXSUBIMAGE>(IntGetProcAddress("glClearTexSubImage"));
+		CheckLazyEntryPoint(ClearTexSubImage != 0, "glClearTexSubImage");
+		return ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	}
+	PFNCLEARTEXSUBIMAGE ClearTexSubImage = Switch_ClearTexSubImage;
+	
+	
+	static void ResetCoreFunctions()
+	{
+		BlendFunc = Switch_BlendFunc;
+		Clear = Switch_Clear;
+		ClearColor = Switch_ClearColor;
+		ClearDepth = Switch_ClearDepth;
+		ClearStencil = Switch_ClearStencil;
+		ColorMask = Switch_ColorMask;
+		CullFace = Switch_CullFace;
+		DepthFunc = Switch_DepthFunc;
+		DepthMask = Switch_DepthMask;
+		DepthRange = Switch_DepthRange;
+		Disable = Switch_Disable;
+		DrawBuffer = Switch_DrawBuffer;
+		Enable = Switch_Enable;
+		Finish = Switch_Finish;
+		Flush = Switch_Flush;
+		FrontFace = Switch_FrontFace;
+		GetBooleanv = Switch_GetBooleanv;
+		GetDoublev = Switch_GetDoublev;
+		GetError = Switch_GetError;
+		GetFloatv = Switch_GetFloatv;
+		GetIntegerv = Switch_GetIntegerv;
+		GetString = Switch_GetString;
+		GetTexImage = Switch_GetTexImage;
+		GetTexLevelParameterfv = Switch_GetTexLevelParameterfv;
+		GetTexLevelParameteriv = Switch_GetTexLevelParameteriv;
+		GetTexParameterfv = Switch_GetTexParameterfv;
+		GetTexParameteriv = Switch_GetTexParameteriv;
+		Hint = Switch_Hint;
+		IsEnabled = Switch_IsEnabled;
+		LineWidth = Switch_LineWidth;
+		LogicOp = Switch_LogicOp;
+		PixelStoref = Switch_PixelStoref;
+		PixelStorei = Switch_PixelStorei;
+		PointSize = Switch_PointSize;
+		PolygonMode = Switch_PolygonMode;
+		ReadBuffer = Switch_ReadBuffer;
+		ReadPixels = Switch_ReadPixels;
+		Scissor = Switch_Scissor;
+		StencilFunc = Switch_StencilFunc;
+		StencilMask = Switch_StencilMask;
+		StencilOp = Switch_StencilOp;
+		TexImage1D = Switch_TexImage1D;
+		TexImage2D = Switch_TexImage2D;
+		TexParameterf = Switch_TexParameterf;
+		TexParameterfv = Switch_TexParameterfv;
+		TexParameteri = Switch_TexParameteri;
+		TexParameteriv = Switch_TexParameteriv;
+		Viewport = Switch_Viewport;
+		BindTexture = Switch_BindTexture;
+		CopyTexImage1D = Switch_CopyTexImage1D;
+		CopyTexImage2D = Switch_CopyTexImage2D;
+		CopyTexSubImage1D = Switch_CopyTexSubImage1D;
+		CopyTexSubImage2D = Switch_CopyTexSubImage2D;
+		DeleteTextures = Switch_DeleteTextures;
+		DrawArrays = Switch_DrawArrays;
+		DrawElements = Switch_DrawElements;
+		GenTextures = Switch_GenTextures;
+		GetPointerv = Switch_GetPointerv;
+		IsTexture = Switch_IsTexture;
+		PolygonOffset = Switch_PolygonOffset;
+		TexSubImage1D = Switch_TexSubImage1D;
+		TexSubImage2D = Switch_TexSubImage2D;
+		CopyTexSubImage3D = Switch_CopyTexSubImage3D;
+		DrawRangeElements = Switch_DrawRangeElements;
+		TexImage3D = Switch_TexImage3D;
+		TexSubImage3D = Switch_TexSubImage3D;
+		ActiveTexture = Switch_ActiveTexture;
+		CompressedTexImage1D = Switch_CompressedTexImage1D;
+		CompressedTexImage2D = Switch_CompressedTexImage2D;
+		CompressedTexImage3D = Switch_CompressedTexImage3D;
+		CompressedTexSubImage1D = Switch_CompressedTexSubImage1D;
+		CompressedTexSubImage2D = Switch_CompressedTexSubImage2D;
+		CompressedTexSubImage3D = Switch_CompressedTexSubImage3D;
+		GetCompressedTexImage = Switch_GetCompressedTexImage;
+		SampleCoverage = Switch_SampleCoverage;
+		BlendFuncSeparate = Switch_BlendFuncSeparate;
+		MultiDrawArrays = Switch_MultiDrawArrays;
+		MultiDrawElements = Switch_MultiDrawElements;
+		PointParameterf = Switch_PointParameterf;
+		PointParameterfv = Switch_PointParameterfv;
+		PointParameteri = Switch_PointParameteri;
+		PointParameteriv = Switch_PointParameteriv;
+		BeginQuery = Switch_BeginQuery;
+		BindBuffer = Switch_BindBuffer;
+		BufferData = Switch_BufferData;
+		BufferSubData = Switch_BufferSubData;
+		DeleteBuffers = Switch_DeleteBuffers;
+		DeleteQueries = Switch_DeleteQueries;
+		EndQuery = Switch_EndQuery;
+		GenBuffers = Switch_GenBuffers;
+		GenQueries = Switch_GenQueries;
+		GetBufferParameteriv = Switch_GetBufferParameteriv;
+		GetBufferPointerv = Switch_GetBufferPointerv;
+		GetBufferSubData = Switch_GetBufferSubData;
+		GetQueryObjectiv = Switch_GetQueryObjectiv;
+		GetQueryObjectuiv = Switch_GetQueryObjectuiv;
+		GetQueryiv = Switch_GetQueryiv;
+		IsBuffer = Switch_IsBuffer;
+		IsQuery = Switch_IsQuery;
+		MapBuffer = Switch_MapBuffer;
+		UnmapBuffer = Switch_UnmapBuffer;
+		AttachShader = Switch_AttachShader;
+		BindAttribLocation = Switch_BindAttribLocation;
+		BlendEquationSeparate = Switch_BlendEquationSeparate;
+		CompileShader = Switch_CompileShader;
+		CreateProgram = Switch_CreateProgram;
+		CreateShader = Switch_CreateShader;
+		DeleteProgram = Switch_DeleteProgram;
+		DeleteShader = Switch_DeleteShader;
+		DetachShader = Switch_DetachShader;
+		DisableVertexAttribArray = Switch_DisableVertexAttribArray;
+		DrawBuffers = Switch_DrawBuffers;
+		EnableVertexAttribArray = Switch_EnableVertexAttribArray;
+		GetActiveAttrib = Switch_GetActiveAttrib;
+		GetActiveUniform = Switch_GetActiveUniform;
+		GetAttachedShaders = Switch_GetAttachedShaders;
+		GetAttribLocation = Switch_GetAttribLocation;
+		GetProgramInfoLog = Switch_GetProgramInfoLog;
+		GetProgramiv = Switch_GetProgramiv;
+		GetShaderInfoLog = Switch_GetShaderInfoLog;
+		GetShaderSource = Switch_GetShaderSource;
+		GetShaderiv = Switch_GetShaderiv;
+		GetUniformLocation = Switch_GetUniformLocation;
+		GetUniformfv = Switch_GetUniformfv;
+		GetUniformiv = Switch_GetUniformiv;
+		GetVertexAttribPointerv = Switch_GetVertexAttribPointerv;
+		GetVertexAttribdv = Switch_GetVertexAttribdv;
+		GetVertexAttribfv = Switch_GetVertexAttribfv;
+		GetVertexAttribiv = Switch_GetVertexAttribiv;
+		IsProgram = Switch_IsProgram;
+		IsShader = Switch_IsShader;
+		LinkProgram = Switch_LinkProgram;
+		ShaderSource = Switch_ShaderSource;
+		StencilFuncSeparate = Switch_StencilFuncSeparate;
+		StencilMaskSeparate = Switch_StencilMaskSeparate;
+		StencilOpSeparate = Switch_StencilOpSeparate;
+		Uniform1f = Switch_Uniform1f;
+		Uniform1fv = Switch_Uniform1fv;
+		Uniform1i = Switch_Uniform1i;
+		Uniform1iv = Switch_Uniform1iv;
+		Uniform2f = Switch_Uniform2f;
+		Uniform2fv = Switch_Uniform2fv;
+		Uniform2i = Switch_Uniform2i;
+		Uniform2iv = Switch_Uniform2iv;
+		Uniform3f = Switch_Uniform3f;
+		Uniform3fv = Switch_Uniform3fv;
+		Uniform3i = Switch_Uniform3i;
+		Uniform3iv = Switch_Uniform3iv;
+		Uniform4f = Switch_Uniform4f;
+		Uniform4fv = Switch_Uniform4fv;
+		Uniform4i = Switch_Uniform4i;
+		Uniform4iv = Switch_Uniform4iv;
+		UniformMatrix2fv = Switch_UniformMatrix2fv;
+		UniformMatrix3fv = Switch_UniformMatrix3fv;
+		UniformMatrix4fv = Switch_UniformMatrix4fv;
+		UseProgram = Switch_UseProgram;
+		ValidateProgram = Switch_ValidateProgram;
+		VertexAttrib1d = Switch_VertexAttrib1d;
+		VertexAttrib1dv = Switch_VertexAttrib1dv;
+		VertexAttrib1f = Switch_VertexAttrib1f;
+		VertexAttrib1fv = Switch_VertexAttrib1fv;
+		VertexAttrib1s = Switch_VertexAttrib1s;
+		VertexAttrib1sv = Switch_VertexAttrib1sv;
+		VertexAttrib2d = Switch_VertexAttrib2d;
+		VertexAttrib2dv = Switch_VertexAttrib2dv;
+		VertexAttrib2f = Switch_VertexAttrib2f;
+		VertexAttrib2fv = Switch_VertexAttrib2fv;
+		VertexAttrib2s = Switch_VertexAttrib2s;
+		VertexAttrib2sv = Switch_VertexAttrib2sv;
+		VertexAttrib3d = Switch_VertexAttrib3d;
+		VertexAttrib3dv = Switch_VertexAttrib3dv;
+		VertexAttrib3f = Switch_VertexAttrib3f;
+		VertexAttrib3fv = Switch_VertexAttrib3fv;
+		VertexAttrib3s = Switch_VertexAttrib3s;
+		VertexAttrib3sv = Switch_VertexAttrib3sv;
+		VertexAttrib4Nbv = Switch_VertexAttrib4Nbv;
+		VertexAttrib4Niv = Switch_VertexAttrib4Niv;
+		VertexAttrib4Nsv = Switch_VertexAttrib4Nsv;
+		VertexAttrib4Nub = Switch_VertexAttrib4Nub;
+		VertexAttrib4Nubv = Switch_VertexAttrib4Nubv;
+		VertexAttrib4Nuiv = Switch_VertexAttrib4Nuiv;
+		VertexAttrib4Nusv = Switch_VertexAttrib4Nusv;
+		VertexAttrib4bv = Switch_VertexAttrib4bv;
+		VertexAttrib4d = Switch_VertexAttrib4d;
+		VertexAttrib4dv = Switch_VertexAttrib4dv;
+		VertexAttrib4f = Switch_VertexAttrib4f;
+		VertexAttrib4fv = Switch_VertexAttrib4fv;
+		VertexAttrib4iv = Switch_VertexAttrib4iv;
+		VertexAttrib4s = Switch_VertexAttrib4s;
+		VertexAttrib4sv = Switch_VertexAttrib4sv;
+		VertexAttrib4ubv = Switch_VertexAttrib4ubv;
+		VertexAttrib4uiv = Switch_VertexAttrib4uiv;
+		VertexAttrib4usv = Switch_VertexAttrib4usv;
+		VertexAttribPointer = Switch_VertexAttribPointer;
+		UniformMatrix2x3fv = Switch_UniformMatrix2x3fv;
+		UniformMatrix2x4fv = Switch_UniformMatrix2x4fv;
+		UniformMatrix3x2fv = Switch_UniformMatrix3x2fv;
+		UniformMatrix3x4fv = Switch_UniformMatrix3x4fv;
+		UniformMatrix4x2fv = Switch_UniformMatrix4x2fv;
+		UniformMatrix4x3fv = Switch_UniformMatrix4x3fv;
+		BeginConditionalRender = Switch_BeginConditionalRender;
+		BeginTransformFeedback = Switch_BeginTransformFeedback;
+		BindBufferBase = Switch_BindBufferBase;
+		BindBufferRange = Switch_BindBufferRange;
+		BindFragDataLocation = Switch_BindFragDataLocation;
+		BindFramebuffer = Switch_BindFramebuffer;
+		BindRenderbuffer = Switch_BindRenderbuffer;
+		BindVertexArray = Switch_BindVertexArray;
+		BlitFramebuffer = Switch_BlitFramebuffer;
+		CheckFramebufferStatus = Switch_CheckFramebufferStatus;
+		ClampColor = Switch_ClampColor;
+		ClearBufferfi = Switch_ClearBufferfi;
+		ClearBufferfv = Switch_ClearBufferfv;
+		ClearBufferiv = Switch_ClearBufferiv;
+		ClearBufferuiv = Switch_ClearBufferuiv;
+		ColorMaski = Switch_ColorMaski;
+		DeleteFramebuffers = Switch_DeleteFramebuffers;
+		DeleteRenderbuffers = Switch_DeleteRenderbuffers;
+		DeleteVertexArrays = Switch_DeleteVertexArrays;
+		Disablei = Switch_Disablei;
+		Enablei = Switch_Enablei;
+		EndConditionalRender = Switch_EndConditionalRender;
+		EndTransformFeedback = Switch_EndTransformFeedback;
+		FlushMappedBufferRange = Switch_FlushMappedBufferRange;
+		FramebufferRenderbuffer = Switch_FramebufferRenderbuffer;
+		FramebufferTexture1D = Switch_FramebufferTexture1D;
+		FramebufferTexture2D = Switch_FramebufferTexture2D;
+		FramebufferTexture3D = Switch_FramebufferTexture3D;
+		FramebufferTextureLayer = Switch_FramebufferTextureLayer;
+		GenFramebuffers = Switch_GenFramebuffers;
+		GenRenderbuffers = Switch_GenRenderbuffers;
+		GenVertexArrays = Switch_GenVertexArrays;
+		GenerateMipmap = Switch_GenerateMipmap;
+		GetBooleani_v = Switch_GetBooleani_v;
+		GetFragDataLocation = Switch_GetFragDataLocation;
+		GetFramebufferAttachmentParameteriv = Switch_GetFramebufferAttachmentParameteriv;
+		GetIntegeri_v = Switch_GetIntegeri_v;
+		GetRenderbufferParameteriv = Switch_GetRenderbufferParameteriv;
+		GetStringi = Switch_GetStringi;
+		GetTexParameterIiv = Switch_GetTexParameterIiv;
+		GetTexParameterIuiv = Switch_GetTexParameterIuiv;
+		GetTransformFeedbackVarying = Switch_GetTransformFeedbackVarying;
+		GetUniformuiv = Switch_GetUniformuiv;
+		GetVertexAttribIiv = Switch_GetVertexAttribIiv;
+		GetVertexAttribIuiv = Switch_GetVertexAttribIuiv;
+		IsEnabledi = Switch_IsEnabledi;
+		IsFramebuffer = Switch_IsFramebuffer;
+		IsRenderbuffer = Switch_IsRenderbuffer;
+		IsVertexArray = Switch_IsVertexArray;
+		MapBufferRange = Switch_MapBufferRange;
+		RenderbufferStorage = Switch_RenderbufferStorage;
+		RenderbufferStorageMultisample = Switch_RenderbufferStorageMultisample;
+		TexParameterIiv = Switch_TexParameterIiv;
+		TexParameterIuiv = Switch_TexParameterIuiv;
+		TransformFeedbackVaryings = Switch_TransformFeedbackVaryings;
+		Uniform1ui = Switch_Uniform1ui;
+		Uniform1uiv = Switch_Uniform1uiv;
+		Uniform2ui = Switch_Uniform2ui;
+		Uniform2uiv = Switch_Uniform2uiv;
+		Uniform3ui = Switch_Uniform3ui;
+		Uniform3uiv = Switch_Uniform3uiv;
+		Uniform4ui = Switch_Uniform4ui;
+		Uniform4uiv = Switch_Uniform4uiv;
+		VertexAttribI1i = Switch_VertexAttribI1i;
+		VertexAttribI1iv = Switch_VertexAttribI1iv;
+		VertexAttribI1ui = Switch_VertexAttribI1ui;
+		VertexAttribI1uiv = Switch_VertexAttribI1uiv;
+		VertexAttribI2i = Switch_VertexAttribI2i;
+		VertexAttribI2iv = Switch_VertexAttribI2iv;
+		VertexAttribI2ui = Switch_VertexAttribI2ui;
+		VertexAttribI2uiv = Switch_VertexAttribI2uiv;
+		VertexAttribI3i = Switch_VertexAttribI3i;
+		VertexAttribI3iv = Switch_VertexAttribI3iv;
+		VertexAttribI3ui = Switch_VertexAttribI3ui;
+		VertexAttribI3uiv = Switch_VertexAttribI3uiv;
+		VertexAttribI4bv = Switch_VertexAttribI4bv;
+		VertexAttribI4i = Switch_VertexAttribI4i;
+		VertexAttribI4iv = Switch_VertexAttribI4iv;
+		VertexAttribI4sv = Switch_VertexAttribI4sv;
+		VertexAttribI4ubv = Switch_VertexAttribI4ubv;
+		VertexAttribI4ui = Switch_VertexAttribI4ui;
+		VertexAttribI4uiv = Switch_VertexAttribI4uiv;
+		VertexAttribI4usv = Switch_VertexAttribI4usv;
+		VertexAttribIPointer = Switch_VertexAttribIPointer;
+		CopyBufferSubData = Switch_CopyBufferSubData;
+		DrawArraysInstanced = Switch_DrawArraysInstanced;
+		DrawElementsInstanced = Switch_DrawElementsInstanced;
+		GetActiveUniformBlockName = Switch_GetActiveUniformBlockName;
+		GetActiveUniformBlockiv = Switch_GetActiveUniformBlockiv;
+		GetActiveUniformName = Switch_GetActiveUniformName;
+		GetActiveUniformsiv = Switch_GetActiveUniformsiv;
+		GetUniformBlockIndex = Switch_GetUniformBlockIndex;
+		GetUniformIndices = Switch_GetUniformIndices;
+		PrimitiveRestartIndex = Switch_PrimitiveRestartIndex;
+		TexBuffer = Switch_TexBuffer;
+		UniformBlockBinding = Switch_UniformBlockBinding;
+		ClientWaitSync = Switch_ClientWaitSync;
+		DeleteSync = Switch_DeleteSync;
+		DrawElementsBaseVertex = Switch_DrawElementsBaseVertex;
+		DrawElementsInstancedBaseVertex = Switch_DrawElementsInstancedBaseVertex;
+		DrawRangeElementsBaseVertex = Switch_DrawRangeElementsBaseVertex;
+		FenceSync = Switch_FenceSync;
+		FramebufferTexture = Switch_FramebufferTexture;
+		GetBufferParameteri64v = Switch_GetBufferParameteri64v;
+		GetInteger64i_v = Switch_GetInteger64i_v;
+		GetInteger64v = Switch_GetInteger64v;
+		GetMultisamplefv = Switch_GetMultisamplefv;
+		GetSynciv = Switch_GetSynciv;
+		IsSync = Switch_IsSync;
+		MultiDrawElementsBaseVertex = Switch_MultiDrawElementsBaseVertex;
+		ProvokingVertex = Switch_ProvokingVertex;
+		SampleMaski = Switch_SampleMaski;
+		TexImage2DMultisample = Switch_TexImage2DMultisample;
+		TexImage3DMultisample = Switch_TexImage3DMultisample;
+		WaitSync = Switch_WaitSync;
+		BindFragDataLocationIndexed = Switch_BindFragDataLocationIndexed;
+		BindSampler = Switch_BindSampler;
+		DeleteSamplers = Switch_DeleteSamplers;
+		GenSamplers = Switch_GenSamplers;
+		GetFragDataIndex = Switch_GetFragDataIndex;
+		GetQueryObjecti64v = Switch_GetQueryObjecti64v;
+		GetQueryObjectui64v = Switch_GetQueryObjectui64v;
+		GetSamplerParameterIiv = Switch_GetSamplerParameterIiv;
+		GetSamplerParameterIuiv = Switch_GetSamplerParameterIuiv;
+		GetSamplerParameterfv = Switch_GetSamplerParameterfv;
+		GetSamplerParameteriv = Switch_GetSamplerParameteriv;
+		IsSampler = Switch_IsSampler;
+		QueryCounter = Switch_QueryCounter;
+		SamplerParameterIiv = Switch_SamplerParameterIiv;
+		SamplerParameterIuiv = Switch_SamplerParameterIuiv;
+		SamplerParameterf = Switch_SamplerParameterf;
+		SamplerParameterfv = Switch_SamplerParameterfv;
+		SamplerParameteri = Switch_SamplerParameteri;
+		SamplerParameteriv = Switch_SamplerParameteriv;
+		VertexAttribDivisor = Switch_VertexAttribDivisor;
+		VertexAttribP1ui = Switch_VertexAttribP1ui;
+		VertexAttribP1uiv = Switch_VertexAttribP1uiv;
+		VertexAttribP2ui = Switch_VertexAttribP2ui;
+		VertexAttribP2uiv = Switch_VertexAttribP2uiv;
+		VertexAttribP3ui = Switch_VertexAttribP3ui;
+		VertexAttribP3uiv = Switch_VertexAttribP3uiv;
+		VertexAttribP4ui = Switch_VertexAttribP4ui;
+		VertexAttribP4uiv = Switch_VertexAttribP4uiv;
+		BeginQueryIndexed = Switch_BeginQueryIndexed;
+		BindTransformFeedback = Switch_BindTransformFeedback;
+		BlendEquationSeparatei = Switch_BlendEquationSeparatei;
+		BlendEquationi = Switch_BlendEquationi;
+		BlendFuncSeparatei = Switch_BlendFuncSeparatei;
+		BlendFunci = Switch_BlendFunci;
+		DeleteTransformFeedbacks = Switch_DeleteTransformFeedbacks;
+		DrawArraysIndirect = Switch_DrawArraysIndirect;
+		DrawElementsIndirect = Switch_DrawElementsIndirect;
+		DrawTransformFeedback = Switch_DrawTransformFeedback;
+		DrawTransformFeedbackStream = Switch_DrawTransformFeedbackStream;
+		EndQueryIndexed = Switch_EndQueryIndexed;
+		GenTransformFeedbacks = Switch_GenTransformFeedbacks;
+		GetActiveSubroutineName = Switch_GetActiveSubroutineName;
+		GetActiveSubroutineUniformName = Switch_GetActiveSubroutineUniformName;
+		GetActiveSubroutineUniformiv = Switch_GetActiveSubroutineUniformiv;
+		GetProgramStageiv = Switch_GetProgramStageiv;
+		GetQueryIndexediv = Switch_GetQueryIndexediv;
+		GetSubroutineIndex = Switch_GetSubroutineIndex;
+		GetSubroutineUniformLocation = Switch_GetSubroutineUniformLocation;
+		GetUniformSubroutineuiv = Switch_GetUniformSubroutineuiv;
+		GetUniformdv = Switch_GetUniformdv;
+		IsTransformFeedback = Switch_IsTransformFeedback;
+		MinSampleShading = Switch_MinSampleShading;
+		PatchParameterfv = Switch_PatchParameterfv;
+		PatchParameteri = Switch_PatchParameteri;
+		PauseTransformFeedback = Switch_PauseTransformFeedback;
+		ResumeTransformFeedback = Switch_ResumeTransformFeedback;
+		Uniform1d = Switch_Uniform1d;
+		Uniform1dv = Switch_Uniform1dv;
+		Uniform2d = Switch_Uniform2d;
+		Uniform2dv = Switch_Uniform2dv;
+		Uniform3d = Switch_Uniform3d;
+		Uniform3dv = Switch_Uniform3dv;
+		Uniform4d = Switch_Uniform4d;
+		Uniform4dv = Switch_Uniform4dv;
+		UniformMatrix2dv = Switch_UniformMatrix2dv;
+		UniformMatrix2x3dv = Switch_UniformMatrix2x3dv;
+		UniformMatrix2x4dv = Switch_UniformMatrix2x4dv;
+		UniformMatrix3dv = Switch_UniformMatrix3dv;
+		UniformMatrix3x2dv = Switch_UniformMatrix3x2dv;
+		UniformMatrix3x4dv = Switch_UniformMatrix3x4dv;
+		UniformMatrix4dv = Switch_UniformMatrix4dv;
+		UniformMatrix4x2dv = Switch_UniformMatrix4x2dv;
+		UniformMatrix4x3dv = Switch_UniformMatrix4x3dv;
+		UniformSubroutinesuiv = Switch_UniformSubroutinesuiv;
+		ActiveShaderProgram = Switch_ActiveShaderProgram;
+		BindProgramPipeline = Switch_BindProgramPipeline;
+		ClearDepthf = Switch_ClearDepthf;
+		CreateShaderProgramv = Switch_CreateShaderProgramv;
+		DeleteProgramPipelines = Switch_DeleteProgramPipelines;
+		DepthRangeArrayv = Switch_DepthRangeArrayv;
+		DepthRangeIndexed = Switch_DepthRangeIndexed;
+		DepthRangef = Switch_DepthRangef;
+		GenProgramPipelines = Switch_GenProgramPipelines;
+		GetDoublei_v = Switch_GetDoublei_v;
+		GetFloati_v = Switch_GetFloati_v;
+		GetProgramBinary = Switch_GetProgramBinary;
+		GetProgramPipelineInfoLog = Switch_GetProgramPipelineInfoLog;
+		GetProgramPipelineiv = Switch_GetProgramPipelineiv;
+		GetShaderPrecisionFormat = Switch_GetShaderPrecisionFormat;
+		GetVertexAttribLdv = Switch_GetVertexAttribLdv;
+		IsProgramPipeline = Switch_IsProgramPipeline;
+		ProgramBinary = Switch_ProgramBinary;
+		ProgramParameteri = Switch_ProgramParameteri;
+		ProgramUniform1d = Switch_ProgramUniform1d;
+		ProgramUniform1dv = Switch_ProgramUniform1dv;
+		ProgramUniform1f = Switch_ProgramUniform1f;
+		ProgramUniform1fv = Switch_ProgramUniform1fv;
+		ProgramUniform1i = Switch_ProgramUniform1i;
+		ProgramUniform1iv = Switch_ProgramUniform1iv;
+		ProgramUniform1ui = Switch_ProgramUniform1ui;
+		ProgramUniform1uiv = Switch_ProgramUniform1uiv;
+		ProgramUniform2d = Switch_ProgramUniform2d;
+		ProgramUniform2dv = Switch_ProgramUniform2dv;
+		ProgramUniform2f = Switch_ProgramUniform2f;
+		ProgramUniform2fv = Switch_ProgramUniform2fv;
+		ProgramUniform2i = Switch_ProgramUniform2i;
+		ProgramUniform2iv = Switch_ProgramUniform2iv;
+		ProgramUniform2ui = Switch_ProgramUniform2ui;
+		ProgramUniform2uiv = Switch_ProgramUniform2uiv;
+		ProgramUniform3d = Switch_ProgramUniform3d;
+		ProgramUniform3dv = Switch_ProgramUniform3dv;
+		ProgramUniform3f = Switch_ProgramUniform3f;
+		ProgramUniform3fv = Switch_ProgramUniform3fv;
+		ProgramUniform3i = Switch_ProgramUniform3i;
+		ProgramUniform3iv = Switch_ProgramUniform3iv;
+		ProgramUniform3ui = Switch_ProgramUniform3ui;
+		ProgramUniform3uiv = Switch_ProgramUniform3uiv;
+		ProgramUniform4d = Switch_ProgramUniform4d;
+		ProgramUniform4dv = Switch_ProgramUniform4dv;
+		ProgramUniform4f = Switch_ProgramUniform4f;
+		ProgramUniform4fv = Switch_ProgramUniform4fv;
+		ProgramUniform4i = Switch_ProgramUniform4i;
+		ProgramUniform4iv = Switch_ProgramUniform4iv;
+		ProgramUniform4ui = Switch_ProgramUniform4ui;
+		ProgramUniform4uiv = Switch_ProgramUniform4uiv;
+		ProgramUniformMatrix2dv = Switch_ProgramUniformMatrix2dv;
+		ProgramUniformMatrix2fv = Switch_ProgramUniformMatrix2fv;
+		ProgramUniformMatrix2x3dv = Switch_ProgramUniformMatrix2x3dv;
+		ProgramUniformMatrix2x3fv = Switch_ProgramUniformMatrix2x3fv;
+		ProgramUniformMatrix2x4dv = Switch_ProgramUniformMatrix2x4dv;
+		ProgramUniformMatrix2x4fv = Switch_ProgramUniformMatrix2x4fv;
+		ProgramUniformMatrix3dv = Switch_ProgramUniformMatrix3dv;
+		ProgramUniformMatrix3fv = Switch_ProgramUniformMatrix3fv;
+		ProgramUniformMatrix3x2dv = Switch_ProgramUniformMatrix3x2dv;
+		ProgramUniformMatrix3x2fv = Switch_ProgramUniformMatrix3x2fv;
+		ProgramUniformMatrix3x4dv = Switch_ProgramUniformMatrix3x4dv;
+		ProgramUniformMatrix3x4fv = Switch_ProgramUniformMatrix3x4fv;
+		ProgramUniformMatrix4dv = Switch_ProgramUniformMatrix4dv;
+		ProgramUniformMatrix4fv = Switch_ProgramUniformMatrix4fv;
+		ProgramUniformMatrix4x2dv = Switch_ProgramUniformMatrix4x2dv;
+		ProgramUniformMatrix4x2fv = Switch_ProgramUniformMatrix4x2fv;
+		ProgramUniformMatrix4x3dv = Switch_ProgramUniformMatrix4x3dv;
+		ProgramUniformMatrix4x3fv = Switch_ProgramUniformMatrix4x3fv;
+		ReleaseShaderCompiler = Switch_ReleaseShaderCompiler;
+		ScissorArrayv = Switch_ScissorArrayv;
+		ScissorIndexed = Switch_ScissorIndexed;
+		ScissorIndexedv = Switch_ScissorIndexedv;
+		ShaderBinary = Switch_ShaderBinary;
+		UseProgramStages = Switch_UseProgramStages;
+		ValidateProgramPipeline = Switch_ValidateProgramPipeline;
+		VertexAttribL1d = Switch_VertexAttribL1d;
+		VertexAttribL1dv = Switch_VertexAttribL1dv;
+		VertexAttribL2d = Switch_VertexAttribL2d;
+		VertexAttribL2dv = Switch_VertexAttribL2dv;
+		VertexAttribL3d = Switch_VertexAttribL3d;
+		VertexAttribL3dv = Switch_VertexAttribL3dv;
+		VertexAttribL4d = Switch_VertexAttribL4d;
+		VertexAttribL4dv = Switch_VertexAttribL4dv;
+		VertexAttribLPointer = Switch_VertexAttribLPointer;
+		ViewportArrayv = Switch_ViewportArrayv;
+		ViewportIndexedf = Switch_ViewportIndexedf;
+		ViewportIndexedfv = Switch_ViewportIndexedfv;
+		BindImageTexture = Switch_BindImageTexture;
+		DrawArraysInstancedBaseInstance = Switch_DrawArraysInstancedBaseInstance;
+		DrawElementsInstancedBaseInstance = Switch_DrawElementsInstancedBaseInstance;
+		DrawElementsInstancedBaseVertexBaseInstance = Switch_DrawElementsInstancedBaseVertexBaseInstance;
+		DrawTransformFeedbackInstanced = Switch_DrawTransformFeedbackInstanced;
+		DrawTransformFeedbackStreamInstanced = Switch_DrawTransformFeedbackStreamInstanced;
+		GetActiveAtomicCounterBufferiv = Switch_GetActiveAtomicCounterBufferiv;
+		GetInternalformativ = Switch_GetInternalformativ;
+		MemoryBarrier_ = Switch_MemoryBarrier_;
+		TexStorage1D = Switch_TexStorage1D;
+		TexStorage2D = Switch_TexStorage2D;
+		TexStorage3D = Switch_TexStorage3D;
+		BindVertexBuffer = Switch_BindVertexBuffer;
+		ClearBufferData = Switch_ClearBufferData;
+		ClearBufferSubData = Switch_ClearBufferSubData;
+		CopyImageSubData = Switch_CopyImageSubData;
+		DebugMessageCallback = Switch_DebugMessageCallback;
+		DebugMessageControl = Switch_DebugMessageControl;
+		DebugMessageInsert = Switch_DebugMessageInsert;
+		DispatchCompute = Switch_DispatchCompute;
+		DispatchComputeIndirect = Switch_DispatchComputeIndirect;
+		FramebufferParameteri = Switch_FramebufferParameteri;
+		GetDebugMessageLog = Switch_GetDebugMessageLog;
+		GetFramebufferParameteriv = Switch_GetFramebufferParameteriv;
+		GetInternalformati64v = Switch_GetInternalformati64v;
+		GetObjectLabel = Switch_GetObjectLabel;
+		GetObjectPtrLabel = Switch_GetObjectPtrLabel;
+		GetProgramInterfaceiv = Switch_GetProgramInterfaceiv;
+		GetProgramResourceIndex = Switch_GetProgramResourceIndex;
+		GetProgramResourceLocation = Switch_GetProgramResourceLocation;
+		GetProgramResourceLocationIndex = Switch_GetProgramResourceLocationIndex;
+		GetProgramResourceName = Switch_GetProgramResourceName;
+		GetProgramResourceiv = Switch_GetProgramResourceiv;
+		InvalidateBufferData = Switch_InvalidateBufferData;
+		InvalidateBufferSubData = Switch_InvalidateBufferSubData;
+		InvalidateFramebuffer = Switch_InvalidateFramebuffer;
+		InvalidateSubFramebuffer = Switch_InvalidateSubFramebuffer;
+		InvalidateTexImage = Switch_InvalidateTexImage;
+		InvalidateTexSubImage = Switch_InvalidateTexSubImage;
+		MultiDrawArraysIndirect = Switch_MultiDrawArraysIndirect;
+		MultiDrawElementsIndirect = Switch_MultiDrawElementsIndirect;
+		ObjectLabel = Switch_ObjectLabel;
+		ObjectPtrLabel = Switch_ObjectPtrLabel;
+		PopDebugGroup = Switch_PopDebugGroup;
+		PushDebugGroup = Switch_PushDebugGroup;
+		ShaderStorageBlockBinding = Switch_ShaderStorageBlockBinding;
+		TexBufferRange = Switch_TexBufferRange;
+		TexStorage2DMultisample = Switch_TexStorage2DMultisample;
+		TexStorage3DMultisample = Switch_TexStorage3DMultisample;
+		TextureView = Switch_TextureView;
+		VertexAttribBinding = Switch_VertexAttribBinding;
+		VertexAttribFormat = Switch_VertexAttribFormat;
+		VertexAttribIFormat = Switch_VertexAttribIFormat;
+		VertexAttribLFormat = Switch_VertexAttribLFormat;
+		VertexBindingDivisor = Switch_VertexBindingDivisor;
+		BindBuffersBase = Switch_BindBuffersBase;
+		BindBuffersRange = Switch_BindBuffersRange;
+		BindImageTextures = Switch_BindImageTextures;
+		BindSamplers = Switch_BindSamplers;
+		BindTextures = Switch_BindTextures;
+		BindVertexBuffers = Switch_BindVertexBuffers;
+		BufferStorage = Switch_BufferStorage;
+		ClearTexImage = Switch_ClearTexImage;
+		ClearTexSubImage = Switch_ClearTexSubImage;
+	}
 	
 	static int LoadCoreFunctions()
 	{
@@ -2292,52 +6134,39 @@ namespace gl
 	{
 		namespace 
 		{
-			typedef int (*PFN_LOADEXTENSION)();
-			struct MapEntry
-			{
-				MapEntry(const char *_extName, exts::LoadTest *_extVariable)
-					: extName(_extName)
-					, extVariable(_extVariable)
-					, loaderFunc(0)
-					{}
-					
-				MapEntry(const char *_extName, exts::LoadTest *_extVariable, PFN_LOADEXTENSION _loaderFunc)
-					: extName(_extName)
-					, extVariable(_extVariable)
-					, loaderFunc(_loaderFunc)
-					{}
-				
-				const char *extName;
-				exts::LoadTest *extVariable;
-				PFN_LOADEXTENSION loaderFunc;
-			};
+			// Names reported by the driver, sorted by hash. GL keeps the
+			// strings alive for the context, so only pointers are stored.
+			typedef std::pair<unsigned long long, const char *> ExtensionName;
+			std::vector<ExtensionName> g_extensions;
 			
-			struct MapCompare
+			// Order by hash alone; the pointers say nothing about the names.
+			bool HashLess(const ExtensionName &left, const ExtensionName &right)
 			{
-				MapCompare(const char *test_) : test(test_) {}
-				bool operator()(const MapEntry &other) { return strcmp(test, other.extName) == 0; }
-				const char *test;
-			};
+				return left.first < right.first;
+			}
 			
-			void InitializeMappingTable(std::vector<MapEntry> &table)
+			bool HashBelow(const ExtensionName &entry, unsigned long long hash)
 			{
-				table.reserve(0);
+				return entry.first < hash;
 			}
 			
 			void ClearExtensionVars()
 			{
+				exts::var_KHR_parallel_shader_compile = exts::LoadTest();
+				g_extensions.clear();
 			}
 			
-			void LoadExtByName(std::vector<MapEntry> &table, const char *extensionName)
+			// One case per supported extension, of which there is only one
+			// so far. The hashes are computed at compile time, and two names
+			// colliding would be a duplicate case label; strcmp confirms.
+			void LoadExtByName(const char *extensionName)
 			{
-				std::vector<MapEntry>::iterator entry = std::find_if(table.begin(), table.end(), MapCompare(extensionName));
-				
-				if(entry != table.end())
+				switch(HashExtensionName(extensionName))
 				{
-					if(entry->loaderFunc)
-						(*entry->extVariable) = exts::LoadTest(true, entry->loaderFunc());
-					else
-						(*entry->extVariable) = exts::LoadTest(true, 0);
+				case HashExtensionName("GL_KHR_parallel_shader_compile"):
+					if(strcmp(extensionName, "GL_KHR_parallel_shader_compile") == 0)
+						exts::var_KHR_parallel_shader_compile = exts::LoadTest(true, Load_KHR_parallel_shader_compile());
+					break;
 				}
 			}
 		} //namespace 
@@ -2345,17 +6174,25 @@ namespace gl
 		
 		namespace 
 		{
-			static void ProcExtsFromExtList(std::vector<MapEntry> &table)
+			static void ProcExtsFromExtList()
 			{
 				GLint iLoop;
 				GLint iNumExtensions = 0;
 				gl::GetIntegerv(gl::NUM_EXTENSIONS, &iNumExtensions);
+				
+				g_extensions.reserve(iNumExtensions);
 			
 				for(iLoop = 0; iLoop < iNumExtensions; iLoop++)
 				{
 					const char *strExtensionName = (const char *)gl::GetStringi(gl::EXTENSIONS, iLoop);
-					LoadExtByName(table, strExtensionName);
+					
+					if(!strExtensionName) continue;
+					
+					g_extensions.push_back(ExtensionName(HashExtensionName(strExtensionName), strExtensionName));
+					LoadExtByName(strExtensionName);
 				}
+				
+				std::sort(g_extensions.begin(), g_extensions.end(), HashLess);
 			}
 			
 		} //namespace 
@@ -2363,20 +6200,59 @@ namespace gl
 		exts::LoadTest LoadFunctions()
 		{
 			ClearExtensionVars();
-			std::vector<MapEntry> table;
-			InitializeMappingTable(table);
 			
 			GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
 			if(!GetIntegerv) return exts::LoadTest();
 			GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
 			if(!GetStringi) return exts::LoadTest();
 			
-			ProcExtsFromExtList(table);
+			ProcExtsFromExtList();
 			
 			int numFailed = LoadCoreFunctions();
+			g_resolved_count = CORE_FUNCTION_COUNT - numFailed;
 			return exts::LoadTest(true, numFailed);
 		}
 		
+		exts::LoadTest LoadFunctionsLazy()
+		{
+			ClearExtensionVars();
+			ResetCoreFunctions();
+			g_resolved_count = 0;
+			
+			GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
+			if(!GetIntegerv) return exts::LoadTest();
+			GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
+			if(!GetStringi) return exts::LoadTest();
+			g_resolved_count = 2;
+			
+			ProcExtsFromExtList();
+			
+			return exts::LoadTest(true, 0);
+		}
+		
+		bool HasExtension(const char *extensionName)
+		{
+			unsigned long long hash = HashExtensionName(extensionName);
+			std::vector<ExtensionName>::const_iterator entry =
+				std::lower_bound(g_extensions.begin(), g_extensions.end(), hash, HashBelow);
+			
+			for(; entry != g_extensions.end() && entry->first == hash; ++entry)
+				if(strcmp(entry->second, extensionName) == 0)
+					return true;
+			
+			return false;
+		}
+		
+		int GetResolvedCount()
+		{
+			return g_resolved_count;
+		}
+		
+		int GetFunctionCount()
+		{
+			return CORE_FUNCTION_COUNT;
+		}
+		
 		static int g_major_version = 0;
 		static int g_minor_version = 0;
 		
@@ -174,9 +174,14 @@ namespace gl
 			int m_numMissing;
 		};
 		
+		extern LoadTest var_KHR_parallel_shader_compile;
+		
 	} //namespace exts
 	enum
 	{
+		COMPLETION_STATUS_KHR            = 0x91B1,
+		MAX_SHADER_COMPILER_THREADS_KHR  = 0x91B0,
+		
 		ALPHA                            = 0x1906,
 		ALWAYS                           = 0x0207,
 		AND                              = 0x1501,
@@ -1501,6 +1506,9 @@ namespace gl
 		TRANSFORM_FEEDBACK_BUFFER_STRIDE = 0x934C,
 		
 	};
+	
+	extern void (CODEGEN_FUNCPTR *MaxShaderCompilerThreadsKHR)(GLuint count);
+	
 	extern void (CODEGEN_FUNCPTR *BlendFunc)(GLenum sfactor, GLenum dfactor);
 	extern void (CODEGEN_FUNCPTR *Clear)(GLbitfield mask);
 	extern void (CODEGEN_FUNCPTR *ClearColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
@@ -2064,6 +2072,27 @@ namespace gl
 		
 		exts::LoadTest LoadFunctions();
 		
+		// Leaves core functions to resolve themselves on first call; only
+		// extensions are checked up front. Missing core functions can't be
+		// known until called, so the failure count is always 0; calling
+		// one prints its name to stderr and aborts. Use LoadFunctions()
+		// where a missing function has to be caught at startup.
+		exts::LoadTest LoadFunctionsLazy();
+		
+		// FNV-1a over an extension name; usable in constant expressions.
+		constexpr unsigned long long HashExtensionName(const char *name, unsigned long long value = 14695981039346656037ULL)
+		{
+			return *name ? HashExtensionName(name + 1, (value ^ (unsigned char)*name)*1099511628211ULL) : value;
+		}
+		
+		// Whether the current context reports an extension, e.g.
+		// "GL_ARB_bindless_texture". Valid after LoadFunctions*().
+		bool HasExtension(const char *extensionName);
+		
+		// Core entry points resolved so far, out of GetFunctionCount().
+		int GetResolvedCount();
+		int GetFunctionCount();
+		
 		int GetMinorVersion();
 		int GetMajorVersion();
 		bool IsVersionGEQ(int majorVersion, int minorVersion);
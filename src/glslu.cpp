@@ -1,10 +1,21 @@
 #include "glslu.hpp"
+#include "ringbuffer.hpp"
 
 #include <iostream>
 #include <iomanip>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
 
 #include <glm/glm.hpp>
 
@@ -43,6 +54,213 @@ namespace glslu
 	};
     }
     
+    // Range append
+    void ShaderSource::append(const char* data, size_t length)
+    {
+	if(length == 0) return;
+	
+	strings.push_back(data);
+	lengths.push_back((GLint)length);
+    }
+    
+    // Owned text append
+    void ShaderSource::appendDirective(const string& text)
+    {
+	directives.push_back(text);
+	append(directives.back().data(), directives.back().size());
+    }
+    
+    // Map a file to point ranges into, for the life of the source
+    const sysu::MappedFile& ShaderSource::map(const string& path)
+	throw(sysu::SystemException)
+    {
+	mappings.emplace_back(path);
+	
+	return mappings.back();
+    }
+    
+    // Flatten, for hashing or display
+    string ShaderSource::toString(void) const
+    {
+	string text;
+	
+	for(size_t range = 0; range < strings.size(); ++range)
+	    text.append(strings[range], lengths[range]);
+	
+	return text;
+    }
+    
+    // The one cache
+    SourceCache& SourceCache::getInstance(void)
+    {
+	static SourceCache cache;
+	
+	return cache;
+    }
+    
+    // Key form of a path
+    string SourceCache::normalizePath(const string& filename)
+    {
+	size_t slash = filename.find_last_of("/\\");
+	
+	if(slash == string::npos)
+	    return "./" + filename;
+	
+	return filename.substr(0, slash) + "/" + filename.substr(slash + 1);
+    }
+    
+    // Map a file into source, splitting it at its include lines unless it
+    // was split before at this size and time
+    const SourceCache::CachedFile& SourceCache::getFile(const string& path, ShaderSource& source, const char*& text)
+	throw(ProgramException)
+    {
+	struct stat info;
+	
+	if(stat(path.c_str(), &info) != 0) {
+	    stringstream buffer;
+	    
+	    buffer << "Could not find shader \"" << path << "\". Did it escape?";
+	    
+	    throw ProgramException(buffer.str());
+	}
+	
+	const sysu::MappedFile* file;
+	
+	try {
+	    file = &source.map(path);
+	} catch(sysu::SystemException& exception) {
+	    stringstream buffer;
+	    
+	    buffer << "Could not open \"" << path << "\", access denied! :(";
+	    
+	    throw ProgramException(buffer.str());
+	}
+	
+	text = file->data();
+	
+	std::map<string, CachedFile>::iterator position = files.find(path);
+	
+	// The size check also catches a write between the stat and the map.
+	if(position != files.end() && position->second.modified == (long long)info.st_mtime
+	   && position->second.size == (long long)info.st_size && file->size() == (size_t)info.st_size)
+	    return position->second;
+	
+	CachedFile& cached = files[path];
+	
+	cached.modified = (long long)info.st_mtime;
+	cached.size = (long long)file->size();
+	cached.pieces.clear();
+	
+	// Scan line by line for: #include "name"
+	const char* end = text + file->size();
+	const char* pieceStart = text;
+	int line = 1;
+	
+	for(const char* lineStart = text; lineStart < end; ++line) {
+	    const char* lineEnd = std::find(lineStart, end, '\n');
+	    const char* cursor = lineStart;
+	    
+	    while(cursor < lineEnd && (*cursor == ' ' || *cursor == '\t')) ++cursor;
+	    
+	    if(cursor < lineEnd && *cursor == '#') {
+		++cursor;
+		
+		while(cursor < lineEnd && (*cursor == ' ' || *cursor == '\t')) ++cursor;
+		
+		if(lineEnd - cursor > 7 && strncmp(cursor, "include", 7) == 0) {
+		    const char* open = std::find(cursor + 7, lineEnd, '"');
+		    const char* close = open < lineEnd ? std::find(open + 1, lineEnd, '"') : lineEnd;
+		    
+		    if(close < lineEnd) {
+			Piece before, include;
+			
+			before.offset = pieceStart - text;
+			before.length = lineStart - pieceStart;
+			before.nextLine = 0;
+			
+			include.offset = 0;
+			include.length = 0;
+			include.include = string(open + 1, close);
+			include.nextLine = line + 1;
+			
+			cached.pieces.push_back(before);
+			cached.pieces.push_back(include);
+			
+			pieceStart = lineEnd < end ? lineEnd + 1 : end;
+		    }
+		}
+	    }
+	    
+	    lineStart = lineEnd < end ? lineEnd + 1 : end;
+	}
+	
+	Piece rest;
+	
+	rest.offset = pieceStart - text;
+	rest.length = end - pieceStart;
+	rest.nextLine = 0;
+	
+	cached.pieces.push_back(rest);
+	
+	return cached;
+    }
+    
+    // Splice a file into source, recursing into includes not seen yet
+    void SourceCache::append(const string& path, ShaderSource& source)
+	throw(ProgramException)
+    {
+	const char* text;
+	const CachedFile& cached = getFile(path, source, text);
+	int index = (int)source.files.size();
+	string directory = path.substr(0, path.find_last_of('/'));
+	
+	source.files.push_back(path);
+	
+	for(size_t piece = 0; piece < cached.pieces.size(); ++piece) {
+	    const Piece& current = cached.pieces[piece];
+	    
+	    if(current.nextLine == 0) {
+		source.append(text + current.offset, current.length);
+		continue;
+	    }
+	    
+	    string included = normalizePath(directory + "/" + current.include);
+	    stringstream resume;
+	    
+	    if(std::find(source.files.begin(), source.files.end(), included) == source.files.end()) {
+		stringstream start;
+		
+		start << "\n#line 1 " << source.files.size() << "\n";
+		source.appendDirective(start.str());
+		
+		append(included, source);
+	    }
+	    
+	    // Keep error line numbers true to the including file.
+	    resume << "\n#line " << current.nextLine << " " << index << "\n";
+	    source.appendDirective(resume.str());
+	}
+    }
+    
+    // Assemble a shader
+    void SourceCache::load(const string& filename, ShaderSource& source)
+	throw(ProgramException)
+    {
+	append(normalizePath(filename), source);
+    }
+    
+    // Drop one file
+    void SourceCache::invalidate(const string& filename)
+    {
+	files.erase(normalizePath(filename));
+    }
+    
+    // Drop everything
+    void SourceCache::clear(void)
+    {
+	files.clear();
+    }
+    
     // Constructor
     Program::Program(void):
 	handle(0), linked(false) {}
@@ -77,29 +295,82 @@ namespace glslu
     // Link accessor
     bool Program::isLinked(void) { return linked; }
     
+    // Record a source file
+    void Program::addShaderFile(const string& filename, ShaderType type)
+    {
+	for(size_t file = 0; file < shaderFiles.size(); ++file)
+	    if(shaderFiles[file].filename == filename)
+		return;
+	
+	ShaderFile shaderFile;
+	
+	shaderFile.filename = filename;
+	shaderFile.type = type;
+	
+	shaderFiles.push_back(shaderFile);
+    }
+    
+    // Program exchange
+    void Program::swap(Program& other)
+    {
+	std::swap(handle, other.handle);
+	std::swap(linked, other.linked);
+	uniformLocations.swap(other.uniformLocations);
+	shaderFiles.swap(other.shaderFiles);
+    }
+    
     // Get the location of a uniform based on its name
     int Program::getUniformLocation(const string& name)
     {
-	std::map<string, int>::iterator position;
+	std::unordered_map<string, GLint>::iterator position;
 	position = uniformLocations.find(name);
 	
 	// If the name could not be found, query and store it for future checks.
 	if(position == uniformLocations.end())
-	    uniformLocations[name] = gl::GetUniformLocation(handle, name.c_str());
+	    position = uniformLocations.insert(std::make_pair(name, gl::GetUniformLocation(handle, name.c_str()))).first;
 	
-	return uniformLocations[name];
+	return position->second;
     }
     
-    // Check to see if a file exists
-    // NOTE: stat is considerably faster, look at using that if it isn't screwy as heck
-    bool Program::fileExists(const string& filename)
+    // Fill the location table from the active uniforms, so lookups after
+    // linking never have to ask GL.
+    void Program::reflectUniforms(void)
     {
-	if(FILE *file = fopen(filename.c_str(), "r")) {
-	    fclose(file);
+	uniformLocations.clear();
+	
+	GLint uniformCount = 0;
+	gl::GetProgramInterfaceiv(handle, gl::UNIFORM, gl::ACTIVE_RESOURCES, &uniformCount);
+	
+	GLenum properties[] = {gl::NAME_LENGTH, gl::LOCATION, gl::ARRAY_SIZE, gl::BLOCK_INDEX};
+	
+	for(int curr = 0; curr < uniformCount; ++curr) {
+	    GLint results[4];
+	    gl::GetProgramResourceiv(handle, gl::UNIFORM, curr, 4, properties, 4, NULL, results);
 	    
-	    return true;
-	} else {
-	    return false;
+	    // Block members have no location.
+	    if(results[3] != -1) continue;
+	    
+	    char* c_name = new char[results[0] + 1];
+	    gl::GetProgramResourceName(handle, gl::UNIFORM, curr, results[0] + 1, NULL, c_name);
+	    
+	    string name = c_name;
+	    delete[] c_name;
+	    
+	    uniformLocations[name] = results[1];
+	    
+	    // Arrays report "name[0]"; elements sit at consecutive locations.
+	    if(name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+		string base = name.substr(0, name.size() - 3);
+		
+		uniformLocations[base] = results[1];
+		
+		for(int element = 1; element < results[2]; ++element) {
+		    stringstream elementName;
+		    
+		    elementName << base << "[" << element << "]";
+		    uniformLocations[elementName.str()] = results[1] + element;
+		}
+	    }
 	}
     }
     
@@ -133,88 +404,82 @@ namespace glslu
 	}
     }
     
-    // Type-smart shader compiler
-    void Program::compileShader(const string& filename)
+    // Shader type from a filename's extension
+    ShaderType Program::getShaderType(const string& filename)
 	throw(ProgramException)
     {
 	int extensionCount = sizeof(ShaderInfo::extensions)/sizeof(ShaderInfo::shader_file_extension);
 	
 	// Check for valid file extension.
 	string extension = getExtension(filename);
-	ShaderType type;
-	bool found = false;
 	
-	for(int ext = 0; ext < extensionCount; ++ext) {
-	    if(extension == ShaderInfo::extensions[ext].extension) {
-		found = true;
-		type = ShaderInfo::extensions[ext].type;
-		
-		break;
-	    }
-	}
+	for(int ext = 0; ext < extensionCount; ++ext)
+	    if(extension == ShaderInfo::extensions[ext].extension)
+		return ShaderInfo::extensions[ext].type;
 	
 	// Throw an exception if not found!
-	if(!found) {
-	    stringstream buffer;
-	    
-	    buffer << "Unrecognized shader extension: \'" << extension << "\'!" << endl
-		   << "\tExpected: ";
-	    
-	    for(int ext = 0; ext < extensionCount; ++ext)
-		buffer << (ext != 0 ? ", " : "") << ShaderInfo::extensions[ext].extension;
-	    
-	    throw ProgramException(buffer.str());
-	}
+	stringstream buffer;
+	
+	buffer << "Unrecognized shader extension: \'" << extension << "\'!" << endl
+	       << "\tExpected: ";
 	
-	// Pass the information onto the next compile function
-	compileShader(filename, type);
+	for(int ext = 0; ext < extensionCount; ++ext)
+	    buffer << (ext != 0 ? ", " : "") << ShaderInfo::extensions[ext].extension;
+	
+	throw ProgramException(buffer.str());
     }
     
-    // Source-retriving shader compiler
-    void Program::compileShader(const string& filename, ShaderType type)
+    // Read a whole shader file, includes resolved
+    string Program::readSource(const string& filename)
 	throw(ProgramException)
     {
-	// Test file existance!
-	if(!fileExists(filename)) {
-	    stringstream buffer;
-	    
-	    buffer << "Could not find shader \"" << filename << "\". Did it escape?";
-	    
-	    throw ProgramException(buffer.str());
-	}
+	ShaderSource source;
 	
-	// Create program if necessary.
-	if(handle <= 0) {
-	    handle = gl::CreateProgram();
-	    
-	    if(handle == 0)
-		throw ProgramException("Could not create shader program.");
-	}
-	
-	// Open file
-	ifstream shader(filename.c_str(), ios::in);
-	
-	if(!shader) {
-	    stringstream buffer;
-	    
-	    buffer << "Could not open \"" << filename << "\", access denied! :(";
-	    
-	    throw ProgramException(buffer.str());
-	}
+	SourceCache::getInstance().load(filename, source);
 	
-	// Read contents of file.
-	stringstream source;
-	source << shader.rdbuf();
+	return source.toString();
+    }
+    
+    // Type-smart shader compiler
+    void Program::compileShader(const string& filename)
+	throw(ProgramException)
+    {
+	compileShader(filename, getShaderType(filename));
+    }
+    
+    // Source-retriving shader compiler
+    void Program::compileShader(const string& filename, ShaderType type)
+	throw(ProgramException)
+    {
+	ShaderSource source;
 	
-	// Cleanup and pass on contents.
-	shader.close();
+	SourceCache::getInstance().load(filename, source);
 	
-	compileShaderSource(source.str(), type, filename);
+	finishShader(submitShaderSource(source, type), filename);
+	addShaderFile(filename, type);
     }
     
     // Compile shader with source
     void Program::compileShaderSource(const string& source, ShaderType type, const string& filename)
 	throw(ProgramException)
+    {
+	finishShader(submitShaderSource(source, type), filename);
+    }
+    
+    // Start compiling a single string
+    GLuint Program::submitShaderSource(const string& source, ShaderType type)
+	throw(ProgramException)
+    {
+	ShaderSource ranges;
+	
+	ranges.append(source.c_str(), source.size());
+	
+	return submitShaderSource(ranges, type);
+    }
+    
+    // Start compiling a shader without waiting on its status
+    GLuint Program::submitShaderSource(const ShaderSource& source, ShaderType type)
+	throw(ProgramException)
     {
 	// Create shader program if necessary
 	if(handle <= 0) {
@@ -227,12 +492,19 @@ namespace glslu
 	// Create shader and attach source
 	GLuint shaderHandle = gl::CreateShader(type);
         
-	const char* c_source = source.c_str();
-	gl::ShaderSource(shaderHandle, 1, &c_source, NULL);
+	if(!source.strings.empty())
+	    gl::ShaderSource(shaderHandle, source.strings.size(), &source.strings[0], &source.lengths[0]);
 	
 	// Compile the shader
 	gl::CompileShader(shaderHandle);
 	
+	return shaderHandle;
+    }
+    
+    // Collect a submitted shader, attaching it on success
+    void Program::finishShader(GLuint shaderHandle, const string& filename)
+	throw(ProgramException)
+    {
 	// Check for compile errors
 	int status;
 	gl::GetShaderiv(shaderHandle, gl::COMPILE_STATUS, &status);
@@ -255,6 +527,8 @@ namespace glslu
 		delete[] c_log;
 	    }
 	    
+	    gl::DeleteShader(shaderHandle);
+	    
 	    // Construct exception...
 	    if(filename != "")
 		exceptionMessage << "\"" << filename << "\" could not be compiled!";
@@ -272,11 +546,28 @@ namespace glslu
 	throw(ProgramException)
     {
 	if(linked) return;
+	
+	submitLink();
+	finishLink();
+    }
+    
+    // Start linking without waiting on the result
+    void Program::submitLink(void)
+	throw(ProgramException)
+    {
+	if(linked) return;
 	else if(handle <= 0)
 	    throw ProgramException("Program has not been initialized! (Have you attached shaders to it?)");
 	
 	// Linking is easy!
 	gl::LinkProgram(handle);
+    }
+    
+    // Collect a submitted link
+    void Program::finishLink(void)
+	throw(ProgramException)
+    {
+	if(linked) return;
 	
 	// Check link status
 	int status;
@@ -308,7 +599,7 @@ namespace glslu
 	    
 	    throw ProgramException(exceptionMessage.str());
 	} else {
-	    uniformLocations.clear();
+	    reflectUniforms();
 	    linked = true;
 	}
     }
@@ -363,93 +654,183 @@ namespace glslu
 	gl::UseProgram(handle);
     }
     
+    // Uniform Block Binding
+    void Program::bindUniformBlock(const string& name, GLuint binding)
+	throw(ProgramException)
+    {
+	GLuint index = gl::GetUniformBlockIndex(handle, name.c_str());
+	
+	if(index == gl::INVALID_INDEX) {
+	    stringstream buffer;
+	    
+	    buffer << "Program[" << handle << "] has no uniform block \"" << name << "\".";
+	    
+	    throw ProgramException(buffer.str());
+	}
+	
+	gl::UniformBlockBinding(handle, index, binding);
+    }
+    
+    // Ask the driver to keep the binary around; must precede link().
+    void Program::setBinaryRetrievable(bool retrievable)
+    {
+	if(handle <= 0)
+	    handle = gl::CreateProgram();
+	
+	gl::ProgramParameteri(handle, gl::PROGRAM_BINARY_RETRIEVABLE_HINT, retrievable ? gl::TRUE_ : gl::FALSE_);
+    }
+    
+    // Link from a binary
+    bool Program::loadBinary(GLenum format, const void* binary, GLsizei length)
+    {
+	if(linked) return true;
+	
+	if(handle <= 0)
+	    handle = gl::CreateProgram();
+	
+	if(handle == 0) return false;
+	
+	gl::ProgramBinary(handle, format, binary, length);
+	
+	int status;
+	gl::GetProgramiv(handle, gl::LINK_STATUS, &status);
+	
+	if(status == gl::FALSE_)
+	    return false;
+	
+	reflectUniforms();
+	linked = true;
+	
+	return true;
+    }
+    
+    // Retrieve the linked binary
+    bool Program::getBinary(GLenum& format, std::vector<unsigned char>& binary)
+    {
+	if(!linked) return false;
+	
+	GLint length = 0;
+	gl::GetProgramiv(handle, gl::PROGRAM_BINARY_LENGTH, &length);
+	
+	if(length <= 0) return false;
+	
+	binary.resize(length);
+	gl::GetProgramBinary(handle, length, &length, &format, &binary[0]);
+	binary.resize(length);
+	
+	return length > 0;
+    }
+    
     // Attrib Bind Location
     void Program::bindAttribLocation(GLuint location, const string& name) { gl::BindAttribLocation(handle, location, name.c_str()); }
     
     // Frag Data Bind Location
     void Program::bindFragDataLocation(GLuint location, const string& name) { gl::BindFragDataLocation(handle, location, name.c_str()); }
     
+    // Resolve a uniform once for the handle setters below
+    Uniform Program::getUniform(const string& name)
+    {
+	return Uniform(getUniformLocation(name));
+    }
+    
     // Set Uniform for boolean value.
-    void Program::setUniform(const string& name, bool value)
+    void Program::setUniform(Uniform uniform, bool value)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform1i(location, value); // Possibly reference integer set inform...
+	gl::Uniform1i(uniform.location, value); // Possibly reference integer set inform...
     }
     
     // Set Uniform for integer value
-    void Program::setUniform(const string& name, int value)
+    void Program::setUniform(Uniform uniform, int value)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform1i(location, value);
+	gl::Uniform1i(uniform.location, value);
     }
     
     // Set Uniform for float value
-    void Program::setUniform(const string& name, float value)
+    void Program::setUniform(Uniform uniform, float value)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform1f(location, value);
+	gl::Uniform1f(uniform.location, value);
     }
     
     // Set Uniform for GL unsigned integer
-    void Program::setUniform(const string& name, GLuint value)
+    void Program::setUniform(Uniform uniform, GLuint value)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform1ui(location, value);
+	gl::Uniform1ui(uniform.location, value);
     }
     
     // Set Uniform for double float value
-    void Program::setUniform(const string& name, float x, float y)
+    void Program::setUniform(Uniform uniform, float x, float y)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform2f(location, x, y);
+	gl::Uniform2f(uniform.location, x, y);
     }
     
     // Set Uniform for triple float value
-    void Program::setUniform(const string& name, float x, float y, float z)
+    void Program::setUniform(Uniform uniform, float x, float y, float z)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform3f(location, x, y, z);
+	gl::Uniform3f(uniform.location, x, y, z);
     }
     
     // Set Uniform for quad float value
-    void Program::setUniform(const string& name, float x, float y, float z, float w)
+    void Program::setUniform(Uniform uniform, float x, float y, float z, float w)
     {
-	GLint location = getUniformLocation(name);
-	gl::Uniform4f(location, x, y, z, w);
+	gl::Uniform4f(uniform.location, x, y, z, w);
     }
     
     // Set Uniform for 2-value vector
-    void Program::setUniform(const string& name, const vec2& vector)
+    void Program::setUniform(Uniform uniform, const vec2& vector)
     {
-        this->setUniform(name, vector.x, vector.y);
+	gl::Uniform2fv(uniform.location, 1, &vector[0]);
     }
     
     // Set Uniform for 3-value vector
-    void Program::setUniform(const string& name, const vec3& vector)
+    void Program::setUniform(Uniform uniform, const vec3& vector)
     {
-	this->setUniform(name, vector.x, vector.y, vector.z);
+	gl::Uniform3fv(uniform.location, 1, &vector[0]);
     }
     
     // Set Uniform for 4-value vector
-    void Program::setUniform(const string& name, const vec4& vector)
+    void Program::setUniform(Uniform uniform, const vec4& vector)
     {
-	this->setUniform(name, vector.x, vector.y, vector.z, vector.w);
+	gl::Uniform4fv(uniform.location, 1, &vector[0]);
     }
     
     // Set Uniform for 3x3 matrix
-    void Program::setUniform(const string& name, const mat3& matrix)
+    void Program::setUniform(Uniform uniform, const mat3& matrix)
     {
-	GLint location = getUniformLocation(name);
-	gl::UniformMatrix3fv(location, 1, gl::FALSE_, &matrix[0][0]);
+	gl::UniformMatrix3fv(uniform.location, 1, gl::FALSE_, &matrix[0][0]);
     }
     
     // Set Uniform for 4x4 matrix
-    void Program::setUniform(const string& name, const mat4& matrix)
+    void Program::setUniform(Uniform uniform, const mat4& matrix)
     {
-	GLint location = getUniformLocation(name);
-	gl::UniformMatrix4fv(location, 1, gl::FALSE_, &matrix[0][0]);
+	gl::UniformMatrix4fv(uniform.location, 1, gl::FALSE_, &matrix[0][0]);
     }
     
+    // Set Uniform for an array of 3-value vectors
+    void Program::setUniform(Uniform uniform, const vec3* vectors, GLsizei count)
+    {
+	gl::Uniform3fv(uniform.location, count, &vectors[0][0]);
+    }
+    
+    // Set Uniform for an array of 4x4 matrices
+    void Program::setUniform(Uniform uniform, const mat4* matrices, GLsizei count)
+    {
+	gl::UniformMatrix4fv(uniform.location, count, gl::FALSE_, &matrices[0][0][0]);
+    }
+    
+    // Name setters resolve through the cache, then forward.
+    void Program::setUniform(const string& name, bool value) { setUniform(getUniform(name), value); }
+    void Program::setUniform(const string& name, int value) { setUniform(getUniform(name), value); }
+    void Program::setUniform(const string& name, float value) { setUniform(getUniform(name), value); }
+    void Program::setUniform(const string& name, GLuint value) { setUniform(getUniform(name), value); }
+    void Program::setUniform(const string& name, float x, float y) { setUniform(getUniform(name), x, y); }
+    void Program::setUniform(const string& name, float x, float y, float z) { setUniform(getUniform(name), x, y, z); }
+    void Program::setUniform(const string& name, float x, float y, float z, float w) { setUniform(getUniform(name), x, y, z, w); }
+    void Program::setUniform(const string& name, const vec2& vector) { setUniform(getUniform(name), vector); }
+    void Program::setUniform(const string& name, const vec3& vector) { setUniform(getUniform(name), vector); }
+    void Program::setUniform(const string& name, const vec4& vector) { setUniform(getUniform(name), vector); }
+    void Program::setUniform(const string& name, const mat3& matrix) { setUniform(getUniform(name), matrix); }
+    void Program::setUniform(const string& name, const mat4& matrix) { setUniform(getUniform(name), matrix); }
+    
     // Get a string containing all active uniforms
     string Program::getActiveUniforms(void)
     {
@@ -591,4 +972,418 @@ namespace glslu
 	
 	return buffer.str();
     }	    
+    
+    // Constructor, lets the driver use every compiler thread it has
+    CompileQueue::CompileQueue(void):
+	parallel(gl::exts::var_KHR_parallel_shader_compile), linking(false)
+    {
+	if(parallel)
+	    gl::MaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+    
+    // Deconstructor, for queues dropped before finish()
+    CompileQueue::~CompileQueue(void)
+    {
+	for(size_t shader = 0; shader < shaders.size(); ++shader)
+	    gl::DeleteShader(shaders[shader].shader);
+    }
+    
+    // Submit a shader file for program
+    void CompileQueue::add(Program& program, const string& filename)
+	throw(ProgramException)
+    {
+	addFile(program, filename, Program::getShaderType(filename));
+    }
+    
+    // Submit a shader file of a known type, straight from the source cache
+    void CompileQueue::addFile(Program& program, const string& filename, ShaderType type)
+	throw(ProgramException)
+    {
+	ShaderSource source;
+	
+	SourceCache::getInstance().load(filename, source);
+	
+	add(program, source, type, filename);
+	program.addShaderFile(filename, type);
+    }
+    
+    // Submit shader source for program
+    void CompileQueue::add(Program& program, const string& source, ShaderType type, const string& filename)
+	throw(ProgramException)
+    {
+	ShaderSource ranges;
+	
+	ranges.append(source.c_str(), source.size());
+	
+	add(program, ranges, type, filename);
+    }
+    
+    // Submit assembled shader source for program
+    void CompileQueue::add(Program& program, const ShaderSource& source, ShaderType type, const string& filename)
+	throw(ProgramException)
+    {
+	PendingShader pending;
+	
+	pending.program = &program;
+	pending.shader = program.submitShaderSource(source, type);
+	pending.filename = filename;
+	
+	shaders.push_back(pending);
+	
+	if(std::find(programs.begin(), programs.end(), &program) == programs.end())
+	    programs.push_back(&program);
+    }
+    
+    // Non-blocking completion check, polling the shaders, then the links
+    bool CompileQueue::isComplete(void)
+	throw(ProgramException)
+    {
+	if(!parallel) return true;
+	
+	GLint done;
+	
+	if(!linking) {
+	    for(size_t shader = 0; shader < shaders.size(); ++shader) {
+		gl::GetShaderiv(shaders[shader].shader, gl::COMPLETION_STATUS_KHR, &done);
+		
+		if(!done) return false;
+	    }
+	    
+	    submitLinks();
+	}
+	
+	for(size_t program = 0; program < programs.size(); ++program) {
+	    gl::GetProgramiv(programs[program]->getHandle(), gl::COMPLETION_STATUS_KHR, &done);
+	    
+	    if(!done) return false;
+	}
+	
+	return true;
+    }
+    
+    // Collect every shader, then submit every link.
+    void CompileQueue::submitLinks(void)
+	throw(ProgramException)
+    {
+	std::vector<PendingShader> pendingShaders;
+	
+	pendingShaders.swap(shaders);
+	linking = true;
+	
+	for(size_t shader = 0; shader < pendingShaders.size(); ++shader) {
+	    try {
+		pendingShaders[shader].program->finishShader(pendingShaders[shader].shader, pendingShaders[shader].filename);
+	    } catch(ProgramException& exception) {
+		// Don't leak the stages nobody will collect now.
+		for(size_t rest = shader + 1; rest < pendingShaders.size(); ++rest)
+		    gl::DeleteShader(pendingShaders[rest].shader);
+		
+		throw;
+	    }
+	}
+	
+	for(size_t program = 0; program < programs.size(); ++program)
+	    programs[program]->submitLink();
+    }
+    
+    // Submit the links if isComplete() hasn't, then collect every link.
+    void CompileQueue::finish(void)
+	throw(ProgramException)
+    {
+	std::vector<Program*> pendingPrograms;
+	
+	if(!linking)
+	    submitLinks();
+	
+	pendingPrograms.swap(programs);
+	linking = false;
+	
+	for(size_t program = 0; program < pendingPrograms.size(); ++program)
+	    pendingPrograms[program]->finishLink();
+    }
+    
+    namespace CacheInfo {
+	struct BinaryHeader
+	{
+	    char magic[8];
+	    unsigned long long key;
+	    unsigned int format;
+	    unsigned int length;
+	};
+	
+	const char binaryMagic[8] = {'G', 'L', 'S', 'L', 'U', 'B', 'I', 'N'};
+	
+	// FNV-1a, 64 bit, chainable through value
+	unsigned long long hash(const char* data, size_t length, unsigned long long value)
+	{
+	    for(size_t byte = 0; byte < length; ++byte) {
+		value ^= (unsigned char)data[byte];
+		value *= 1099511628211ULL;
+	    }
+	    
+	    return value;
+	}
+	
+	unsigned long long hash(const string& data, unsigned long long value = 14695981039346656037ULL)
+	{
+	    return hash(data.data(), data.size(), value);
+	}
+	
+	string getString(GLenum name)
+	{
+	    const GLubyte* value = gl::GetString(name);
+	    
+	    return value != NULL ? (const char*)value : "";
+	}
+    }
+    
+    // Constructor, needs a current context for the driver strings
+    ProgramCache::ProgramCache(const string& directory):
+	directory(directory)
+    {
+	driver = CacheInfo::getString(gl::VENDOR) + '\0'
+	    + CacheInfo::getString(gl::RENDERER) + '\0'
+	    + CacheInfo::getString(gl::VERSION) + '\0';
+	
+#ifdef _WIN32
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), 0755);
+#endif
+    }
+    
+    // Cache file for a key
+    string ProgramCache::getPath(unsigned long long key)
+    {
+	stringstream path;
+	
+	path << directory << "/" << std::hex << std::setfill('0') << setw(16) << key << ".bin";
+	
+	return path.str();
+    }
+    
+    // Build through the cache
+    bool ProgramCache::build(Program& program, const std::vector<string>& filenames)
+	throw(ProgramException)
+    {
+	std::vector<ShaderSource> sources(filenames.size());
+	std::vector<ShaderType> types;
+	unsigned long long key = CacheInfo::hash(driver);
+	
+	for(size_t file = 0; file < filenames.size(); ++file) {
+	    stringstream type;
+	    
+	    types.push_back(Program::getShaderType(filenames[file]));
+	    SourceCache::getInstance().load(filenames[file], sources[file]);
+	    
+	    type << types.back() << '\0';
+	    key = CacheInfo::hash(type.str(), key);
+	    
+	    for(size_t range = 0; range < sources[file].strings.size(); ++range)
+		key = CacheInfo::hash(sources[file].strings[range], sources[file].lengths[range], key);
+	    
+	    key = CacheInfo::hash(string(1, '\0'), key);
+	}
+	
+	// Try the cached binary first.
+	string path = getPath(key);
+	ifstream input(path.c_str(), ios::in | ios::binary);
+	
+	if(input) {
+	    CacheInfo::BinaryHeader header;
+	    
+	    if(input.read((char*)&header, sizeof(header))
+	       && memcmp(header.magic, CacheInfo::binaryMagic, sizeof(header.magic)) == 0
+	       && header.key == key && header.length <= (1u << 28)) {
+		std::vector<unsigned char> binary(header.length);
+		
+		if(header.length > 0 && input.read((char*)&binary[0], binary.size())
+		   && program.loadBinary(header.format, &binary[0], binary.size())) {
+		    for(size_t file = 0; file < filenames.size(); ++file)
+			program.addShaderFile(filenames[file], types[file]);
+		    
+		    return true;
+		}
+	    }
+	    
+	    input.close();
+	}
+	
+	// Full compile, on every compiler thread the driver has, then refresh
+	// the cache entry.
+	program.setBinaryRetrievable(true);
+	
+	CompileQueue queue;
+	
+	for(size_t file = 0; file < filenames.size(); ++file)
+	    queue.add(program, sources[file], types[file], filenames[file]);
+	
+	// GL has its own copy now; unmap the files before waiting on it.
+	sources.clear();
+	queue.finish();
+	
+	for(size_t file = 0; file < filenames.size(); ++file)
+	    program.addShaderFile(filenames[file], types[file]);
+	
+	CacheInfo::BinaryHeader header;
+	std::vector<unsigned char> binary;
+	GLenum format;
+	
+	if(!program.getBinary(format, binary))
+	    return false;
+	
+	memcpy(header.magic, CacheInfo::binaryMagic, sizeof(header.magic));
+	header.key = key;
+	header.format = format;
+	header.length = binary.size();
+	
+	// Write beside the entry, then swap it in whole.
+	string temporary = path + ".tmp";
+	std::ofstream output(temporary.c_str(), ios::out | ios::binary | ios::trunc);
+	
+	output.write((const char*)&header, sizeof(header)).write((const char*)&binary[0], binary.size());
+	output.close();
+	
+	if(output)
+	    sysu::replaceFile(temporary, path);
+	else
+	    remove(temporary.c_str());
+	
+	return false;
+    }
+    
+    namespace Std140Info {
+	// Base alignment and size of a lone member
+	void getMember(Std140Type type, size_t& alignment, size_t& length)
+	{
+	    switch(type) {
+	    case STD140_FLOAT:
+	    case STD140_INT:  alignment = 4;  length = 4; break;
+	    case STD140_VEC2: alignment = 8;  length = 8; break;
+	    case STD140_VEC3: alignment = 16; length = 12; break;
+	    case STD140_VEC4: alignment = 16; length = 16; break;
+	    case STD140_MAT3: alignment = 16; length = 48; break;
+	    case STD140_MAT4: alignment = 16; length = 64; break;
+	    default:          alignment = 16; length = 16; break;
+	    }
+	}
+    }
+    
+    // std140 member placement
+    size_t Std140Layout::add(Std140Type type)
+    {
+	size_t alignment, length;
+	
+	Std140Info::getMember(type, alignment, length);
+	
+	size_t offset = (size + alignment - 1) & ~(alignment - 1);
+	size = offset + length;
+	
+	return offset;
+    }
+    
+    // Array elements are each rounded up to a vec4, even in an array of one.
+    size_t Std140Layout::addArray(Std140Type type, size_t count)
+    {
+	size_t alignment, length;
+	
+	Std140Info::getMember(type, alignment, length);
+	
+	size_t offset = (size + 15) & ~(size_t)15;
+	size = offset + ((length + 15) & ~(size_t)15)*count;
+	
+	return offset;
+    }
+    
+    // Constructor
+    UniformBuffer::UniformBuffer(GLuint binding, size_t size)
+	throw(ProgramException):
+	handle(0), binding(binding), data(size, 0), dirtyBegin(size), dirtyEnd(0), streamed(false)
+    {
+	gl::GenBuffers(1, &handle);
+	
+	if(handle == 0)
+	    throw ProgramException("Could not create uniform buffer.");
+	
+	gl::BindBuffer(gl::UNIFORM_BUFFER, handle);
+	gl::BufferData(gl::UNIFORM_BUFFER, size, &data[0], gl::DYNAMIC_DRAW);
+	gl::BindBufferBase(gl::UNIFORM_BUFFER, binding, handle);
+    }
+    
+    // Deconstructor!
+    UniformBuffer::~UniformBuffer(void)
+    {
+	if(handle != 0)
+	    gl::DeleteBuffers(1, &handle);
+    }
+    
+    // Copy into the CPU side and grow the dirty span
+    void UniformBuffer::write(size_t offset, const void* value, size_t length)
+    {
+	if(offset + length > data.size()) return;
+	
+	memcpy(&data[offset], value, length);
+	
+	if(offset < dirtyBegin) dirtyBegin = offset;
+	if(offset + length > dirtyEnd) dirtyEnd = offset + length;
+    }
+    
+    void UniformBuffer::set(size_t offset, float value) { write(offset, &value, sizeof(value)); }
+    void UniformBuffer::set(size_t offset, int value) { write(offset, &value, sizeof(value)); }
+    void UniformBuffer::set(size_t offset, const vec2& vector) { write(offset, &vector[0], sizeof(vector)); }
+    void UniformBuffer::set(size_t offset, const vec3& vector) { write(offset, &vector[0], sizeof(vector)); }
+    void UniformBuffer::set(size_t offset, const vec4& vector) { write(offset, &vector[0], sizeof(vector)); }
+    void UniformBuffer::set(size_t offset, const mat4& matrix) { write(offset, &matrix[0][0], sizeof(matrix)); }
+    
+    // std140 stores each mat3 column as a padded vec4.
+    void UniformBuffer::set(size_t offset, const mat3& matrix)
+    {
+	for(int column = 0; column < 3; ++column)
+	    write(offset + 16*column, &matrix[column][0], sizeof(vec3));
+    }
+    
+    // Upload the dirty span
+    void UniformBuffer::upload(void)
+    {
+	// Coming back from a ring, the own buffer missed everything since.
+	if(streamed) {
+	    dirtyBegin = 0;
+	    dirtyEnd = data.size();
+	    streamed = false;
+	    
+	    gl::BindBufferBase(gl::UNIFORM_BUFFER, binding, handle);
+	}
+	
+	if(dirtyBegin >= dirtyEnd) return;
+	
+	gl::BindBuffer(gl::UNIFORM_BUFFER, handle);
+	gl::BufferSubData(gl::UNIFORM_BUFFER, dirtyBegin, dirtyEnd - dirtyBegin, &data[dirtyBegin]);
+	
+	dirtyBegin = data.size();
+	dirtyEnd = 0;
+    }
+    
+    // Stream the whole block
+    void UniformBuffer::upload(RingBuffer& ring)
+    {
+	static GLint alignment = 0;
+	size_t offset;
+	
+	if(alignment == 0)
+	    gl::GetIntegerv(gl::UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	
+	void* target = ring.allocate(data.size(), alignment, offset);
+	
+	if(target == NULL) {
+	    upload();
+	    return;
+	}
+	
+	memcpy(target, &data[0], data.size());
+	gl::BindBufferRange(gl::UNIFORM_BUFFER, binding, ring.getHandle(), offset, data.size());
+	
+	dirtyBegin = data.size();
+	dirtyEnd = 0;
+	streamed = true;
+    }
 }
@@ -3,11 +3,15 @@
 
 #include <stdexcept>
 #include <string>
+#include <deque>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 #include "gl_core_4_4.hpp"
+#include "mappedfile.hpp"
 
 namespace glslu
 {
@@ -27,17 +31,116 @@ namespace glslu
 	ProgramException(const std::string &msg): std::runtime_error(msg) {}
     };
     
+    // A uniform location resolved once by name, so per-frame updates skip
+    // the name lookup entirely. Stays -1 (ignored by GL) if inactive. Only
+    // valid for the GL program it came from: resolve it again after a
+    // swap() (see ShaderWatcher::poll).
+    struct Uniform
+    {
+	GLint location;
+
+	Uniform(void): location(-1) {}
+	explicit Uniform(GLint location): location(location) {}
+
+	bool isActive(void) const { return location >= 0; }
+    };
+    
+    // Shader text as a list of ranges, mostly pointing straight into
+    // mapped files, for a multi-string glShaderSource. The #line
+    // directives stitched around includes are owned here, and so are the
+    // mappings: they close with the source, so drop it once submitted.
+    class ShaderSource
+    {
+    private:
+	std::deque<std::string> directives;
+	std::deque<sysu::MappedFile> mappings;
+	
+	// Prevent object copying
+	ShaderSource(const ShaderSource& other) {}
+	ShaderSource& operator=(const ShaderSource& other) { return *this; }
+	
+    public:
+	std::vector<const GLchar*> strings;
+	std::vector<GLint> lengths;
+	
+	// Every file involved; the index is the #line source number.
+	std::vector<std::string> files;
+	
+	ShaderSource(void) {}
+	
+	void append(const char* data, size_t length);
+	void appendDirective(const std::string& text);
+	const sysu::MappedFile& map(const std::string& path) throw (sysu::SystemException);
+	std::string toString(void) const;
+    };
+    
+    // Process-wide cache of where shader files split at their
+    // #include "file" lines. A snippet shared by many shaders is scanned
+    // once; a file whose size or time changed is scanned again. No file
+    // is held open here: each load maps what it needs into its source.
+    class SourceCache
+    {
+    private:
+	// Text at offset, or an include (nextLine > 0)
+	struct Piece
+	{
+	    size_t offset;
+	    size_t length;
+	    std::string include;
+	    int nextLine;
+	};
+	
+	struct CachedFile
+	{
+	    long long modified;
+	    long long size;
+	    std::vector<Piece> pieces;
+	};
+	
+	std::map<std::string, CachedFile> files;
+	
+	const CachedFile& getFile(const std::string& path, ShaderSource& source, const char*& text) throw (ProgramException);
+	void append(const std::string& path, ShaderSource& source) throw (ProgramException);
+	
+	SourceCache(void) {}
+	
+	// Prevent object copying
+	SourceCache(const SourceCache& other) {}
+	SourceCache& operator=(const SourceCache& other) { return *this; }
+	
+    public:
+	static SourceCache& getInstance(void);
+	
+	// "dir/name" form used for keys, with "." for a bare name
+	static std::string normalizePath(const std::string& filename);
+	
+	// Assemble filename with its includes resolved, each file once.
+	void load(const std::string& filename, ShaderSource& source) throw (ProgramException);
+	
+	// Forget cached files
+	void invalidate(const std::string& filename);
+	void clear(void);
+    };
+    
+    // A shader file a program was built from.
+    struct ShaderFile
+    {
+	std::string filename;
+	ShaderType type;
+    };
+    
     class Program
     {
     private:
 	int handle;
 	bool linked;
-	std::map<std::string, int> uniformLocations;
+	std::unordered_map<std::string, GLint> uniformLocations;
+	std::vector<ShaderFile> shaderFiles;
 	
 	// Minor helper functions for internals.
 	GLint getUniformLocation(const std::string& name);
-	bool fileExists(const std::string& filename);
-	std::string getExtension(const std::string& filename);
+	void reflectUniforms(void);
+	static std::string getExtension(const std::string& filename);
 	
 	// Prevent object copying
 	Program(const Program& other) {}
@@ -52,21 +155,68 @@ namespace glslu
 	int getHandle(void);
 	bool isLinked(void);
 	
+	// Shader files this program was built from, for reloading
+	const std::vector<ShaderFile>& getShaderFiles(void) const { return shaderFiles; }
+	void addShaderFile(const std::string& filename, ShaderType type);
+	
+	// Exchange GL programs (and everything resolved from them) with other.
+	// Uniform values belong to the GL program, so they go with it; Uniform
+	// handles don't, so callers holding them must call getUniform() again.
+	void swap(Program& other);
+	
 	// Compile functions
 	void compileShader(const std::string& filename) throw (ProgramException);
 	void compileShader(const std::string& filename, ShaderType type) throw (ProgramException);
 	void compileShaderSource(const std::string& source, ShaderType type, const std::string& filename = "") throw (ProgramException);
 	
+	// Source helpers, shared with ProgramCache
+	static ShaderType getShaderType(const std::string& filename) throw (ProgramException);
+	static std::string readSource(const std::string& filename) throw (ProgramException);
+	
+	// Deferred compile and link, see CompileQueue
+	GLuint submitShaderSource(const std::string& source, ShaderType type) throw (ProgramException);
+	GLuint submitShaderSource(const ShaderSource& source, ShaderType type) throw (ProgramException);
+	void finishShader(GLuint shader, const std::string& filename = "") throw (ProgramException);
+	void submitLink(void) throw (ProgramException);
+	void finishLink(void) throw (ProgramException);
+	
 	// Shader/Program Management
 	void link(void) throw (ProgramException);
 	void validate(void) throw (ProgramException);
 	void use(void) throw (ProgramException);
 	
+	// Program binaries; a rejected binary leaves the program unlinked.
+	void setBinaryRetrievable(bool retrievable);
+	bool loadBinary(GLenum format, const void* binary, GLsizei length);
+	bool getBinary(GLenum& format, std::vector<unsigned char>& binary);
+	
+	// Uniform block handlers, for blocks without a layout binding
+	void bindUniformBlock(const std::string& name, GLuint binding) throw (ProgramException);
+	
 	// Attribute handlers
 	void bindAttribLocation(GLuint location, const std::string& name);
 	void bindFragDataLocation(GLuint location, const std::string& name);
 	
-	// Uniform handlers
+	// Uniform resolution, filled from the active uniforms at link time
+	Uniform getUniform(const std::string& name);
+	
+	// Uniform handlers, by resolved uniform
+	void setUniform(Uniform uniform, bool value);
+	void setUniform(Uniform uniform, int value);
+	void setUniform(Uniform uniform, float value);
+	void setUniform(Uniform uniform, GLuint value);
+	void setUniform(Uniform uniform, float x, float y);
+	void setUniform(Uniform uniform, float x, float y, float z);
+	void setUniform(Uniform uniform, float x, float y, float z, float w);
+	void setUniform(Uniform uniform, const glm::vec2& vector);
+	void setUniform(Uniform uniform, const glm::vec3& vector);
+	void setUniform(Uniform uniform, const glm::vec4& vector);
+	void setUniform(Uniform uniform, const glm::mat3& matrix);
+	void setUniform(Uniform uniform, const glm::mat4& matrix);
+	void setUniform(Uniform uniform, const glm::vec3* vectors, GLsizei count);
+	void setUniform(Uniform uniform, const glm::mat4* matrices, GLsizei count);
+	
+	// Uniform handlers, by name
 	void setUniform(const std::string& name, bool value);
 	void setUniform(const std::string& name, int value);
 	void setUniform(const std::string& name, float value);
@@ -88,6 +238,158 @@ namespace glslu
 	// Type helper
 	std::string getTypeString(GLenum type);
     };
+    
+    // Compiles the shaders of many programs together: every stage is
+    // submitted before any status is read, then every link likewise, so a
+    // driver with compiler threads (KHR_parallel_shader_compile) overlaps
+    // them. Without the extension the batched queries still avoid a
+    // compile/wait round trip per stage.
+    class CompileQueue
+    {
+    private:
+	struct PendingShader
+	{
+	    Program* program;
+	    GLuint shader;
+	    std::string filename;
+	};
+	
+	bool parallel;
+	bool linking;
+	std::vector<PendingShader> shaders;
+	std::vector<Program*> programs;
+	
+	void submitLinks(void) throw (ProgramException);
+	
+	// Prevent object copying
+	CompileQueue(const CompileQueue& other) {}
+	CompileQueue& operator=(const CompileQueue& other) { return *this; }
+	
+    public:
+	CompileQueue(void);
+	~CompileQueue(void);
+	
+	// Submission
+	void add(Program& program, const std::string& filename) throw (ProgramException);
+	void addFile(Program& program, const std::string& filename, ShaderType type) throw (ProgramException);
+	void add(Program& program, const std::string& source, ShaderType type, const std::string& filename = "") throw (ProgramException);
+	void add(Program& program, const ShaderSource& source, ShaderType type, const std::string& filename = "") throw (ProgramException);
+	
+	// True once every program has linked; never blocks. When the last
+	// shader is done it collects them all and submits the links, so it
+	// throws compile errors. Always true without the extension, where
+	// finish() does the waiting.
+	bool isComplete(void) throw (ProgramException);
+	
+	// Collect every shader and link, waiting on any still running,
+	// throwing on the first error.
+	void finish(void) throw (ProgramException);
+	
+	// Status
+	bool isParallel(void) const { return parallel; }
+    };
+    
+    // On-disk cache of linked program binaries, keyed by a hash of the
+    // shader sources and the driver's vendor, renderer and version strings.
+    // Anything missing, stale or rejected by the driver falls back to a
+    // full compile through a CompileQueue, whose binary then replaces the
+    // cache entry.
+    class ProgramCache
+    {
+    private:
+	std::string directory;
+	std::string driver;
+	
+	std::string getPath(unsigned long long key);
+	
+    public:
+	ProgramCache(const std::string& directory);
+	
+	// Compile and link filenames into program, or load the cached binary.
+	// Returns true on a cache hit.
+	bool build(Program& program, const std::vector<std::string>& filenames) throw (ProgramException);
+    };
+    
+    enum Std140Type
+    {
+	STD140_FLOAT,
+	STD140_INT,
+	STD140_VEC2,
+	STD140_VEC3,
+	STD140_VEC4,
+	STD140_MAT3,
+	STD140_MAT4
+    };
+    
+    // Computes member offsets of a std140 block in declaration order, so
+    // C++ writes line up with the GLSL declaration without hand padding.
+    class Std140Layout
+    {
+    private:
+	size_t size;
+	
+    public:
+	Std140Layout(void): size(0) {}
+	
+	// Append a member and return its offset.
+	size_t add(Std140Type type);
+	
+	// Append an array of count members, each padded to a vec4 however
+	// short the array, and return its offset.
+	size_t addArray(Std140Type type, size_t count);
+	
+	// Block size, padded to a vec4 as std140 requires
+	size_t getSize(void) const { return (size + 15) & ~(size_t)15; }
+    };
+    
+    class RingBuffer;
+    
+    // A uniform buffer bound to a fixed binding point for its lifetime.
+    // Writes go to a CPU copy; upload() sends the changed span in one call,
+    // and every program declaring the block at that binding sees it.
+    class UniformBuffer
+    {
+    private:
+	GLuint handle;
+	GLuint binding;
+	std::vector<unsigned char> data;
+	size_t dirtyBegin;
+	size_t dirtyEnd;
+	bool streamed;
+	
+	void write(size_t offset, const void* value, size_t length);
+	
+	// Prevent object copying
+	UniformBuffer(const UniformBuffer& other) {}
+	UniformBuffer& operator=(const UniformBuffer& other) { return *this; }
+	
+    public:
+	// Constructor/Destructor
+	UniformBuffer(GLuint binding, size_t size) throw (ProgramException);
+	~UniformBuffer(void);
+	
+	// Status functions
+	GLuint getHandle(void) const { return handle; }
+	GLuint getBinding(void) const { return binding; }
+	size_t getSize(void) const { return data.size(); }
+	
+	// Member writers, at offsets from Std140Layout
+	void set(size_t offset, float value);
+	void set(size_t offset, int value);
+	void set(size_t offset, const glm::vec2& vector);
+	void set(size_t offset, const glm::vec3& vector);
+	void set(size_t offset, const glm::vec4& vector);
+	void set(size_t offset, const glm::mat3& matrix);
+	void set(size_t offset, const glm::mat4& matrix);
+	
+	// Send pending writes to the GPU, if any.
+	void upload(void);
+	
+	// Copy the whole block into this frame's region of ring and bind that
+	// range instead; needed every frame, as the region is recycled. Falls
+	// back to upload() if the region is full.
+	void upload(RingBuffer& ring);
+    };
 }
 
 #endif
@@ -0,0 +1,244 @@
+#include "headless.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#ifdef USE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+using std::string;
+using std::stringstream;
+using std::vector;
+
+namespace glslu
+{
+    // Create and bind a context
+    HeadlessContext::HeadlessContext(int major, int minor)
+	throw(ContextException):
+	display(NULL), context(NULL)
+    {
+#ifdef USE_EGL
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+	    (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+
+	// Surfaceless needs no X server or DRM device; fall back to the default.
+	if(getPlatformDisplay)
+	    eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+
+	if(eglDisplay == EGL_NO_DISPLAY)
+	    eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+	if(eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, NULL, NULL))
+	    throw ContextException("Could not open an EGL display.");
+
+	display = eglDisplay;
+
+	if(!eglBindAPI(EGL_OPENGL_API)) {
+	    eglTerminate(eglDisplay);
+	    throw ContextException("EGL has no desktop OpenGL support.");
+	}
+
+	const EGLint contextAttributes[] = {
+	    EGL_CONTEXT_MAJOR_VERSION, major,
+	    EGL_CONTEXT_MINOR_VERSION, minor,
+	    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+	    EGL_NONE
+	};
+
+	// No config is needed when nothing is ever presented.
+	EGLContext eglContext = eglCreateContext(eglDisplay, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+
+	if(eglContext == EGL_NO_CONTEXT) {
+	    const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+	    EGLConfig config;
+	    EGLint configCount = 0;
+
+	    if(eglChooseConfig(eglDisplay, configAttributes, &config, 1, &configCount) && configCount > 0)
+		eglContext = eglCreateContext(eglDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+	}
+
+	if(eglContext == EGL_NO_CONTEXT || !eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext)) {
+	    stringstream buffer;
+
+	    buffer << "Could not create a headless OpenGL " << major << "." << minor << " core context (EGL error 0x"
+		   << std::hex << eglGetError() << ").";
+
+	    if(eglContext != EGL_NO_CONTEXT)
+		eglDestroyContext(eglDisplay, eglContext);
+
+	    eglTerminate(eglDisplay);
+
+	    throw ContextException(buffer.str());
+	}
+
+	context = eglContext;
+#else
+	throw ContextException("Headless rendering needs a build with USE_EGL defined.");
+#endif
+    }
+
+    // Deconstructor!
+    HeadlessContext::~HeadlessContext(void)
+    {
+#ifdef USE_EGL
+	if(display == NULL) return;
+
+	eglMakeCurrent((EGLDisplay)display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+	if(context != NULL)
+	    eglDestroyContext((EGLDisplay)display, (EGLContext)context);
+
+	eglTerminate((EGLDisplay)display);
+#endif
+    }
+
+    // Constructor
+    Framebuffer::Framebuffer(int width, int height)
+	throw(ContextException):
+	handle(0), width(width), height(height)
+    {
+	gl::GenRenderbuffers(2, renderbuffers);
+
+	gl::BindRenderbuffer(gl::RENDERBUFFER, renderbuffers[0]);
+	gl::RenderbufferStorage(gl::RENDERBUFFER, gl::RGBA8, width, height);
+
+	gl::BindRenderbuffer(gl::RENDERBUFFER, renderbuffers[1]);
+	gl::RenderbufferStorage(gl::RENDERBUFFER, gl::DEPTH_COMPONENT24, width, height);
+
+	gl::GenFramebuffers(1, &handle);
+	gl::BindFramebuffer(gl::FRAMEBUFFER, handle);
+	gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::COLOR_ATTACHMENT0, gl::RENDERBUFFER, renderbuffers[0]);
+	gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::DEPTH_ATTACHMENT, gl::RENDERBUFFER, renderbuffers[1]);
+
+	GLenum status = gl::CheckFramebufferStatus(gl::FRAMEBUFFER);
+
+	if(status != gl::FRAMEBUFFER_COMPLETE) {
+	    stringstream buffer;
+
+	    buffer << "Framebuffer " << width << "x" << height << " is incomplete (0x" << std::hex << status << ").";
+
+	    gl::BindFramebuffer(gl::FRAMEBUFFER, 0);
+	    gl::DeleteFramebuffers(1, &handle);
+	    gl::DeleteRenderbuffers(2, renderbuffers);
+
+	    throw ContextException(buffer.str());
+	}
+    }
+
+    // Deconstructor!
+    Framebuffer::~Framebuffer(void)
+    {
+	gl::DeleteFramebuffers(1, &handle);
+	gl::DeleteRenderbuffers(2, renderbuffers);
+    }
+
+    // Target binding
+    void Framebuffer::bind(void)
+    {
+	gl::BindFramebuffer(gl::FRAMEBUFFER, handle);
+	gl::Viewport(0, 0, width, height);
+    }
+
+    // Readback, flipped from GL's bottom-up rows
+    void Framebuffer::read(vector<unsigned char>& pixels)
+    {
+	size_t rowLength = (size_t)width*4;
+
+	pixels.resize(rowLength*height);
+
+	gl::BindFramebuffer(gl::READ_FRAMEBUFFER, handle);
+	gl::PixelStorei(gl::PACK_ALIGNMENT, 1);
+	gl::ReadPixels(0, 0, width, height, gl::RGBA, gl::UNSIGNED_BYTE, &pixels[0]);
+
+	for(int row = 0; row < height/2; ++row)
+	    std::swap_ranges(pixels.begin() + row*rowLength, pixels.begin() + (row + 1)*rowLength,
+			     pixels.begin() + (height - 1 - row)*rowLength);
+    }
+
+    // Constructor
+    PixelReadback::PixelReadback(int width, int height, int depth):
+	buffers(depth), fences(depth, (GLsync)NULL), width(width), height(height), first(0), count(0)
+    {
+	gl::GenBuffers(depth, &buffers[0]);
+
+	for(int buffer = 0; buffer < depth; ++buffer) {
+	    gl::BindBuffer(gl::PIXEL_PACK_BUFFER, buffers[buffer]);
+	    gl::BufferData(gl::PIXEL_PACK_BUFFER, (size_t)width*height*4, NULL, gl::STREAM_READ);
+	}
+
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+    }
+
+    // Deconstructor!
+    PixelReadback::~PixelReadback(void)
+    {
+	for(size_t fence = 0; fence < fences.size(); ++fence)
+	    if(fences[fence] != NULL)
+		gl::DeleteSync(fences[fence]);
+
+	gl::DeleteBuffers((GLsizei)buffers.size(), &buffers[0]);
+    }
+
+    // Non-blocking fence check on the oldest read
+    bool PixelReadback::isReady(void) const
+    {
+	GLint status = gl::UNSIGNALED;
+
+	if(count == 0) return false;
+
+	gl::GetSynciv(fences[first], gl::SYNC_STATUS, 1, NULL, &status);
+
+	return status == gl::SIGNALED;
+    }
+
+    // Start a copy into the next free buffer
+    void PixelReadback::request(Framebuffer& framebuffer)
+    {
+	size_t slot = (first + count) % buffers.size();
+
+	gl::BindFramebuffer(gl::READ_FRAMEBUFFER, framebuffer.getHandle());
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, buffers[slot]);
+	gl::PixelStorei(gl::PACK_ALIGNMENT, 1);
+	gl::ReadPixels(0, 0, width, height, gl::RGBA, gl::UNSIGNED_BYTE, NULL);
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+
+	fences[slot] = gl::FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+	++count;
+    }
+
+    // Finish the oldest copy
+    void PixelReadback::collect(vector<unsigned char>& pixels)
+    {
+	size_t rowLength = (size_t)width*4;
+
+	// Flush once so the fence is guaranteed to signal, then just wait.
+	GLbitfield flags = gl::SYNC_FLUSH_COMMANDS_BIT;
+
+	while(gl::ClientWaitSync(fences[first], flags, 1000000000) == gl::TIMEOUT_EXPIRED)
+	    flags = 0;
+
+	gl::DeleteSync(fences[first]);
+	fences[first] = NULL;
+
+	pixels.resize(rowLength*height);
+
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, buffers[first]);
+
+	const unsigned char* mapped = (const unsigned char*)gl::MapBufferRange(gl::PIXEL_PACK_BUFFER, 0, rowLength*height, gl::MAP_READ_BIT);
+
+	if(mapped != NULL) {
+	    for(int row = 0; row < height; ++row)
+		std::copy(mapped + (height - 1 - row)*rowLength, mapped + (height - row)*rowLength, pixels.begin() + row*rowLength);
+
+	    gl::UnmapBuffer(gl::PIXEL_PACK_BUFFER);
+	}
+
+	gl::BindBuffer(gl::PIXEL_PACK_BUFFER, 0);
+
+	first = (first + 1) % buffers.size();
+	--count;
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef GLSL_UTILITIES_HEADLESS
+#define GLSL_UTILITIES_HEADLESS
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gl_core_4_4.hpp"
+
+namespace glslu
+{
+    class ContextException: public std::runtime_error
+    {
+    public:
+	ContextException(const std::string &msg): std::runtime_error(msg) {}
+    };
+
+    // An OpenGL core context with no window or display, through EGL's
+    // surfaceless platform (Mesa llvmpipe works without a GPU). Made current
+    // on construction; render into a Framebuffer. Needs a build with USE_EGL
+    // defined, and throws otherwise.
+    class HeadlessContext
+    {
+    private:
+	void* display;
+	void* context;
+
+	// Prevent object copying
+	HeadlessContext(const HeadlessContext& other) {}
+	HeadlessContext& operator=(const HeadlessContext& other) { return *this; }
+
+    public:
+	// Constructor/Destructor
+	HeadlessContext(int major = 4, int minor = 4) throw (ContextException);
+	~HeadlessContext(void);
+    };
+
+    // An offscreen RGBA8 color + 24 bit depth target.
+    class Framebuffer
+    {
+    private:
+	GLuint handle;
+	GLuint renderbuffers[2];
+	int width;
+	int height;
+
+	// Prevent object copying
+	Framebuffer(const Framebuffer& other) {}
+	Framebuffer& operator=(const Framebuffer& other) { return *this; }
+
+    public:
+	// Constructor/Destructor
+	Framebuffer(int width, int height) throw (ContextException);
+	~Framebuffer(void);
+
+	// Status functions
+	GLuint getHandle(void) const { return handle; }
+	int getWidth(void) const { return width; }
+	int getHeight(void) const { return height; }
+
+	// Draw into it, with a matching viewport
+	void bind(void);
+
+	// Blocking read of the color buffer, tightly packed RGBA rows
+	// ordered top to bottom.
+	void read(std::vector<unsigned char>& pixels);
+    };
+
+    // Asynchronous readback through a ring of pixel pack buffers. request()
+    // queues a copy of the framebuffer and returns at once; collect() hands
+    // back the oldest copy, waiting on its fence only if the GPU hasn't
+    // finished it. With depth N the GPU works N frames ahead of the reads.
+    class PixelReadback
+    {
+    private:
+	std::vector<GLuint> buffers;
+	std::vector<GLsync> fences;
+	int width;
+	int height;
+	size_t first;
+	size_t count;
+
+	// Prevent object copying
+	PixelReadback(const PixelReadback& other) {}
+	PixelReadback& operator=(const PixelReadback& other) { return *this; }
+
+    public:
+	// Constructor/Destructor
+	PixelReadback(int width, int height, int depth = 3);
+	~PixelReadback(void);
+
+	// Status functions
+	bool isEmpty(void) const { return count == 0; }
+	bool isFull(void) const { return count == buffers.size(); }
+	bool isReady(void) const;
+
+	// Queue a read of framebuffer; the ring must not be full.
+	void request(Framebuffer& framebuffer);
+
+	// Oldest pending read as tight RGBA rows, top to bottom.
+	void collect(std::vector<unsigned char>& pixels);
+    };
+}
+
+#endif
@@ -1,20 +1,46 @@
 #include <iostream>
+#include <fstream>
 #include <sstream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <cmath>
+#include <random>
+#include <chrono>
 
 #include "gl_core_4_4.hpp"
 #include <GLFW/glfw3.h>
 
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
+#include <glm/mat3x3.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/string_cast.hpp>
 
 #include "glslu.hpp"
+#include "shaderwatcher.hpp"
+#include "headless.hpp"
+#include "profiler.hpp"
+#include "ringbuffer.hpp"
+#include "renderer.hpp"
+#include "animator.hpp"
+#include "cube.hpp"
 
 #define VIEWPORT_WIDTH  640
 #define VIEWPORT_HEIGHT 480
 
+#define DEFAULT_HEADLESS_FRAMES 100
+#define DEFAULT_HEADLESS_OUTPUT "cube.ppm"
+#define DEFAULT_TURNS_PER_SECOND 4.0
+#define WALL_SCRAMBLE_LENGTH 20
+
+#define SHADER_CACHE_DIRECTORY "shadercache"
+
+// Per-frame stream budget; a frame needs about 2 KB.
+#define STREAM_REGION_SIZE (16*1024)
+
 #define ERRLOG(errstr) std::cerr << "ERR [" << __FILE__ << ":" << __LINE__ << "] " << errstr << std::endl;
 
 void glfw_err_callback(int code, const char* message);
@@ -31,10 +57,180 @@ using glslu::Program;
 
 typedef enum { MOUSE_RELEASED, MOUSE_LEFT_DRAG, MOUSE_RIGHT_DRAG } mouse_state;
 
+typedef chrono::steady_clock frame_clock;
+
+static void usage(const char* program)
+{
+  cerr << "Usage: " << program << " [--cube N [--no-cull] | --wall N [--no-indirect]] [--scramble MOVES] [--moves MOVES] [--tps N] [--no-stream] [--trace FILE] [--headless [--frames N] [--size WIDTHxHEIGHT] [--output FILE]]" << endl
+       << "\t--cube shows an NxN puzzle (" << cube::MIN_BIG_SIZE << ".." << cube::MAX_BIG_SIZE << ", moves like 2R' or 3Rw), drawing surface cubies only" << endl
+       << "\tunless --no-cull is given." << endl
+       << "\t--wall shows N independent 3x3s, each with its own random scramble, in one" << endl
+       << "\tmulti-draw-indirect call, or one instanced draw per cube with --no-indirect." << endl
+       << "\t--scramble sets the starting state; --moves animates turns from it at N turns" << endl
+       << "\tper second (default " << DEFAULT_TURNS_PER_SECOND << "). In the window, U R F D L B turn a face (shift for inverse)." << endl
+       << "\t--no-stream updates per-frame data in place instead of through a persistent ring buffer." << endl
+       << "\t--headless renders N frames offscreen (EGL, no display needed), reports" << endl
+       << "\tthe frame time and writes the last frame to FILE as a PPM image." << endl
+       << "\t--trace writes per-frame CPU phases and GPU time as Chrome trace-event JSON on exit." << endl;
+}
+
+// Whichever puzzle the face keys turn.
+struct Controls
+{
+  cube::Animator* animator;
+  cube::LayerAnimator* layerAnimator;
+  vector<cube::Animator>* wallAnimators;
+};
+
+// Face keys queue a turn on the animator; shift turns counter-clockwise.
+static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+  static const int faceKeys[cube::FACE_COUNT] = { GLFW_KEY_U, GLFW_KEY_R, GLFW_KEY_F, GLFW_KEY_D, GLFW_KEY_L, GLFW_KEY_B };
+  Controls* controls = (Controls*)glfwGetWindowUserPointer(window);
+
+  if(action != GLFW_PRESS || controls == NULL)
+    return;
+
+  for(int face = 0; face < cube::FACE_COUNT; ++face) {
+    if(key != faceKeys[face])
+      continue;
+
+    cube::Move move = (cube::Move)(3*face + ((mods & GLFW_MOD_SHIFT) ? 2 : 0));
+
+    if(controls->layerAnimator != NULL) {
+      cube::LayerMove layerMove = { (cube::Face)face, 0, 1, (mods & GLFW_MOD_SHIFT) ? 3 : 1 };
+
+      controls->layerAnimator->queueMove(layerMove);
+    } else if(controls->wallAnimators != NULL) {
+      for(size_t cube = 0; cube < controls->wallAnimators->size(); ++cube)
+        (*controls->wallAnimators)[cube].queueMove(move);
+    } else
+      controls->animator->queueMove(move);
+  }
+}
+
+// Binary PPM, rows top to bottom, alpha dropped.
+static bool writePPM(const string& filename, int width, int height, const vector<unsigned char>& pixels)
+{
+  ofstream output(filename.c_str(), ios::out | ios::binary | ios::trunc);
+
+  output << "P6\n" << width << " " << height << "\n255\n";
+
+  for(size_t pixel = 0; pixel < (size_t)width*height; ++pixel)
+    output.write((const char*)&pixels[4*pixel], 3);
+
+  return (bool)output;
+}
+
 int main(int argc, char* argv[])
 {
   int window_width, window_height;
-  GLFWwindow* hWindow;
+  GLFWwindow* hWindow = NULL;
+  glslu::HeadlessContext* headlessContext = NULL;
+  bool headless = false;
+  int frameCount = DEFAULT_HEADLESS_FRAMES;
+  string outputFile = DEFAULT_HEADLESS_OUTPUT;
+  string traceFile;
+  string scramble;
+  string moves;
+  int puzzleSize = 0;
+  bool culling = true;
+  int wallSize = 0;
+  bool indirect = true;
+  bool streaming = true;
+  double turnsPerSecond = DEFAULT_TURNS_PER_SECOND;
+
+  // TODO: Do stuff with window parameters or whatever.
+  window_width = VIEWPORT_WIDTH;
+  window_height = VIEWPORT_HEIGHT;
+
+  for(int arg = 1; arg < argc; ++arg) {
+    string option = argv[arg];
+
+    if(option == "--headless")
+      headless = true;
+    else if(option == "--frames" && arg + 1 < argc)
+      frameCount = atoi(argv[++arg]);
+    else if(option == "--size" && arg + 1 < argc)
+      sscanf(argv[++arg], "%dx%d", &window_width, &window_height);
+    else if(option == "--output" && arg + 1 < argc)
+      outputFile = argv[++arg];
+    else if(option == "--scramble" && arg + 1 < argc)
+      scramble = argv[++arg];
+    else if(option == "--cube" && arg + 1 < argc)
+      puzzleSize = atoi(argv[++arg]);
+    else if(option == "--no-cull")
+      culling = false;
+    else if(option == "--wall" && arg + 1 < argc)
+      wallSize = atoi(argv[++arg]);
+    else if(option == "--no-indirect")
+      indirect = false;
+    else if(option == "--moves" && arg + 1 < argc)
+      moves = argv[++arg];
+    else if(option == "--tps" && arg + 1 < argc)
+      turnsPerSecond = atof(argv[++arg]);
+    else if(option == "--no-stream")
+      streaming = false;
+    else if(option == "--trace" && arg + 1 < argc)
+      traceFile = argv[++arg];
+    else {
+      usage(argv[0]);
+      return option == "--help" || option == "-h" ? 0 : -1;
+    }
+  }
+
+  // Setup puzzle state; the scramble is instant, the moves play out.
+  cube::State cubeState;
+  bool bigPuzzle = puzzleSize != 0;
+
+  if(bigPuzzle && (puzzleSize < cube::MIN_BIG_SIZE || puzzleSize > cube::MAX_BIG_SIZE)) {
+    ERRLOG("Puzzle size must be " << cube::MIN_BIG_SIZE << ".." << cube::MAX_BIG_SIZE << ".");
+    return -1;
+  }
+
+  bool wall = wallSize != 0;
+
+  if(wall && (wallSize < 0 || bigPuzzle)) {
+    ERRLOG("A wall takes a positive cube count, and no --cube.");
+    return -1;
+  }
+
+  cube::Animator animator(turnsPerSecond);
+  cube::LayerAnimator layerAnimator(bigPuzzle ? puzzleSize : 3, turnsPerSecond);
+  vector<cube::Animator> wallAnimators(wallSize, cube::Animator(turnsPerSecond));
+
+  try {
+    if(bigPuzzle) {
+      cube::BigCube bigCube(puzzleSize);
+
+      bigCube.apply(cube::parseLayerMoves(scramble, puzzleSize));
+
+      layerAnimator.setCube(bigCube);
+      layerAnimator.queueMoves(cube::parseLayerMoves(moves, puzzleSize));
+    } else {
+      cubeState.apply(cube::parseMoves(scramble));
+
+      animator.setState(cubeState);
+      animator.queueMoves(cube::parseMoves(moves));
+
+      // Every cube on a wall gets its own scramble on top, fixed per seed
+      // so runs are repeatable.
+      minstd_rand random;
+
+      for(int cube = 0; cube < wallSize; ++cube) {
+        cube::State wallState = cubeState;
+
+        for(int move = 0; move < WALL_SCRAMBLE_LENGTH; ++move)
+          wallState.apply((cube::Move)(random() % cube::MOVE_COUNT));
+
+        wallAnimators[cube].setState(wallState);
+        wallAnimators[cube].queueMoves(cube::parseMoves(moves));
+      }
+    }
+  } catch(cube::CubeException& exception) {
+    ERRLOG(exception.what());
+    return -1;
+  }
 
   // Set error callback, because GLFW is being persnickety.
   glfwSetErrorCallback([](int code, const char* message) -> void {
@@ -44,52 +240,71 @@ int main(int argc, char* argv[])
   cerr << "INITIALIZING SYSTEMS" << endl
        << "--------------------" << endl;
 
-  // TODO: Do stuff with window parameters or whatever.
-  window_width = VIEWPORT_WIDTH;
-  window_height = VIEWPORT_HEIGHT;
+  if(headless) {
+    // No window system at all; the draw loop targets an offscreen framebuffer.
+    cerr << "\tHeadless ... \t";
 
-  // Initialize GLFW and check for errors.
-  cerr << "\tGLFW ... \t";
+    try {
+      headlessContext = new glslu::HeadlessContext();
+    } catch(glslu::ContextException& exception) {
+      ERRLOG(exception.what());
+      return -1;
+    }
 
-  if(!glfwInit()) {
-    ERRLOG("Could not initialize GLFW!");
+    cerr << "OK" << endl;
+  } else {
+    // Initialize GLFW and check for errors.
+    cerr << "\tGLFW ... \t";
 
-    glfwTerminate();
+    if(!glfwInit()) {
+      ERRLOG("Could not initialize GLFW!");
 
-    return -1;
-  } else {
-    cerr << "OK" << endl;
-  }
+      glfwTerminate();
 
-  // Window Creation
-  cerr << "\tWindow ... \t";
+      return -1;
+    } else {
+      cerr << "OK" << endl;
+    }
 
-  // Window hints to ensure GLFW context is proper.
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    // Window Creation
+    cerr << "\tWindow ... \t";
 
-  // Attempt to create window based on context.
-  hWindow = glfwCreateWindow(window_width, window_height, "WINDOW", NULL, NULL);
-  if(!hWindow) {
-    ERRLOG("Could not create a window!");
+    // Window hints to ensure GLFW context is proper.
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
 
-    glfwTerminate();
-    return -1;
-  } else {
-    cerr << "OK" << endl;
+    // Attempt to create window based on context.
+    hWindow = glfwCreateWindow(window_width, window_height, "WINDOW", NULL, NULL);
+    if(!hWindow) {
+      ERRLOG("Could not create a window!");
+
+      glfwTerminate();
+      return -1;
+    } else {
+      cerr << "OK" << endl;
+    }
+
+    // Focus window context.
+    glfwMakeContextCurrent(hWindow);
   }
 
-  // Focus window context.
-  glfwMakeContextCurrent(hWindow);
+  // Tear down whichever context we made.
+  auto shutdown = [&]() -> void {
+    if(headless)
+      delete headlessContext;
+    else {
+      glfwDestroyWindow(hWindow);
+      glfwTerminate();
+    }
+  };
 
-  // Initialize GL using created loader.
+  // Initialize GL using created loader. Entry points bind on first use.
   cerr << "\tLoad GL ... \t";
 
-  if(!gl::sys::LoadFunctions()) {
+  if(!gl::sys::LoadFunctionsLazy()) {
     ERRLOG("Could not load OpenGL!");
 
-    glfwDestroyWindow(hWindow);
-    glfwTerminate();
+    shutdown();
     return -1;
   } else {
     cerr << "OK [v" << gl::sys::GetMajorVersion() << "." << gl::sys::GetMinorVersion() << endl;
@@ -98,503 +313,110 @@ int main(int argc, char* argv[])
   // Attempt to get context
   cerr << "\tGL Context ... \t";
 
-  if(!glfwGetCurrentContext()) {
+  if(!headless && !glfwGetCurrentContext()) {
     ERRLOG("Could not get context!");
 
-    glfwDestroyWindow(hWindow);
-    glfwTerminate();
+    shutdown();
     return -1;
   } else {
     cerr << "OK [v" << (gl::GetString(gl::VERSION) != NULL ? (const char*)gl::GetString(gl::VERSION) : "NULL") << "; GLSL v" << gl::GetString(gl::SHADING_LANGUAGE_VERSION) << "]" << endl;
   }
 
+  // Offscreen target for headless frames.
+  glslu::Framebuffer* framebuffer = NULL;
+
+  if(headless) {
+    try {
+      framebuffer = new glslu::Framebuffer(window_width, window_height);
+      framebuffer->bind();
+    } catch(glslu::ContextException& exception) {
+      ERRLOG(exception.what());
+
+      shutdown();
+      return -1;
+    }
+  }
+
   cerr << "SYSTEM ... OK" << endl
        << "RUNNING" << endl;
 
   // Setup shader program
   Program basicProgram;
-  basicProgram.compileShader("src/shaders/colormvp.glsl.vert");
-  basicProgram.compileShader("src/shaders/color.glsl.frag");
+  glslu::ProgramCache programCache(SHADER_CACHE_DIRECTORY);
+  vector<string> basicShaders;
 
-  basicProgram.link();
+  basicShaders.push_back(bigPuzzle ? "src/shaders/bigcube.glsl.vert" : "src/shaders/colormvp.glsl.vert");
+  basicShaders.push_back("src/shaders/color.glsl.frag");
+
+  programCache.build(basicProgram, basicShaders);
 
   if(!basicProgram.isLinked()) {
     ERRLOG("Could not link shader program.");
 
-    glfwDestroyWindow(hWindow);
-    glfwTerminate();
+    delete framebuffer;
+    shutdown();
     return -1;
   } else
     basicProgram.use();
 
   // Setup scene matrices
-  mat4 projection = perspective(45.0f, 4.0f/3.0f, 0.1f, 100.0f);
+  mat4 projection = perspective(45.0f, (float)window_width/window_height, 0.1f, 100.0f);
   mat4 view = translate(mat4(1.0f), vec3(0.0f, 0.0f, -8.0f));
-  mat4 model = mat4(1.0f);
-  mat4 mvp = projection*view*model;
-
-  // Setup cube poitns
-  static const vec3 vertex_data[] = {
-    //*
-    vec3( 0.5f,  0.5f,  0.5f),
-    vec3( 0.5f,  0.5f, -0.5f),
-    vec3(-0.5f,  0.5f, -0.5f),
-    vec3(-0.5f,  0.5f,  0.5f),
-
-    vec3( 0.5f, -0.5f,  0.5f),
-    vec3( 0.5f, -0.5f, -0.5f),
-    vec3(-0.5f, -0.5f, -0.5f),
-    vec3(-0.5f, -0.5f,  0.5f)
-    //*/
-  };
-
-  static const vec3 normal_data[] = {
-    vec3( 1.0f,  0.0f,  0.0f),
-    vec3(-1.0f,  0.0f,  0.0f),
-    vec3( 0.0f,  1.0f,  0.0f),
-    vec3( 0.0f, -1.0f,  0.0f),
-    vec3( 0.0f,  0.0f,  1.0f),
-    vec3( 0.0f,  0.0f, -1.0f)
-  };
-
-  static const vec3 color_data[] = {
-    vec3(1.0f, 0.0f, 0.0f), // RED
-    vec3(0.0f, 1.0f, 0.0f), // GREEN
-    vec3(1.0f, 1.0f, 0.0f), // YELLOW
-    vec3(0.0f, 0.0f, 1.0f), // BLUE
-    vec3(1.0f, 1.0f, 1.0f), // WHITE
-    vec3(1.0f, 0.5f, 0.0f)  // ORANGE
-  };
-
-  static const float cube_data[] = {
-    //*
-    // Top
-    vertex_data[2][0],
-    vertex_data[2][1],
-    vertex_data[2][2],
-    vertex_data[1][0],
-    vertex_data[1][1],
-    vertex_data[1][2],
-    vertex_data[0][0],
-    vertex_data[0][1],
-    vertex_data[0][2],
-
-    vertex_data[2][0],
-    vertex_data[2][1],
-    vertex_data[2][2],
-    vertex_data[0][0],
-    vertex_data[0][1],
-    vertex_data[0][2],
-    vertex_data[3][0],
-    vertex_data[3][1],
-    vertex_data[3][2],
-
-    // Bottom
-    vertex_data[4][0],
-    vertex_data[4][1],
-    vertex_data[4][2],
-    vertex_data[5][0],
-    vertex_data[5][1],
-    vertex_data[5][2],
-    vertex_data[6][0],
-    vertex_data[6][1],
-    vertex_data[6][2],
-
-    vertex_data[4][0],
-    vertex_data[4][1],
-    vertex_data[4][2],
-    vertex_data[6][0],
-    vertex_data[6][1],
-    vertex_data[6][2],
-    vertex_data[7][0],
-    vertex_data[7][1],
-    vertex_data[7][2],
-
-    // Left
-    vertex_data[0][0],
-    vertex_data[0][1],
-    vertex_data[0][2],
-    vertex_data[1][0],
-    vertex_data[1][1],
-    vertex_data[1][2],
-    vertex_data[5][0],
-    vertex_data[5][1],
-    vertex_data[5][2],
-
-    vertex_data[0][0],
-    vertex_data[0][1],
-    vertex_data[0][2],
-    vertex_data[5][0],
-    vertex_data[5][1],
-    vertex_data[5][2],
-    vertex_data[4][0],
-    vertex_data[4][1],
-    vertex_data[4][2],
-
-    // Right
-    vertex_data[3][0],
-    vertex_data[3][1],
-    vertex_data[3][2],
-    vertex_data[6][0],
-    vertex_data[6][1],
-    vertex_data[6][2],
-    vertex_data[7][0],
-    vertex_data[7][1],
-    vertex_data[7][2],
-
-    vertex_data[3][0],
-    vertex_data[3][1],
-    vertex_data[3][2],
-    vertex_data[2][0],
-    vertex_data[2][1],
-    vertex_data[2][2],
-    vertex_data[6][0],
-    vertex_data[6][1],
-    vertex_data[6][2],
-
-    // Front
-    vertex_data[3][0],
-    vertex_data[3][1],
-    vertex_data[3][2],
-    vertex_data[0][0],
-    vertex_data[0][1],
-    vertex_data[0][2],
-    vertex_data[4][0],
-    vertex_data[4][1],
-    vertex_data[4][2],
-
-    vertex_data[3][0],
-    vertex_data[3][1],
-    vertex_data[3][2],
-    vertex_data[4][0],
-    vertex_data[4][1],
-    vertex_data[4][2],
-    vertex_data[7][0],
-    vertex_data[7][1],
-    vertex_data[7][2],
-
-    // Back
-    vertex_data[1][0],
-    vertex_data[1][1],
-    vertex_data[1][2],
-    vertex_data[2][0],
-    vertex_data[2][1],
-    vertex_data[2][2],
-    vertex_data[5][0],
-    vertex_data[5][1],
-    vertex_data[5][2],
-
-    vertex_data[2][0],
-    vertex_data[2][1],
-    vertex_data[2][2],
-    vertex_data[6][0],
-    vertex_data[6][1],
-    vertex_data[6][2],
-    vertex_data[5][0],
-    vertex_data[5][1],
-    vertex_data[5][2]
-    //*/
-  };
-
-  static const float cube_color[] = {
-    // Top
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-    color_data[0][0],
-    color_data[0][1],
-    color_data[0][2],
-
-    // Bottom
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-    color_data[5][0],
-    color_data[5][1],
-    color_data[5][2],
-
-    // Left
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-    color_data[2][0],
-    color_data[2][1],
-    color_data[2][2],
-
-    // Right
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-    color_data[4][0],
-    color_data[4][1],
-    color_data[4][2],
-
-    // Front
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-    color_data[1][0],
-    color_data[1][1],
-    color_data[1][2],
-
-    // Back
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2],
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2],
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2],
-
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2],
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2],
-    color_data[3][0],
-    color_data[3][1],
-    color_data[3][2]
-  };
-
-  static const float cube_normal[] = {
-    // Front
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-    normal_data[2][0],
-    normal_data[2][1],
-    normal_data[2][2],
-
-    // Bottom
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-    normal_data[3][0],
-    normal_data[3][1],
-    normal_data[3][2],
-
-    // Left
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-    normal_data[0][0],
-    normal_data[0][1],
-    normal_data[0][2],
-
-    // Right
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-    normal_data[1][0],
-    normal_data[1][1],
-    normal_data[1][2],
-
-    // Front
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-    normal_data[4][0],
-    normal_data[4][1],
-    normal_data[4][2],
-
-    // Bottom
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2],
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2],
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2],
-
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2],
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2],
-    normal_data[5][0],
-    normal_data[5][1],
-    normal_data[5][2]
-  };
 
   // State setup
   gl::ClearColor(0.95f, 0.95f, 0.95f, 1.0f);
   gl::CullFace(gl::FRONT_AND_BACK);
   gl::Enable(gl::DEPTH_TEST);
 
-  // Setup buffers for cube.
-  GLuint buffers[3];
-  gl::GenBuffers(3, buffers);
+  // Cubie mesh, instances and the camera block.
+  cube::Renderer* renderer = NULL;
+  cube::BigRenderer* bigRenderer = NULL;
+  cube::WallRenderer* wallRenderer = NULL;
 
-  // Populate position buffer
-  gl::BindBuffer(gl::ARRAY_BUFFER, buffers[0]);
-  //gl::BufferData(gl::ARRAY_BUFFER, 6*2*3*3*sizeof(float), cube_data, gl::STATIC_DRAW);
-  gl::BufferData(gl::ARRAY_BUFFER, sizeof(cube_data), cube_data, gl::STATIC_DRAW);
+  if(bigPuzzle) {
+    bigRenderer = new cube::BigRenderer(puzzleSize);
 
-  // Bind the data buffer to the VAO
-  GLuint vao;
-  gl::GenVertexArrays(1, &vao);
-  gl::BindVertexArray(vao);
+    bigRenderer->setCulling(culling);
+    bigRenderer->setProjection(projection);
+    bigRenderer->setView(view);
+  } else if(wall) {
+    wallRenderer = new cube::WallRenderer(wallSize, (int)ceil(sqrt((double)wallSize)));
 
-  // Enable VAO for position
-  gl::EnableVertexAttribArray(0);
-  gl::VertexAttribPointer(0, 3, gl::FLOAT, gl::FALSE_, 0, NULL);
+    wallRenderer->setIndirect(indirect);
+    wallRenderer->setProjection(projection);
+    wallRenderer->setView(view);
+    wallRenderer->setupProgram(basicProgram);
+  } else {
+    renderer = new cube::Renderer();
 
-  // Populate color buffer
-  gl::BindBuffer(gl::ARRAY_BUFFER, buffers[1]);
-  //gl::BufferData(gl::ARRAY_BUFFER, 6*2*3*3*sizeof(float), cube_color, gl::STATIC_DRAW);
-  gl::BufferData(gl::ARRAY_BUFFER, sizeof(cube_color), cube_color, gl::STATIC_DRAW);
+    renderer->setProjection(projection);
+    renderer->setView(view);
+    renderer->setupProgram(basicProgram);
+  }
 
-  // Enable VAO for color
-  gl::EnableVertexAttribArray(1);
-  gl::VertexAttribPointer(1, 3, gl::FLOAT, gl::FALSE_, 0, NULL);
+  // Per-frame data goes through a persistently mapped ring when the
+  // driver has buffer storage, so it never waits on the GPU.
+  glslu::RingBuffer* stream = NULL;
 
-  // Populate normal buffer
-  gl::BindBuffer(gl::ARRAY_BUFFER, buffers[2]);
-  gl::BufferData(gl::ARRAY_BUFFER, sizeof(cube_normal), cube_normal, gl::STATIC_DRAW);
+  if(streaming && glslu::RingBuffer::isSupported()) {
+    try {
+      // A wall streams all of its instance matrices every frame.
+      stream = new glslu::RingBuffer(STREAM_REGION_SIZE + (size_t)wallSize*cube::SLOT_COUNT*sizeof(mat4));
+    } catch(glslu::BufferException& exception) {
+      ERRLOG(exception.what());
+    }
+  }
 
-  // Enable VAO for color
-  gl::EnableVertexAttribArray(2);
-  gl::VertexAttribPointer(2, 3, gl::FLOAT, gl::FALSE_, 0, NULL);
+  if(bigPuzzle)
+    bigRenderer->setStream(stream);
+  else if(wall)
+    wallRenderer->setStream(stream);
+  else
+    renderer->setStream(stream);
 
-  // Set uniform, as it won't need be changed.
-  basicProgram.setUniform("projection", projection);
-  basicProgram.setUniform("view", view);
+  // Rebuild shaders when their files change.
+  glslu::ShaderWatcher shaderWatcher;
+  shaderWatcher.watch(basicProgram);
 
   // Setup rotation modifiers
   float orbit_radius = 8.0f;
@@ -605,13 +427,43 @@ int main(int argc, char* argv[])
   glm::vec2 originalMousePosition;
   mouse_state currentMouseState = MOUSE_RELEASED;
 
+  // Frame timing; a histogram is printed on exit.
+  glslu::FrameProfiler profiler;
+
+  frame_clock::time_point start = frame_clock::now();
+  frame_clock::time_point lastFrame = start;
+  int frame;
+
+  Controls controls = { &animator, bigPuzzle ? &layerAnimator : NULL, wall ? &wallAnimators : NULL };
+
+  if(!headless) {
+    glfwSetWindowUserPointer(hWindow, &controls);
+    glfwSetKeyCallback(hWindow, keyCallback);
+  }
+
   // Enter main loop of application.
-  while(!glfwWindowShouldClose(hWindow)) {
+  for(frame = 0; headless ? frame < frameCount : !glfwWindowShouldClose(hWindow); ++frame) {
+    profiler.beginFrame();
+    profiler.mark("input");
+
+    // Pick up edited shaders; the old program stays on failure. A reloaded
+    // program starts from scratch, so its uniforms are set up again.
+    if(shaderWatcher.poll(&cerr) > 0) {
+      if(bigPuzzle)
+        basicProgram.use();
+      else if(wall)
+        wallRenderer->setupProgram(basicProgram);
+      else
+        renderer->setupProgram(basicProgram);
+    }
+
     // Clear window
     gl::Clear(gl::COLOR_BUFFER_BIT | gl::DEPTH_BUFFER_BIT);
 
     // Check mouse input
-    if(glfwGetMouseButton(hWindow, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS) {
+    if(headless) {
+      // Nobody to drag the camera.
+    } else if(glfwGetMouseButton(hWindow, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS) {
       double x, y;
       glm::vec2 mouseDelta;
 
@@ -646,8 +498,13 @@ int main(int argc, char* argv[])
       // Set look-at vector.
       view = glm::lookAt(cameraPosition, vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f));
 
-      // Set uniform.
-      basicProgram.setUniform("view", view);
+      // Update camera block.
+      if(bigPuzzle)
+        bigRenderer->setView(view);
+      else if(wall)
+        wallRenderer->setView(view);
+      else
+        renderer->setView(view);
     } else {
       double x, y;
 
@@ -663,39 +520,102 @@ int main(int argc, char* argv[])
       originalMousePosition = glm::vec2((float)(x), (float)(y));
     }
 
-    // Draw Rubick's Cube :DDDDD
-    for(int x = -1; x < 2; ++x) {
-      for(int y = -1; y < 2; ++y) {
-        for(int z = -1; z < 2; ++z) {
-          if(x == 0 && y == 0 && z == 0)
-            continue;
-
-          mat4 model;
-          float scale = 1.0f;
-          float spacing = 0.1f;
-          float offset = scale + spacing;
-
-          // Calculate model matrix!
-          mat4 cubeModel = glm::scale(translate(mat4(1.0f), vec3(x*offset, y*offset, z*offset)), vec3(scale));
-          basicProgram.setUniform("model", cubeModel);
-
-          // Render the current cube.
-          gl::DrawArrays(gl::TRIANGLES, 0, 6*2*3);
-        }
+    // Advance turns by the frame's real time; headless steps a fixed 60 Hz
+    // so its output doesn't depend on how fast it renders.
+    frame_clock::time_point now = frame_clock::now();
+
+    double elapsed = headless ? 1.0/60.0 : chrono::duration<double>(now - lastFrame).count();
+
+    lastFrame = now;
+
+    // Rebuild model matrices for cubies that moved since the last frame.
+    profiler.mark("uniforms");
+
+    if(stream != NULL)
+      stream->beginFrame();
+
+    if(bigPuzzle) {
+      layerAnimator.update(elapsed);
+      bigRenderer->update(layerAnimator.getCube(), layerAnimator.getMove(), layerAnimator.getTurn());
+    } else if(wall) {
+      for(int cube = 0; cube < wallSize; ++cube) {
+        wallAnimators[cube].update(elapsed);
+        wallRenderer->update(cube, wallAnimators[cube].getState(), wallAnimators[cube].getMove(), wallAnimators[cube].getTurn());
       }
+    } else {
+      animator.update(elapsed);
+      renderer->update(animator.getState(), animator.getMove(), animator.getTurn());
     }
 
+    // Draw Rubick's Cube :DDDDD
+    profiler.mark("draw");
+
+    if(bigPuzzle)
+      bigRenderer->draw();
+    else if(wall)
+      wallRenderer->draw();
+    else
+      renderer->draw();
+
+    if(stream != NULL)
+      stream->endFrame();
+
     gl::Flush();
 
     // Window housekeeping...
-    glfwSwapBuffers(hWindow);
-    glfwPollEvents();
+    profiler.mark("swap");
+
+    if(!headless) {
+      glfwSwapBuffers(hWindow);
+      glfwPollEvents();
+    }
+
+    profiler.endFrame();
 
     // SPAAAAAAAAACESHIP!
     [=](){;;;;};
   }
 
+  if(headless) {
+    vector<unsigned char> pixels;
+
+    // Include the GPU's share of the last frames in the timing.
+    gl::Finish();
+
+    double elapsed = chrono::duration<double, milli>(frame_clock::now() - start).count();
+
+    cerr << frame << " frames, " << (frame > 0 ? elapsed/frame : 0.0) << " ms/frame";
+
+    if(bigPuzzle)
+      cerr << ", " << bigRenderer->getInstanceCount() << " cubies drawn";
+    else if(wall)
+      cerr << ", " << wallSize << " cubes in " << wallRenderer->getDrawCalls() << " draw calls";
+
+    cerr << endl;
+
+    framebuffer->read(pixels);
+
+    if(!writePPM(outputFile, window_width, window_height, pixels))
+      ERRLOG("Could not write \"" << outputFile << "\".");
+  }
+
+  profiler.writeHistogram(cerr);
+
+  if(stream != NULL)
+    cerr << "Ring buffer: " << stream->getRegionCount() << " x " << stream->getRegionSize() << " bytes, "
+         << stream->getStallCount() << " stalled frames" << endl;
+
+  if(!traceFile.empty() && !profiler.writeTrace(traceFile))
+    ERRLOG("Could not write \"" << traceFile << "\".");
+
+  cerr << "GL entry points resolved: " << gl::sys::GetResolvedCount() << " of " << gl::sys::GetFunctionCount() << endl;
+
   // Cleanup application and exit.
-  glfwTerminate();
+  delete renderer;
+  delete bigRenderer;
+  delete wallRenderer;
+  delete stream;
+  delete framebuffer;
+  shutdown();
   return 0;
 }
@@ -0,0 +1,189 @@
+#include "mappedfile.hpp"
+
+#include <sstream>
+#include <string>
+
+#include <stdio.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+using std::stringstream;
+
+namespace sysu
+{
+    // Constructor
+    MappedFile::MappedFile(void):
+	address(NULL), length(0),
+#ifdef _WIN32
+	fileHandle(NULL), mappingHandle(NULL)
+#else
+	descriptor(-1)
+#endif
+    {}
+
+    // Opening constructor
+    MappedFile::MappedFile(const string& filename)
+	throw(SystemException):
+	address(NULL), length(0),
+#ifdef _WIN32
+	fileHandle(NULL), mappingHandle(NULL)
+#else
+	descriptor(-1)
+#endif
+    {
+	open(filename);
+    }
+
+    // Destructor
+    MappedFile::~MappedFile(void)
+    {
+	close();
+    }
+
+    // Map a file, replacing any previous mapping
+    void MappedFile::open(const string& filename)
+	throw(SystemException)
+    {
+	close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if(file == INVALID_HANDLE_VALUE) {
+	    stringstream buffer;
+
+	    buffer << "Could not open \"" << filename << "\" for mapping.";
+
+	    throw SystemException(buffer.str());
+	}
+
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(file, &fileSize);
+
+	fileHandle = file;
+	length = (size_t)fileSize.QuadPart;
+
+	// Empty files can't be mapped, but are still valid.
+	if(length > 0) {
+	    mappingHandle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+	    if(mappingHandle != NULL)
+		address = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+	    if(address == NULL) {
+		stringstream buffer;
+
+		buffer << "Could not map \"" << filename << "\".";
+
+		close();
+
+		throw SystemException(buffer.str());
+	    }
+	}
+#else
+	int file = ::open(filename.c_str(), O_RDONLY);
+
+	if(file < 0) {
+	    stringstream buffer;
+
+	    buffer << "Could not open \"" << filename << "\" for mapping.";
+
+	    throw SystemException(buffer.str());
+	}
+
+	struct stat info;
+	fstat(file, &info);
+
+	descriptor = file;
+	length = (size_t)info.st_size;
+
+	// Empty files can't be mapped, but are still valid.
+	if(length > 0) {
+	    void* mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, file, 0);
+
+	    if(mapping == MAP_FAILED) {
+		stringstream buffer;
+
+		buffer << "Could not map \"" << filename << "\".";
+
+		close();
+
+		throw SystemException(buffer.str());
+	    }
+
+	    address = mapping;
+	}
+#endif
+
+	this->filename = filename;
+    }
+
+    // Unmap and release handles
+    void MappedFile::close(void)
+    {
+#ifdef _WIN32
+	if(address != NULL)
+	    UnmapViewOfFile(address);
+
+	if(mappingHandle != NULL)
+	    CloseHandle((HANDLE)mappingHandle);
+
+	if(fileHandle != NULL)
+	    CloseHandle((HANDLE)fileHandle);
+
+	fileHandle = NULL;
+	mappingHandle = NULL;
+#else
+	if(address != NULL)
+	    munmap(address, length);
+
+	if(descriptor >= 0)
+	    ::close(descriptor);
+
+	descriptor = -1;
+#endif
+
+	address = NULL;
+	length = 0;
+	filename.clear();
+    }
+
+    // Open accessor
+    bool MappedFile::isOpen(void) const
+    {
+#ifdef _WIN32
+	return fileHandle != NULL;
+#else
+	return descriptor >= 0;
+#endif
+    }
+
+    // Atomic replace
+    bool replaceFile(const string& temporary, const string& filename)
+    {
+#ifdef _WIN32
+	bool replaced = MoveFileExA(temporary.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	bool replaced = rename(temporary.c_str(), filename.c_str()) == 0;
+#endif
+
+	if(!replaced)
+	    remove(temporary.c_str());
+
+	return replaced;
+    }
+}
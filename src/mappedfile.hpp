@@ -0,0 +1,61 @@
+#ifndef SYSTEM_UTILITIES_MAPPED_FILE
+#define SYSTEM_UTILITIES_MAPPED_FILE
+
+#include <stdexcept>
+#include <string>
+
+#include <stddef.h>
+
+namespace sysu
+{
+    class SystemException: public std::runtime_error
+    {
+    public:
+	SystemException(const std::string &msg): std::runtime_error(msg) {}
+    };
+
+    // Read-only memory map of a whole file. Others may still write, rename
+    // or delete it meanwhile (Windows included), but keep it open only as
+    // long as the data is needed: some writers fail on a mapped file.
+    class MappedFile
+    {
+    private:
+	void* address;
+	size_t length;
+	std::string filename;
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#else
+	int descriptor;
+#endif
+
+	// Prevent object copying
+	MappedFile(const MappedFile& other) {}
+	MappedFile& operator=(const MappedFile& other) { return *this; }
+
+    public:
+	// Constructor/Destructor
+	MappedFile(void);
+	explicit MappedFile(const std::string& filename) throw (SystemException);
+	~MappedFile(void);
+
+	// File management
+	void open(const std::string& filename) throw (SystemException);
+	void close(void);
+
+	// Status functions
+	bool isOpen(void) const;
+	const char* data(void) const { return (const char*)address; }
+	size_t size(void) const { return length; }
+	const std::string& getFilename(void) const { return filename; }
+    };
+
+    // Move a finished temporary file over filename in one step (rename, or
+    // MoveFileEx on Windows), so readers find either the old contents or
+    // the new, never a partial file or none. On failure the temporary is
+    // deleted and filename is left as it was.
+    bool replaceFile(const std::string& temporary, const std::string& filename);
+}
+
+#endif
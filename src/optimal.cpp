@@ -0,0 +1,323 @@
+#include "optimal.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using std::atomic;
+using std::deque;
+using std::mutex;
+using std::lock_guard;
+using std::stringstream;
+using std::thread;
+using std::vector;
+
+namespace cube
+{
+    namespace OptimalInfo {
+	enum { MAX_SPLIT_DEPTH = 4 };
+
+	// Search position in coordinates.
+	struct Node
+	{
+	    int twist;
+	    int flip;
+	    int slice;
+	    int corners;
+	};
+
+	// A subtree rooted after a short move prefix.
+	struct Task
+	{
+	    Node node;
+	    Move prefix[MAX_SPLIT_DEPTH];
+	    int prefixLength;
+	    int lastFace;
+	};
+
+	// Owner pushes and pops at the back, thieves take from the front, so
+	// a thief gets the oldest (and, being generated first, largest) work.
+	class TaskDeque
+	{
+	private:
+	    mutex lock;
+	    deque<Task> tasks;
+
+	public:
+	    void push(const Task& task)
+	    {
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(task);
+	    }
+
+	    bool pop(Task& task)
+	    {
+		lock_guard<mutex> guard(lock);
+
+		if(tasks.empty()) return false;
+
+		task = tasks.back();
+		tasks.pop_back();
+
+		return true;
+	    }
+
+	    bool steal(Task& task)
+	    {
+		lock_guard<mutex> guard(lock);
+
+		if(tasks.empty()) return false;
+
+		task = tasks.front();
+		tasks.pop_front();
+
+		return true;
+	    }
+	};
+
+	// State shared by every thread for one IDA* iteration.
+	struct Search
+	{
+	    const SolverTables& tables;
+	    const CornerDatabase* corners;
+	    const State& start;
+	    int bound;
+	    atomic<int> best;
+	    mutex solutionLock;
+	    vector<Move> solution;
+	    vector<TaskDeque> deques;
+
+	    Search(const SolverTables& tables, const CornerDatabase* corners, const State& start, int threads):
+		tables(tables), corners(corners), start(start), bound(0), best(INT_MAX), deques(threads) {}
+	};
+
+	// Skip same-face repeats and one order of commuting opposite faces.
+	inline bool isAllowed(int face, int lastFace)
+	{
+	    return face != lastFace && !(lastFace >= 0 && face % 3 == lastFace % 3 && face < lastFace);
+	}
+
+	inline Node applyMove(const SolverTables& tables, const Node& node, int move)
+	{
+	    Node next;
+
+	    next.twist = tables.twistMove[node.twist*MOVE_COUNT + move];
+	    next.flip = tables.flipMove[node.flip*MOVE_COUNT + move];
+	    next.slice = tables.sliceMove[node.slice*MOVE_COUNT + move];
+	    next.corners = tables.cornerPermutationMove[node.corners*MOVE_COUNT + move];
+
+	    return next;
+	}
+
+	// Phase 1 and corner distances never exceed the distance to solved.
+	inline int getDistance(const Search& search, const Node& node)
+	{
+	    int twist = search.tables.sliceTwistPrune[node.slice*TWIST_COUNT + node.twist];
+	    int flip = search.tables.sliceFlipPrune[node.slice*FLIP_COUNT + node.flip];
+	    int distance = twist > flip ? twist : flip;
+
+	    if(search.corners) {
+		int corners = search.corners->getDistance(node.corners, node.twist);
+
+		if(corners > distance)
+		    distance = corners;
+	    }
+
+	    return distance;
+	}
+
+	// Enumerate the prefixes that survive pruning down to the split depth.
+	void expand(Search& search, const Node& node, Task& task, int depth, int splitDepth, vector<Task>& tasks)
+	{
+	    if(depth == splitDepth) {
+		task.node = node;
+		task.prefixLength = depth;
+		tasks.push_back(task);
+
+		return;
+	    }
+
+	    int lastFace = task.lastFace;
+
+	    for(int move = 0; move < MOVE_COUNT; ++move) {
+		if(!isAllowed(move/3, lastFace))
+		    continue;
+
+		Node next = applyMove(search.tables, node, move);
+
+		if(getDistance(search, next) > search.bound - depth - 1)
+		    continue;
+
+		task.prefix[depth] = (Move)move;
+		task.lastFace = move/3;
+
+		expand(search, next, task, depth + 1, splitDepth, tasks);
+	    }
+
+	    task.lastFace = lastFace;
+	}
+
+	// Depth-first search below a task, exactly togo more moves.
+	bool searchTree(Search& search, const Node& node, vector<Move>& path, int togo, int lastFace, ThreadStats& stats)
+	{
+	    ++stats.nodes;
+
+	    // Someone else already finished this bound.
+	    if(search.best.load(std::memory_order_relaxed) <= search.bound)
+		return false;
+
+	    if(togo == 0) {
+		State state = search.start;
+		state.apply(path);
+
+		if(!state.isSolved())
+		    return false;
+
+		lock_guard<mutex> guard(search.solutionLock);
+
+		if(search.best.load() > search.bound) {
+		    search.solution = path;
+		    search.best.store(search.bound);
+		}
+
+		return true;
+	    }
+
+	    for(int move = 0; move < MOVE_COUNT; ++move) {
+		if(!isAllowed(move/3, lastFace))
+		    continue;
+
+		Node next = applyMove(search.tables, node, move);
+
+		if(getDistance(search, next) >= togo)
+		    continue;
+
+		path.push_back((Move)move);
+
+		if(searchTree(search, next, path, togo - 1, move/3, stats))
+		    return true;
+
+		path.pop_back();
+	    }
+
+	    return false;
+	}
+
+	// Drain our own deque, then steal until every deque is empty.
+	void runWorker(Search& search, int id, ThreadStats& stats)
+	{
+	    typedef std::chrono::steady_clock worker_clock;
+
+	    worker_clock::time_point begin = worker_clock::now();
+	    int threads = (int)search.deques.size();
+	    vector<Move> path;
+	    Task task;
+
+	    while(search.best.load(std::memory_order_relaxed) > search.bound) {
+		bool found = search.deques[id].pop(task);
+
+		for(int offset = 1; !found && offset < threads; ++offset)
+		    if(search.deques[(id + offset) % threads].steal(task)) {
+			found = true;
+			++stats.steals;
+		    }
+
+		if(!found) break;
+
+		++stats.tasks;
+		path.assign(task.prefix, task.prefix + task.prefixLength);
+
+		if(searchTree(search, task.node, path, search.bound - task.prefixLength, task.lastFace, stats))
+		    break;
+	    }
+
+	    stats.seconds += std::chrono::duration<double>(worker_clock::now() - begin).count();
+	}
+    }
+
+    // Constructor
+    OptimalSolver::OptimalSolver(const SolverTables& tables, int threadCount):
+	tables(tables), corners(NULL), threadCount(threadCount), splitDepth(3)
+    {
+	if(this->threadCount <= 0)
+	    this->threadCount = (int)thread::hardware_concurrency();
+
+	if(this->threadCount <= 0)
+	    this->threadCount = 1;
+    }
+
+    // Split depth mutator
+    void OptimalSolver::setSplitDepth(int depth)
+    {
+	if(depth < 0) depth = 0;
+	if(depth > OptimalInfo::MAX_SPLIT_DEPTH) depth = OptimalInfo::MAX_SPLIT_DEPTH;
+
+	splitDepth = depth;
+    }
+
+    // Iterative deepening, one parallel pass per bound
+    vector<Move> OptimalSolver::solve(const State& state, int maxLength)
+	throw(CubeException)
+    {
+	using namespace OptimalInfo;
+
+	if(!state.isValid())
+	    throw CubeException("Cube state is not solvable!");
+
+	stats.assign(threadCount, ThreadStats());
+
+	if(state.isSolved())
+	    return vector<Move>();
+
+	Search search(tables, corners, state, threadCount);
+	Node root;
+
+	root.twist = getTwist(state);
+	root.flip = getFlip(state);
+	root.slice = getSlice(state);
+	root.corners = getCornerPermutation(state);
+
+	for(int bound = getDistance(search, root) > 0 ? getDistance(search, root) : 1; bound <= maxLength; ++bound) {
+	    Task task;
+	    vector<Task> tasks;
+
+	    search.bound = bound;
+	    task.lastFace = -1;
+	    task.prefixLength = 0;
+
+	    expand(search, root, task, 0, splitDepth < bound ? splitDepth : bound, tasks);
+
+	    // Deal tasks round-robin, stealing evens out whatever is left.
+	    for(size_t index = 0; index < tasks.size(); ++index)
+		search.deques[index % threadCount].push(tasks[index]);
+
+	    vector<thread> workers;
+
+	    for(int id = 1; id < threadCount; ++id)
+		workers.push_back(thread(runWorker, std::ref(search), id, std::ref(stats[id])));
+
+	    runWorker(search, 0, stats[0]);
+
+	    for(size_t worker = 0; worker < workers.size(); ++worker)
+		workers[worker].join();
+
+	    if(search.best.load() <= bound)
+		return search.solution;
+
+	    // Clear leftovers from threads that stopped early.
+	    for(int id = 0; id < threadCount; ++id)
+		while(search.deques[id].pop(task));
+	}
+
+	stringstream buffer;
+
+	buffer << "No solution within " << maxLength << " moves.";
+
+	throw CubeException(buffer.str());
+    }
+}
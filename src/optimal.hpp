@@ -0,0 +1,60 @@
+#ifndef CUBE_OPTIMAL
+#define CUBE_OPTIMAL
+
+#include <vector>
+
+#include <stdint.h>
+
+#include "cube.hpp"
+#include "solver.hpp"
+#include "cornerdb.hpp"
+
+namespace cube
+{
+    // Per-thread search statistics, accumulated over one solve.
+    struct ThreadStats
+    {
+	uint64_t nodes;
+	uint64_t tasks;
+	uint64_t steals;
+	double seconds;
+
+	ThreadStats(void): nodes(0), tasks(0), steals(0), seconds(0.0) {}
+
+	double getNodesPerSecond(void) const { return seconds > 0.0 ? nodes/seconds : 0.0; }
+    };
+
+    // Optimal (face turn metric) solver. Each IDA* iteration splits the tree
+    // at a fixed depth into tasks, spreads them over per-thread work-stealing
+    // deques, and stops every thread once any of them finds a solution.
+    class OptimalSolver
+    {
+    private:
+	const SolverTables& tables;
+	const CornerDatabase* corners;
+	int threadCount;
+	int splitDepth;
+	std::vector<ThreadStats> stats;
+
+    public:
+	// A thread count of 0 uses every hardware thread.
+	OptimalSolver(const SolverTables& tables, int threadCount = 0);
+
+	// Configuration
+	int getThreadCount(void) const { return threadCount; }
+	int getSplitDepth(void) const { return splitDepth; }
+	void setSplitDepth(int depth);
+
+	// Tighten the heuristic with a corner pattern database (NULL for none).
+	const CornerDatabase* getCornerDatabase(void) const { return corners; }
+	void setCornerDatabase(const CornerDatabase* database) { corners = database; }
+
+	// Solve a state optimally, giving up beyond maxLength moves.
+	std::vector<Move> solve(const State& state, int maxLength = 20) throw (CubeException);
+
+	// Statistics of the last solve, one entry per thread
+	const std::vector<ThreadStats>& getThreadStats(void) const { return stats; }
+    };
+}
+
+#endif
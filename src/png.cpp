@@ -0,0 +1,276 @@
+#include "png.hpp"
+
+#include <stdint.h>
+#include <stddef.h>
+
+using std::vector;
+
+namespace sysu
+{
+    namespace PNGInfo {
+	enum { WINDOW_SIZE = 1 << 15, HASH_BITS = 15, MAX_CHAIN = 32, MIN_MATCH = 3, MAX_MATCH = 258 };
+
+	const uint16_t lengthBase[29] = {
+	    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+	};
+	const uint8_t lengthExtra[29] = {
+	    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+	};
+	const uint16_t distanceBase[30] = {
+	    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+	};
+	const uint8_t distanceExtra[30] = {
+	    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+	};
+
+	// CRC-32 lookup, built once (thread-safe as a function local static)
+	struct CRCTable
+	{
+	    uint32_t entries[256];
+
+	    CRCTable(void)
+	    {
+		for(uint32_t entry = 0; entry < 256; ++entry) {
+		    uint32_t remainder = entry;
+
+		    for(int bit = 0; bit < 8; ++bit)
+			remainder = (remainder & 1) ? 0xEDB88320u ^ (remainder >> 1) : remainder >> 1;
+
+		    entries[entry] = remainder;
+		}
+	    }
+	};
+
+	// CRC-32 as PNG chunks use it
+	uint32_t crc(const unsigned char* data, size_t length, uint32_t value = 0)
+	{
+	    static const CRCTable table;
+
+	    value = ~value;
+
+	    for(size_t byte = 0; byte < length; ++byte)
+		value = table.entries[(value ^ data[byte]) & 0xFF] ^ (value >> 8);
+
+	    return ~value;
+	}
+
+	// Deflate bits go out least significant first.
+	class BitWriter
+	{
+	private:
+	    vector<unsigned char>& output;
+	    uint32_t buffer;
+	    int count;
+
+	public:
+	    BitWriter(vector<unsigned char>& output): output(output), buffer(0), count(0) {}
+
+	    void write(uint32_t bits, int length)
+	    {
+		buffer |= bits << count;
+		count += length;
+
+		while(count >= 8) {
+		    output.push_back((unsigned char)buffer);
+		    buffer >>= 8;
+		    count -= 8;
+		}
+	    }
+
+	    // Huffman codes are defined most significant bit first.
+	    void writeCode(uint32_t code, int length)
+	    {
+		uint32_t reversed = 0;
+
+		for(int bit = 0; bit < length; ++bit)
+		    reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+
+		write(reversed, length);
+	    }
+
+	    void flush(void)
+	    {
+		if(count > 0)
+		    output.push_back((unsigned char)buffer);
+
+		buffer = 0;
+		count = 0;
+	    }
+	};
+
+	// Fixed Huffman literal/length alphabet
+	void writeSymbol(BitWriter& writer, int symbol)
+	{
+	    if(symbol < 144)
+		writer.writeCode(0x30 + symbol, 8);
+	    else if(symbol < 256)
+		writer.writeCode(0x190 + symbol - 144, 9);
+	    else if(symbol < 280)
+		writer.writeCode(symbol - 256, 7);
+	    else
+		writer.writeCode(0xC0 + symbol - 280, 8);
+	}
+
+	void writeMatch(BitWriter& writer, int length, int distance)
+	{
+	    int code = 28;
+
+	    while(lengthBase[code] > length) --code;
+
+	    writeSymbol(writer, 257 + code);
+	    writer.write(length - lengthBase[code], lengthExtra[code]);
+
+	    code = 29;
+
+	    while(distanceBase[code] > distance) --code;
+
+	    writer.writeCode(code, 5);
+	    writer.write(distance - distanceBase[code], distanceExtra[code]);
+	}
+
+	uint32_t hash(const unsigned char* data)
+	{
+	    return ((uint32_t)data[0] << 16 | (uint32_t)data[1] << 8 | data[2])*2654435761u >> (32 - HASH_BITS);
+	}
+
+	// zlib stream: one fixed Huffman block over hash chain matches.
+	void deflate(const vector<unsigned char>& data, vector<unsigned char>& output)
+	{
+	    BitWriter writer(output);
+	    vector<int32_t> head(1 << HASH_BITS, -1);
+	    vector<int32_t> previous(WINDOW_SIZE, -1);
+	    size_t length = data.size();
+	    size_t position = 0;
+
+	    output.push_back(0x78);
+	    output.push_back(0x01);
+
+	    writer.write(1, 1);
+	    writer.write(1, 2);
+
+	    while(position < length) {
+		int bestLength = 0;
+		int bestDistance = 0;
+
+		if(position + MIN_MATCH <= length) {
+		    uint32_t key = hash(&data[position]);
+		    int32_t candidate = head[key];
+		    int limit = (int)(length - position < (size_t)MAX_MATCH ? length - position : (size_t)MAX_MATCH);
+
+		    for(int chain = 0; candidate >= 0 && chain < MAX_CHAIN; ++chain) {
+			int distance = (int)(position - candidate);
+
+			if(distance > WINDOW_SIZE - 1) break;
+
+			int matched = 0;
+
+			while(matched < limit && data[candidate + matched] == data[position + matched])
+			    ++matched;
+
+			if(matched > bestLength) {
+			    bestLength = matched;
+			    bestDistance = distance;
+
+			    if(matched == limit) break;
+			}
+
+			candidate = previous[candidate % WINDOW_SIZE];
+		    }
+		}
+
+		size_t advance = bestLength >= MIN_MATCH ? bestLength : 1;
+
+		if(bestLength >= MIN_MATCH)
+		    writeMatch(writer, bestLength, bestDistance);
+		else
+		    writeSymbol(writer, data[position]);
+
+		// Index every position passed over so later matches can find it.
+		for(size_t end = position + advance; position < end; ++position)
+		    if(position + MIN_MATCH <= length) {
+			uint32_t key = hash(&data[position]);
+
+			previous[position % WINDOW_SIZE] = head[key];
+			head[key] = (int32_t)position;
+		    }
+	    }
+
+	    writeSymbol(writer, 256);
+	    writer.flush();
+
+	    // Adler-32, big-endian
+	    uint32_t a = 1, b = 0;
+
+	    for(size_t byte = 0; byte < length; ++byte) {
+		a = (a + data[byte]) % 65521;
+		b = (b + a) % 65521;
+	    }
+
+	    for(int shift = 24; shift >= 0; shift -= 8)
+		output.push_back((unsigned char)(((b << 16) | a) >> shift));
+	}
+
+	void writeUint32(vector<unsigned char>& output, uint32_t value)
+	{
+	    for(int shift = 24; shift >= 0; shift -= 8)
+		output.push_back((unsigned char)(value >> shift));
+	}
+
+	void writeChunk(vector<unsigned char>& png, const char type[4], const vector<unsigned char>& data)
+	{
+	    writeUint32(png, (uint32_t)data.size());
+
+	    size_t start = png.size();
+
+	    png.insert(png.end(), type, type + 4);
+	    png.insert(png.end(), data.begin(), data.end());
+
+	    writeUint32(png, crc(&png[start], png.size() - start));
+	}
+    }
+
+    // Signature, header, one data chunk, end
+    void encodePNG(const unsigned char* rgba, int width, int height, vector<unsigned char>& png, bool alpha)
+    {
+	static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+	int channels = alpha ? 4 : 3;
+	size_t rowLength = (size_t)width*channels;
+	vector<unsigned char> filtered((rowLength + 1)*height);
+	vector<unsigned char> header;
+	vector<unsigned char> compressed;
+
+	// Sub filter: each byte minus the same channel one pixel left.
+	for(int row = 0; row < height; ++row) {
+	    const unsigned char* source = rgba + (size_t)row*width*4;
+	    unsigned char* target = &filtered[row*(rowLength + 1)];
+
+	    *target++ = 1;
+
+	    for(int column = 0; column < width; ++column)
+		for(int channel = 0; channel < channels; ++channel) {
+		    unsigned char left = column > 0 ? source[4*(column - 1) + channel] : 0;
+
+		    *target++ = (unsigned char)(source[4*column + channel] - left);
+		}
+	}
+
+	PNGInfo::writeUint32(header, (uint32_t)width);
+	PNGInfo::writeUint32(header, (uint32_t)height);
+	header.push_back(8);
+	header.push_back(alpha ? 6 : 2);
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);
+
+	PNGInfo::deflate(filtered, compressed);
+
+	png.assign(signature, signature + sizeof(signature));
+	PNGInfo::writeChunk(png, "IHDR", header);
+	PNGInfo::writeChunk(png, "IDAT", compressed);
+	PNGInfo::writeChunk(png, "IEND", vector<unsigned char>());
+    }
+}
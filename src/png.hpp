@@ -0,0 +1,16 @@
+#ifndef SYSTEM_UTILITIES_PNG
+#define SYSTEM_UTILITIES_PNG
+
+#include <vector>
+
+namespace sysu
+{
+    // Encode tightly packed RGBA rows (top to bottom) as an 8 bit PNG,
+    // RGB unless alpha is kept. Self-contained: each row is Sub filtered
+    // and deflated with LZ77 and the fixed Huffman codes, which suits flat
+    // rendered images well without needing zlib.
+    void encodePNG(const unsigned char* rgba, int width, int height,
+		   std::vector<unsigned char>& png, bool alpha = false);
+}
+
+#endif
@@ -0,0 +1,241 @@
+#include "profiler.hpp"
+#include "mappedfile.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+using std::deque;
+using std::endl;
+using std::ios;
+using std::ofstream;
+using std::ostream;
+using std::string;
+using std::vector;
+
+namespace glslu
+{
+    namespace ProfilerInfo {
+	enum { CPU_THREAD = 1, GPU_THREAD = 2 };
+
+	// Bucket upper bounds, in ms; the last bucket takes the rest.
+	const double bucketLimits[] = { 1.0, 2.0, 4.0, 8.0, 12.0, 16.7, 20.0, 33.3, 50.0, 100.0 };
+	const int bucketCount = sizeof(bucketLimits)/sizeof(bucketLimits[0]) + 1;
+    }
+
+    // Constructor
+    FrameProfiler::FrameProfiler(size_t historyLength, int queryDepth, size_t maxTraceEvents):
+	origin(profile_clock::now()), activeQuery(-1), frame(0), frameStart(0.0),
+	phaseName(NULL), phaseStart(0.0), historyLength(historyLength), maxTraceEvents(maxTraceEvents)
+    {
+	queries.resize(queryDepth < 1 ? 1 : queryDepth);
+
+	for(size_t query = 0; query < queries.size(); ++query) {
+	    gl::GenQueries(1, &queries[query].handle);
+	    queries[query].frame = -1;
+	    queries[query].start = 0.0;
+	}
+    }
+
+    // Deconstructor!
+    FrameProfiler::~FrameProfiler(void)
+    {
+	if(activeQuery >= 0)
+	    gl::EndQuery(gl::TIME_ELAPSED);
+
+	for(size_t query = 0; query < queries.size(); ++query)
+	    gl::DeleteQueries(1, &queries[query].handle);
+    }
+
+    // Microseconds since construction
+    double FrameProfiler::now(void) const
+    {
+	return std::chrono::duration<double, std::micro>(profile_clock::now() - origin).count();
+    }
+
+    // Trace storage, capped
+    void FrameProfiler::record(const char* name, int thread, double start, double duration)
+    {
+	if(trace.size() >= maxTraceEvents)
+	    return;
+
+	TraceEvent event = { name, thread, start, duration };
+
+	trace.push_back(event);
+    }
+
+    // Read back every finished query that isn't running
+    void FrameProfiler::collectQueries(void)
+    {
+	for(size_t slot = 0; slot < queries.size(); ++slot) {
+	    Query& query = queries[slot];
+	    GLint available = 0;
+
+	    if(query.frame < 0 || (int)slot == activeQuery)
+		continue;
+
+	    gl::GetQueryObjectiv(query.handle, gl::QUERY_RESULT_AVAILABLE, &available);
+
+	    if(!available)
+		continue;
+
+	    GLuint64 elapsed = 0;
+
+	    gl::GetQueryObjectui64v(query.handle, gl::QUERY_RESULT, &elapsed);
+
+	    query.frame = -1;
+
+	    // A frame can't take the GPU longer than the time since it began;
+	    // some drivers (llvmpipe) return garbage for the very first query.
+	    if(elapsed/1000.0 > now() - query.start)
+		continue;
+
+	    // GPU work has no CPU-side start; show it from the frame's start.
+	    record("gpu frame", ProfilerInfo::GPU_THREAD, query.start, elapsed/1000.0);
+
+	    gpuHistory.push_back(elapsed/1e6);
+
+	    if(gpuHistory.size() > historyLength)
+		gpuHistory.pop_front();
+	}
+    }
+
+    // Start timing a frame
+    void FrameProfiler::beginFrame(void)
+    {
+	frameStart = now();
+	phaseName = NULL;
+
+	collectQueries();
+
+	// Skip the GPU timing rather than wait on a slot still in flight.
+	int slot = frame % (int)queries.size();
+
+	if(queries[slot].frame < 0) {
+	    gl::BeginQuery(gl::TIME_ELAPSED, queries[slot].handle);
+
+	    queries[slot].frame = frame;
+	    queries[slot].start = frameStart;
+	    activeQuery = slot;
+	}
+    }
+
+    // Close the last phase and the frame
+    void FrameProfiler::endFrame(void)
+    {
+	double end = now();
+
+	if(phaseName != NULL)
+	    record(phaseName, ProfilerInfo::CPU_THREAD, phaseStart, end - phaseStart);
+
+	phaseName = NULL;
+
+	if(activeQuery >= 0) {
+	    gl::EndQuery(gl::TIME_ELAPSED);
+	    activeQuery = -1;
+	}
+
+	record("frame", ProfilerInfo::CPU_THREAD, frameStart, end - frameStart);
+
+	cpuHistory.push_back((end - frameStart)/1000.0);
+
+	if(cpuHistory.size() > historyLength)
+	    cpuHistory.pop_front();
+
+	++frame;
+    }
+
+    // Phase switch
+    void FrameProfiler::mark(const char* name)
+    {
+	double time = now();
+
+	if(phaseName != NULL)
+	    record(phaseName, ProfilerInfo::CPU_THREAD, phaseStart, time - phaseStart);
+
+	phaseName = name;
+	phaseStart = time;
+    }
+
+    // One histogram block
+    void FrameProfiler::writeHistogram(ostream& output, const char* label, const deque<double>& times)
+    {
+	if(times.empty()) {
+	    output << label << ": no samples" << endl;
+	    return;
+	}
+
+	vector<double> sorted(times.begin(), times.end());
+	ios::fmtflags flags = output.flags();
+	std::streamsize precision = output.precision();
+	int buckets[ProfilerInfo::bucketCount] = {0};
+	int largest = 0;
+
+	std::sort(sorted.begin(), sorted.end());
+
+	for(size_t sample = 0; sample < sorted.size(); ++sample) {
+	    int bucket = 0;
+
+	    while(bucket < ProfilerInfo::bucketCount - 1 && sorted[sample] > ProfilerInfo::bucketLimits[bucket])
+		++bucket;
+
+	    largest = std::max(largest, ++buckets[bucket]);
+	}
+
+	output << std::fixed << std::setprecision(2)
+	       << label << ": " << sorted.size() << " frames, min " << sorted.front()
+	       << " / p50 " << sorted[sorted.size()/2]
+	       << " / p95 " << sorted[sorted.size()*95/100]
+	       << " / p99 " << sorted[sorted.size()*99/100]
+	       << " / max " << sorted.back() << " ms" << endl;
+
+	for(int bucket = 0; bucket < ProfilerInfo::bucketCount; ++bucket) {
+	    if(bucket < ProfilerInfo::bucketCount - 1)
+		output << "\t<= " << std::setw(6) << ProfilerInfo::bucketLimits[bucket] << " ms ";
+	    else
+		output << "\t >  " << std::setw(6) << ProfilerInfo::bucketLimits[bucket - 1] << " ms ";
+
+	    output << std::setw(6) << buckets[bucket] << " " << string(buckets[bucket]*40/largest, '#') << endl;
+	}
+
+	output.flags(flags);
+	output.precision(precision);
+    }
+
+    // Both windows
+    void FrameProfiler::writeHistogram(ostream& output) const
+    {
+	writeHistogram(output, "CPU frame", cpuHistory);
+	writeHistogram(output, "GPU frame", gpuHistory);
+    }
+
+    // Chrome trace-event format, complete ("X") events
+    bool FrameProfiler::writeTrace(const string& filename) const
+    {
+	// Write beside the target, then move into place.
+	string temporary = filename + ".tmp";
+	ofstream output(temporary.c_str(), ios::out | ios::trunc);
+
+	output << std::fixed << std::setprecision(3)
+	       << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << endl
+	       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ProfilerInfo::CPU_THREAD << ",\"args\":{\"name\":\"CPU\"}}," << endl
+	       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ProfilerInfo::GPU_THREAD << ",\"args\":{\"name\":\"GPU\"}}";
+
+	for(size_t event = 0; event < trace.size(); ++event)
+	    output << "," << endl
+		   << "{\"name\":\"" << trace[event].name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << trace[event].thread
+		   << ",\"ts\":" << trace[event].start << ",\"dur\":" << trace[event].duration << "}";
+
+	output << endl << "]}" << endl;
+
+	output.close();
+
+	if(!output) {
+	    remove(temporary.c_str());
+	    return false;
+	}
+
+	return sysu::replaceFile(temporary, filename);
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef GLSL_UTILITIES_PROFILER
+#define GLSL_UTILITIES_PROFILER
+
+#include <chrono>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "gl_core_4_4.hpp"
+
+namespace glslu
+{
+    // Per-frame timing: named CPU phases from a steady clock, and GPU time
+    // from GL_TIME_ELAPSED queries. Queries cycle through a small ring and
+    // are only read once the driver reports them available, so results
+    // arrive a frame or two late but never stall; a frame whose slot is
+    // still busy just goes without a GPU time.
+    //
+    // Keeps a rolling window for histograms, and every event (up to a cap)
+    // for a Chrome trace-event file (chrome://tracing, Perfetto).
+    class FrameProfiler
+    {
+    private:
+	typedef std::chrono::steady_clock profile_clock;
+
+	struct TraceEvent
+	{
+	    const char* name;
+	    int thread;
+	    double start;
+	    double duration;
+	};
+
+	struct Query
+	{
+	    GLuint handle;
+	    int frame;
+	    double start;
+	};
+
+	profile_clock::time_point origin;
+	std::vector<Query> queries;
+	int activeQuery;
+
+	int frame;
+	double frameStart;
+	const char* phaseName;
+	double phaseStart;
+
+	size_t historyLength;
+	std::deque<double> cpuHistory;
+	std::deque<double> gpuHistory;
+
+	size_t maxTraceEvents;
+	std::vector<TraceEvent> trace;
+
+	double now(void) const;
+	void record(const char* name, int thread, double start, double duration);
+	void collectQueries(void);
+
+	static void writeHistogram(std::ostream& output, const char* label, const std::deque<double>& times);
+
+	// Prevent object copying
+	FrameProfiler(const FrameProfiler& other) {}
+	FrameProfiler& operator=(const FrameProfiler& other) { return *this; }
+
+    public:
+	// Constructor/Destructor; needs a current GL context.
+	FrameProfiler(size_t historyLength = 600, int queryDepth = 2, size_t maxTraceEvents = 1 << 20);
+	~FrameProfiler(void);
+
+	// Frame brackets
+	void beginFrame(void);
+	void endFrame(void);
+
+	// End the current phase, if any, and start the named one. Names must
+	// outlive the profiler (string literals).
+	void mark(const char* name);
+
+	// Status functions
+	int getFrameCount(void) const { return frame; }
+
+	// Percentiles and a bucketed histogram of the recent window.
+	void writeHistogram(std::ostream& output) const;
+
+	// Trace-event JSON of everything recorded.
+	bool writeTrace(const std::string& filename) const;
+    };
+}
+
+#endif
@@ -0,0 +1,775 @@
+#include "renderer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+using glm::vec3;
+using glm::mat4;
+using std::vector;
+
+namespace cube
+{
+    namespace RendererInfo {
+	// Interleaved cubie vertex, 20 bytes once the compiler pads out color.
+	struct CubeVertex
+	{
+	    float position[3];
+	    GLuint normal;
+	    GLubyte color;
+	};
+
+	// Pack an axis normal as GL_INT_2_10_10_10_REV.
+	GLuint packNormal(int x, int y, int z)
+	{
+	    return (GLuint)(x*511 & 0x3FF) | (GLuint)(y*511 & 0x3FF) << 10 | (GLuint)(z*511 & 0x3FF) << 20;
+	}
+
+	// Cubie mesh: four vertices per face so each face keeps its own normal
+	// and palette index (the face it shows when solved), drawn as 36 indices.
+	const CubeVertex cubeVertices[] = {
+	    // Top
+	    {{-0.5f,  0.5f,  0.5f}, packNormal( 0,  1,  0), 0},
+	    {{ 0.5f,  0.5f,  0.5f}, packNormal( 0,  1,  0), 0},
+	    {{ 0.5f,  0.5f, -0.5f}, packNormal( 0,  1,  0), 0},
+	    {{-0.5f,  0.5f, -0.5f}, packNormal( 0,  1,  0), 0},
+
+	    // Bottom
+	    {{-0.5f, -0.5f, -0.5f}, packNormal( 0, -1,  0), 3},
+	    {{ 0.5f, -0.5f, -0.5f}, packNormal( 0, -1,  0), 3},
+	    {{ 0.5f, -0.5f,  0.5f}, packNormal( 0, -1,  0), 3},
+	    {{-0.5f, -0.5f,  0.5f}, packNormal( 0, -1,  0), 3},
+
+	    // Left
+	    {{ 0.5f, -0.5f,  0.5f}, packNormal( 1,  0,  0), 1},
+	    {{ 0.5f, -0.5f, -0.5f}, packNormal( 1,  0,  0), 1},
+	    {{ 0.5f,  0.5f, -0.5f}, packNormal( 1,  0,  0), 1},
+	    {{ 0.5f,  0.5f,  0.5f}, packNormal( 1,  0,  0), 1},
+
+	    // Right
+	    {{-0.5f, -0.5f, -0.5f}, packNormal(-1,  0,  0), 4},
+	    {{-0.5f, -0.5f,  0.5f}, packNormal(-1,  0,  0), 4},
+	    {{-0.5f,  0.5f,  0.5f}, packNormal(-1,  0,  0), 4},
+	    {{-0.5f,  0.5f, -0.5f}, packNormal(-1,  0,  0), 4},
+
+	    // Front
+	    {{-0.5f, -0.5f,  0.5f}, packNormal( 0,  0,  1), 2},
+	    {{ 0.5f, -0.5f,  0.5f}, packNormal( 0,  0,  1), 2},
+	    {{ 0.5f,  0.5f,  0.5f}, packNormal( 0,  0,  1), 2},
+	    {{-0.5f,  0.5f,  0.5f}, packNormal( 0,  0,  1), 2},
+
+	    // Back
+	    {{ 0.5f, -0.5f, -0.5f}, packNormal( 0,  0, -1), 5},
+	    {{-0.5f, -0.5f, -0.5f}, packNormal( 0,  0, -1), 5},
+	    {{-0.5f,  0.5f, -0.5f}, packNormal( 0,  0, -1), 5},
+	    {{ 0.5f,  0.5f, -0.5f}, packNormal( 0,  0, -1), 5}
+	};
+
+	// Two counter-clockwise triangles per face.
+	const GLubyte cubeIndices[] = {
+	     0,  1,  2,   0,  2,  3,
+	     4,  5,  6,   4,  6,  7,
+	     8,  9, 10,   8, 10, 11,
+	    12, 13, 14,  12, 14, 15,
+	    16, 17, 18,  16, 18, 19,
+	    20, 21, 22,  20, 22, 23
+	};
+
+	// Default palette, indexed by vertex color or sticker value (URFDLB),
+	// then the core color for faces without a sticker.
+	const vec3 colorData[PALETTE_SIZE] = {
+	    vec3(1.0f, 0.0f, 0.0f), // RED
+	    vec3(1.0f, 1.0f, 0.0f), // YELLOW
+	    vec3(0.0f, 1.0f, 0.0f), // GREEN
+	    vec3(1.0f, 0.5f, 0.0f), // ORANGE
+	    vec3(1.0f, 1.0f, 1.0f), // WHITE
+	    vec3(0.0f, 0.0f, 1.0f), // BLUE
+	    vec3(0.1f, 0.1f, 0.1f)  // CORE
+	};
+
+	// Model matrix of the cubie in a slot, with a small gap between cubies.
+	mat4 getCubieModel(const State& state, int slot)
+	{
+	    int position[3];
+	    int rotation[9];
+	    float scale = 1.0f;
+	    float spacing = 0.1f;
+	    float offset = scale + spacing;
+
+	    getSlotPosition(slot, position);
+	    state.getRotation(slot, rotation);
+
+	    // Calculate model matrix!
+	    mat4 cubeRotation = mat4(glm::mat3(vec3(rotation[0], rotation[1], rotation[2]),
+					       vec3(rotation[3], rotation[4], rotation[5]),
+					       vec3(rotation[6], rotation[7], rotation[8])));
+
+	    return glm::scale(glm::translate(mat4(1.0f), vec3(position[0]*offset, position[1]*offset, position[2]*offset))*cubeRotation, vec3(scale));
+	}
+
+	// glMultiDrawElementsIndirect's command layout
+	struct DrawElementsIndirectCommand
+	{
+	    GLuint count;
+	    GLuint instanceCount;
+	    GLuint firstIndex;
+	    GLint baseVertex;
+	    GLuint baseInstance;
+	};
+
+	// Width of a wall, in puzzle footprints of 3.2 with a gap.
+	const float WALL_WIDTH = 4.4f;
+
+	// Unchanged stickers a run of changed ones may span before it's split.
+	enum { STICKER_RUN_GAP = 256 };
+
+	// Vertex and index buffers for the cubie mesh, attributes 0-2 on the
+	// bound VAO.
+	void setupCubieMesh(const GLuint buffers[2])
+	{
+	    // Populate interleaved vertex buffer
+	    gl::BindBuffer(gl::ARRAY_BUFFER, buffers[0]);
+	    gl::BufferData(gl::ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, gl::STATIC_DRAW);
+
+	    // Enable VAO for position
+	    gl::EnableVertexAttribArray(0);
+	    gl::VertexAttribPointer(0, 3, gl::FLOAT, gl::FALSE_, sizeof(CubeVertex), (const void*)offsetof(CubeVertex, position));
+
+	    // Enable VAO for palette index, kept an integer
+	    gl::EnableVertexAttribArray(1);
+	    gl::VertexAttribIPointer(1, 1, gl::UNSIGNED_BYTE, sizeof(CubeVertex), (const void*)offsetof(CubeVertex, color));
+
+	    // Enable VAO for normal
+	    gl::EnableVertexAttribArray(2);
+	    gl::VertexAttribPointer(2, 4, gl::INT_2_10_10_10_REV, gl::TRUE_, sizeof(CubeVertex), (const void*)offsetof(CubeVertex, normal));
+
+	    // Populate index buffer, which the VAO remembers
+	    gl::BindBuffer(gl::ELEMENT_ARRAY_BUFFER, buffers[1]);
+	    gl::BufferData(gl::ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, gl::STATIC_DRAW);
+	}
+
+	// Point attributes 3-6 of the bound VAO at the mat4s in buffer from
+	// offset on; a mat4 attribute takes four column locations, advanced
+	// per instance.
+	void pointInstanceMatrices(GLuint buffer, size_t offset)
+	{
+	    gl::BindBuffer(gl::ARRAY_BUFFER, buffer);
+
+	    for(int column = 0; column < 4; ++column)
+		gl::VertexAttribPointer(3 + column, 4, gl::FLOAT, gl::FALSE_, sizeof(mat4), (const void*)(offset + column*sizeof(glm::vec4)));
+	}
+
+	void setupInstanceMatrices(GLuint buffer)
+	{
+	    for(int column = 0; column < 4; ++column) {
+		gl::EnableVertexAttribArray(3 + column);
+		gl::VertexAttribDivisor(3 + column, 1);
+	    }
+
+	    pointInstanceMatrices(buffer, 0);
+	}
+    }
+
+    // Constructor
+    Renderer::Renderer(void):
+	projectionOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	viewOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	cameraBuffer(CAMERA_BINDING, cameraLayout.getSize()),
+	paletteOffset(paletteLayout.addArray(glslu::STD140_VEC3, PALETTE_SIZE)),
+	paletteBuffer(PALETTE_BINDING, paletteLayout.getSize()),
+	model(1.0f),
+	dirtySlots((1u << SLOT_COUNT) - 1),
+	turningSlots(0),
+	stream(NULL)
+    {
+	for(int color = 0; color < PALETTE_SIZE; ++color)
+	    setColor(color, RendererInfo::colorData[color]);
+
+	// Setup buffers for cube.
+	gl::GenBuffers(2, buffers);
+
+	// Bind the data buffer to the VAO
+	gl::GenVertexArrays(1, &vao);
+	gl::BindVertexArray(vao);
+
+	RendererInfo::setupCubieMesh(buffers);
+
+	// Per-cubie model matrices, one instance each, filled in as slots change.
+	gl::GenBuffers(1, &instanceBuffer);
+
+	gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+	gl::BufferData(gl::ARRAY_BUFFER, SLOT_COUNT*sizeof(mat4), NULL, gl::DYNAMIC_DRAW);
+
+	RendererInfo::setupInstanceMatrices(instanceBuffer);
+    }
+
+    // Deconstructor!
+    Renderer::~Renderer(void)
+    {
+	gl::DeleteBuffers(1, &instanceBuffer);
+	gl::DeleteBuffers(2, buffers);
+	gl::DeleteVertexArrays(1, &vao);
+    }
+
+    // Uniforms that don't change (until a reload swaps in a fresh program)
+    void Renderer::setupProgram(glslu::Program& program)
+    {
+	program.use();
+	program.setUniform("model", model);
+    }
+
+    // Camera setters
+    void Renderer::setProjection(const mat4& projection)
+    {
+	cameraBuffer.set(projectionOffset, projection);
+    }
+
+    void Renderer::setView(const mat4& view)
+    {
+	cameraBuffer.set(viewOffset, view);
+    }
+
+    // Palette setter; std140 pads each entry to a vec4.
+    void Renderer::setColor(int index, const vec3& color)
+    {
+	paletteBuffer.set(paletteOffset + 16*index, color);
+    }
+
+    // Stream switch
+    void Renderer::setStream(glslu::RingBuffer* stream)
+    {
+	if(stream == this->stream)
+	    return;
+
+	// Streamed frames never touched the instance buffer.
+	if(stream == NULL) {
+	    gl::BindVertexArray(vao);
+	    RendererInfo::pointInstanceMatrices(instanceBuffer, 0);
+	    dirtySlots = (1u << SLOT_COUNT) - 1;
+	}
+
+	this->stream = stream;
+    }
+
+    // Upload the changed span of instances only
+    void Renderer::update(const State& state, Move move, const glm::quat& turn)
+    {
+	// A turning layer changes every frame, and snaps back once it stops.
+	uint32_t layer = (move == MOVE_NONE) ? 0 : getFaceSlots(getMoveFace(move));
+	mat4 layerRotation = glm::mat4_cast(turn);
+
+	dirtySlots |= state.diff(renderedState) | turningSlots | layer;
+	renderedState = state;
+	turningSlots = layer;
+
+	int firstDirty = SLOT_COUNT;
+	int lastDirty = -1;
+
+	for(int slot = 0; dirtySlots != 0; ++slot, dirtySlots >>= 1) {
+	    if(!(dirtySlots & 1))
+		continue;
+
+	    cubieModels[slot] = RendererInfo::getCubieModel(state, slot);
+
+	    // The layer turns about the puzzle's center.
+	    if(layer & (1u << slot))
+		cubieModels[slot] = layerRotation*cubieModels[slot];
+
+	    if(slot < firstDirty) firstDirty = slot;
+	    lastDirty = slot;
+	}
+
+	// Streamed draws send every matrix anyway.
+	if(lastDirty >= 0 && stream == NULL) {
+	    // The whole span is rewritten, so the driver can discard the old
+	    // contents rather than wait for draws still reading them.
+	    gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+
+	    mat4* mapped = (mat4*)gl::MapBufferRange(gl::ARRAY_BUFFER, firstDirty*sizeof(mat4), (lastDirty - firstDirty + 1)*sizeof(mat4),
+						     gl::MAP_WRITE_BIT | gl::MAP_INVALIDATE_RANGE_BIT);
+
+	    if(mapped != NULL) {
+		std::copy(cubieModels + firstDirty, cubieModels + lastDirty + 1, mapped);
+		gl::UnmapBuffer(gl::ARRAY_BUFFER);
+	    }
+	}
+    }
+
+    // Draw Rubick's Cube :DDDDD
+    void Renderer::draw(void)
+    {
+	gl::BindVertexArray(vao);
+
+	if(stream != NULL) {
+	    size_t offset;
+	    mat4* streamed = (mat4*)stream->allocate(sizeof(cubieModels), sizeof(mat4), offset);
+
+	    cameraBuffer.upload(*stream);
+	    paletteBuffer.upload(*stream);
+
+	    if(streamed != NULL) {
+		std::copy(cubieModels, cubieModels + SLOT_COUNT, streamed);
+		RendererInfo::pointInstanceMatrices(stream->getHandle(), offset);
+	    } else {
+		// Region full; bring the instance buffer up to date instead.
+		RendererInfo::pointInstanceMatrices(instanceBuffer, 0);
+		gl::BufferSubData(gl::ARRAY_BUFFER, 0, sizeof(cubieModels), cubieModels);
+	    }
+	} else {
+	    // Camera and palette changes go up once per draw.
+	    cameraBuffer.upload();
+	    paletteBuffer.upload();
+	}
+
+	gl::DrawElementsInstanced(gl::TRIANGLES, sizeof(RendererInfo::cubeIndices), gl::UNSIGNED_BYTE, NULL, SLOT_COUNT);
+    }
+
+    // Constructor
+    BigRenderer::BigRenderer(int size):
+	projectionOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	viewOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	cameraBuffer(CAMERA_BINDING, cameraLayout.getSize()),
+	turnOffset(puzzleLayout.add(glslu::STD140_MAT4)),
+	sizeOffset(puzzleLayout.add(glslu::STD140_INT)),
+	turningFromOffset(puzzleLayout.add(glslu::STD140_INT)),
+	puzzleBuffer(PUZZLE_BINDING, puzzleLayout.getSize()),
+	paletteOffset(paletteLayout.addArray(glslu::STD140_VEC3, PALETTE_SIZE)),
+	paletteBuffer(PALETTE_BINDING, paletteLayout.getSize()),
+	size(size), culling(true), instanceCount(0), instancesDirty(true),
+	renderedStickers(FACE_COUNT*size*size, 0xFF),
+	stream(NULL)
+    {
+	turning.face = FACE_U;
+	turning.depth = 0;
+	turning.width = 0;
+	turning.turns = 0;
+
+	puzzleBuffer.set(turnOffset, mat4(1.0f));
+	puzzleBuffer.set(sizeOffset, size);
+
+	for(int color = 0; color < PALETTE_SIZE; ++color)
+	    setColor(color, RendererInfo::colorData[color]);
+
+	// Setup buffers for cube.
+	gl::GenBuffers(2, buffers);
+
+	gl::GenVertexArrays(1, &vao);
+	gl::BindVertexArray(vao);
+
+	RendererInfo::setupCubieMesh(buffers);
+
+	// Grid cell of each instance, as bytes; filled by buildInstances().
+	gl::GenBuffers(1, &instanceBuffer);
+
+	gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+	gl::EnableVertexAttribArray(3);
+	gl::VertexAttribIPointer(3, 3, gl::UNSIGNED_BYTE, 4, NULL);
+	gl::VertexAttribDivisor(3, 1);
+
+	// One byte per sticker, read with texelFetch. Nothing matches the
+	// 0xFF shadow copy, so the first update sends it all.
+	gl::GenBuffers(1, &stickerBuffer);
+	gl::GenTextures(1, &stickerTexture);
+
+	gl::BindBuffer(gl::TEXTURE_BUFFER, stickerBuffer);
+	gl::BufferData(gl::TEXTURE_BUFFER, FACE_COUNT*size*size, NULL, gl::DYNAMIC_DRAW);
+
+	gl::BindTexture(gl::TEXTURE_BUFFER, stickerTexture);
+	gl::TexBuffer(gl::TEXTURE_BUFFER, gl::R8UI, stickerBuffer);
+    }
+
+    // Deconstructor!
+    BigRenderer::~BigRenderer(void)
+    {
+	gl::DeleteTextures(1, &stickerTexture);
+	gl::DeleteBuffers(1, &stickerBuffer);
+	gl::DeleteBuffers(1, &instanceBuffer);
+	gl::DeleteBuffers(2, buffers);
+	gl::DeleteVertexArrays(1, &vao);
+    }
+
+    // Visibility pass: surface cells, with the turning layers' cells last
+    void BigRenderer::buildInstances(void)
+    {
+	vector<GLubyte> moving;
+	int direction[3];
+	int axis = 0;
+	int last = size - 1;
+
+	getSlotPosition(FIRST_CENTER_SLOT + turning.face, direction);
+
+	while(direction[axis] == 0)
+	    ++axis;
+
+	// A turn opens up its layers' cross-sections and the two facing them,
+	// so those layers go in whole, interior faces drawn as the core.
+	int bandFirst = turning.depth - 1;
+	int bandLast = turning.depth + turning.width;
+
+	instances.clear();
+
+	for(int x = 0; x < size; ++x)
+	    for(int y = 0; y < size; ++y) {
+		bool boundary = x == 0 || x == last || y == 0 || y == last;
+
+		for(int z = 0; z < size; ++z) {
+		    int cell[3] = { x, y, z };
+		    int layer = direction[axis] > 0 ? last - cell[axis] : cell[axis];
+		    bool banded = turning.width > 0 && layer >= bandFirst && layer <= bandLast;
+
+		    // Away from the x and y boundaries only the z ends show.
+		    if(culling && !boundary && !banded && z != 0 && z != last) {
+			// Skip to the far end, or the band if it lies on z.
+			int next = last;
+
+			if(axis == 2 && turning.width > 0) {
+			    int bandZ = direction[2] > 0 ? last - bandLast : bandFirst;
+
+			    if(bandZ > z)
+				next = std::min(next, bandZ);
+			}
+
+			z = next - 1;
+			continue;
+		    }
+
+		    vector<GLubyte>& target = (layer >= turning.depth && layer < turning.depth + turning.width) ? moving : instances;
+
+		    target.push_back((GLubyte)x);
+		    target.push_back((GLubyte)y);
+		    target.push_back((GLubyte)z);
+		    target.push_back(0);
+		}
+	    }
+
+	puzzleBuffer.set(turningFromOffset, (int)(instances.size()/4));
+
+	instances.insert(instances.end(), moving.begin(), moving.end());
+	instanceCount = (GLsizei)(instances.size()/4);
+
+	// Fresh storage; the old list may still be in use by the last draw.
+	gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+	gl::BufferData(gl::ARRAY_BUFFER, instances.size(), instances.empty() ? NULL : &instances[0], gl::DYNAMIC_DRAW);
+
+	instancesDirty = false;
+    }
+
+    // Culling switch
+    void BigRenderer::setCulling(bool culling)
+    {
+	this->culling = culling;
+	instancesDirty = true;
+    }
+
+    // Camera setters
+    void BigRenderer::setProjection(const mat4& projection)
+    {
+	cameraBuffer.set(projectionOffset, projection);
+    }
+
+    void BigRenderer::setView(const mat4& view)
+    {
+	cameraBuffer.set(viewOffset, view);
+    }
+
+    // Palette setter
+    void BigRenderer::setColor(int index, const vec3& color)
+    {
+	paletteBuffer.set(paletteOffset + 16*index, color);
+    }
+
+    // Stream switch; the uniform buffers rebind themselves.
+    void BigRenderer::setStream(glslu::RingBuffer* stream)
+    {
+	this->stream = stream;
+    }
+
+    // Stickers and turn
+    void BigRenderer::update(const BigCube& cube, const LayerMove* move, const glm::quat& turn)
+    {
+	LayerMove next = turning;
+
+	next.width = 0;
+
+	if(move != NULL)
+	    next = *move;
+
+	// Only a different set of turning layers reorders the instances.
+	if(next.width != turning.width || (next.width != 0 && (next.face != turning.face || next.depth != turning.depth))) {
+	    turning = next;
+	    instancesDirty = true;
+	}
+
+	if(instancesDirty)
+	    buildInstances();
+
+	puzzleBuffer.set(turnOffset, glm::mat4_cast(turn));
+
+	// Send each run of changed stickers. Runs closer than a gap go as one,
+	// so a turn costs a call or two per face rather than one per sticker.
+	const vector<uint8_t>& stickers = cube.getStickers();
+	vector<uint8_t>::const_iterator first = stickers.begin();
+	bool bound = false;
+
+	while((first = std::mismatch(first, stickers.end(), renderedStickers.begin() + (first - stickers.begin())).first) != stickers.end()) {
+	    vector<uint8_t>::const_iterator last = first + 1;
+	    vector<uint8_t>::const_iterator scan = last;
+
+	    while(scan != stickers.end() && scan - last < RendererInfo::STICKER_RUN_GAP) {
+		if(*scan != renderedStickers[scan - stickers.begin()])
+		    last = scan + 1;
+
+		++scan;
+	    }
+
+	    size_t offset = first - stickers.begin();
+
+	    if(!bound) {
+		gl::BindBuffer(gl::TEXTURE_BUFFER, stickerBuffer);
+		bound = true;
+	    }
+
+	    gl::BufferSubData(gl::TEXTURE_BUFFER, offset, last - first, &*first);
+	    std::copy(first, last, renderedStickers.begin() + offset);
+
+	    first = last;
+	}
+    }
+
+    // Draw the visible cubies
+    void BigRenderer::draw(void)
+    {
+	if(stream != NULL) {
+	    cameraBuffer.upload(*stream);
+	    puzzleBuffer.upload(*stream);
+	    paletteBuffer.upload(*stream);
+	} else {
+	    cameraBuffer.upload();
+	    puzzleBuffer.upload();
+	    paletteBuffer.upload();
+	}
+
+	gl::ActiveTexture(gl::TEXTURE0 + STICKER_UNIT);
+	gl::BindTexture(gl::TEXTURE_BUFFER, stickerTexture);
+
+	gl::BindVertexArray(vao);
+	gl::DrawElementsInstanced(gl::TRIANGLES, sizeof(RendererInfo::cubeIndices), gl::UNSIGNED_BYTE, NULL, instanceCount);
+    }
+
+    // Core in 4.3; before it, the commands' baseInstance also needs
+    // ARB_base_instance. Versions are compared by hand, as the loader's
+    // IsVersionGEQ has its comparisons backwards.
+    bool WallRenderer::isIndirectSupported(void)
+    {
+	int major = gl::sys::GetMajorVersion();
+
+	if(major > 4 || (major == 4 && gl::sys::GetMinorVersion() >= 3))
+	    return true;
+
+	return gl::sys::HasExtension("GL_ARB_multi_draw_indirect") && gl::sys::HasExtension("GL_ARB_base_instance");
+    }
+
+    // Constructor
+    WallRenderer::WallRenderer(int count, int columns):
+	projectionOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	viewOffset(cameraLayout.add(glslu::STD140_MAT4)),
+	cameraBuffer(CAMERA_BINDING, cameraLayout.getSize()),
+	paletteOffset(paletteLayout.addArray(glslu::STD140_VEC3, PALETTE_SIZE)),
+	paletteBuffer(PALETTE_BINDING, paletteLayout.getSize()),
+	count(count < 1 ? 1 : count), indirect(isIndirectSupported()),
+	placements(this->count), renderedStates(this->count), turningSlots(this->count, 0),
+	models(this->count*SLOT_COUNT), dirtyBegin(0), dirtyEnd(models.size()),
+	stream(NULL)
+    {
+	if(columns < 1)
+	    columns = 1;
+
+	int rows = (this->count + columns - 1)/columns;
+	float pitch = RendererInfo::WALL_WIDTH/std::max(columns, rows);
+	State solved;
+
+	for(int color = 0; color < PALETTE_SIZE; ++color)
+	    setColor(color, RendererInfo::colorData[color]);
+
+	// Rows run top to bottom, each cube scaled down to its cell.
+	for(int cube = 0; cube < this->count; ++cube) {
+	    vec3 position((cube % columns - 0.5f*(columns - 1))*pitch, (0.5f*(rows - 1) - cube/columns)*pitch, 0.0f);
+
+	    placements[cube] = glm::scale(glm::translate(mat4(1.0f), position), vec3(pitch/RendererInfo::WALL_WIDTH));
+
+	    for(int slot = 0; slot < SLOT_COUNT; ++slot)
+		models[cube*SLOT_COUNT + slot] = placements[cube]*RendererInfo::getCubieModel(solved, slot);
+	}
+
+	// Setup buffers for cube.
+	gl::GenBuffers(2, buffers);
+
+	gl::GenVertexArrays(1, &vao);
+	gl::BindVertexArray(vao);
+
+	RendererInfo::setupCubieMesh(buffers);
+
+	// Every cube's matrices back to back, SLOT_COUNT apiece.
+	gl::GenBuffers(1, &instanceBuffer);
+
+	gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+	gl::BufferData(gl::ARRAY_BUFFER, models.size()*sizeof(mat4), NULL, gl::DYNAMIC_DRAW);
+
+	RendererInfo::setupInstanceMatrices(instanceBuffer);
+
+	// One command per cube, never changed: the whole mesh, instanced over
+	// the cube's span of matrices.
+	commandBuffer = 0;
+
+	if(indirect) {
+	    vector<RendererInfo::DrawElementsIndirectCommand> commands(this->count);
+
+	    for(int cube = 0; cube < this->count; ++cube) {
+		commands[cube].count = sizeof(RendererInfo::cubeIndices);
+		commands[cube].instanceCount = SLOT_COUNT;
+		commands[cube].firstIndex = 0;
+		commands[cube].baseVertex = 0;
+		commands[cube].baseInstance = cube*SLOT_COUNT;
+	    }
+
+	    gl::GenBuffers(1, &commandBuffer);
+
+	    gl::BindBuffer(gl::DRAW_INDIRECT_BUFFER, commandBuffer);
+	    gl::BufferData(gl::DRAW_INDIRECT_BUFFER, commands.size()*sizeof(commands[0]), &commands[0], gl::STATIC_DRAW);
+	    gl::BindBuffer(gl::DRAW_INDIRECT_BUFFER, 0);
+	}
+    }
+
+    // Deconstructor!
+    WallRenderer::~WallRenderer(void)
+    {
+	if(commandBuffer != 0)
+	    gl::DeleteBuffers(1, &commandBuffer);
+
+	gl::DeleteBuffers(1, &instanceBuffer);
+	gl::DeleteBuffers(2, buffers);
+	gl::DeleteVertexArrays(1, &vao);
+    }
+
+    // Path switch; draw() points the attributes either way.
+    void WallRenderer::setIndirect(bool indirect)
+    {
+	this->indirect = indirect && commandBuffer != 0;
+    }
+
+    // Placement lives in the instance matrices.
+    void WallRenderer::setupProgram(glslu::Program& program)
+    {
+	program.use();
+	program.setUniform("model", mat4(1.0f));
+    }
+
+    // Camera setters
+    void WallRenderer::setProjection(const mat4& projection)
+    {
+	cameraBuffer.set(projectionOffset, projection);
+    }
+
+    void WallRenderer::setView(const mat4& view)
+    {
+	cameraBuffer.set(viewOffset, view);
+    }
+
+    // Palette setter
+    void WallRenderer::setColor(int index, const vec3& color)
+    {
+	paletteBuffer.set(paletteOffset + 16*index, color);
+    }
+
+    // Stream switch; the uniform buffers rebind themselves.
+    void WallRenderer::setStream(glslu::RingBuffer* stream)
+    {
+	this->stream = stream;
+    }
+
+    // Rebuild one cube's moved cubies
+    void WallRenderer::update(int cube, const State& state, Move move, const glm::quat& turn)
+    {
+	if(cube < 0 || cube >= count)
+	    return;
+
+	uint32_t layer = (move == MOVE_NONE) ? 0 : getFaceSlots(getMoveFace(move));
+	uint32_t dirtySlots = state.diff(renderedStates[cube]) | turningSlots[cube] | layer;
+	mat4 layerRotation = glm::mat4_cast(turn);
+	size_t base = (size_t)cube*SLOT_COUNT;
+
+	renderedStates[cube] = state;
+	turningSlots[cube] = layer;
+
+	for(int slot = 0; dirtySlots != 0; ++slot, dirtySlots >>= 1) {
+	    if(!(dirtySlots & 1))
+		continue;
+
+	    mat4 model = RendererInfo::getCubieModel(state, slot);
+
+	    if(layer & (1u << slot))
+		model = layerRotation*model;
+
+	    models[base + slot] = placements[cube]*model;
+
+	    // Cubes that changed this frame are sent as one span.
+	    dirtyBegin = std::min(dirtyBegin, base + slot);
+	    dirtyEnd = std::max(dirtyEnd, base + slot + 1);
+	}
+    }
+
+    // Draw the wall
+    void WallRenderer::draw(void)
+    {
+	if(stream != NULL) {
+	    cameraBuffer.upload(*stream);
+	    paletteBuffer.upload(*stream);
+	} else {
+	    cameraBuffer.upload();
+	    paletteBuffer.upload();
+	}
+
+	gl::BindVertexArray(vao);
+
+	// Streamed, every matrix goes into this frame's region, as the draws
+	// need the whole wall in one buffer; a wall too big for the region
+	// falls back to updating the instance buffer in place. The dirty span
+	// is kept while streaming, so that update catches up on everything.
+	GLuint source = instanceBuffer;
+	size_t base = 0;
+	mat4* streamed = NULL;
+
+	if(stream != NULL)
+	    streamed = (mat4*)stream->allocate(models.size()*sizeof(mat4), sizeof(mat4), base);
+
+	if(streamed != NULL) {
+	    std::copy(models.begin(), models.end(), streamed);
+	    source = stream->getHandle();
+	} else if(dirtyBegin < dirtyEnd) {
+	    gl::BindBuffer(gl::ARRAY_BUFFER, instanceBuffer);
+	    gl::BufferSubData(gl::ARRAY_BUFFER, dirtyBegin*sizeof(mat4), (dirtyEnd - dirtyBegin)*sizeof(mat4), &models[dirtyBegin]);
+
+	    dirtyBegin = models.size();
+	    dirtyEnd = 0;
+	}
+
+	if(indirect) {
+	    RendererInfo::pointInstanceMatrices(source, base);
+
+	    gl::BindBuffer(gl::DRAW_INDIRECT_BUFFER, commandBuffer);
+	    gl::MultiDrawElementsIndirect(gl::TRIANGLES, gl::UNSIGNED_BYTE, NULL, count, 0);
+	    gl::BindBuffer(gl::DRAW_INDIRECT_BUFFER, 0);
+	} else {
+	    // One instanced draw per cube, moving the attributes to its span.
+	    for(int cube = 0; cube < count; ++cube) {
+		RendererInfo::pointInstanceMatrices(source, base + (size_t)cube*SLOT_COUNT*sizeof(mat4));
+		gl::DrawElementsInstanced(gl::TRIANGLES, sizeof(RendererInfo::cubeIndices), gl::UNSIGNED_BYTE, NULL, SLOT_COUNT);
+	    }
+	}
+    }
+}
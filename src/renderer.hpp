@@ -0,0 +1,253 @@
+#ifndef CUBE_RENDERER
+#define CUBE_RENDERER
+
+#include <vector>
+
+#include <stdint.h>
+
+#include "gl_core_4_4.hpp"
+
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "glslu.hpp"
+#include "ringbuffer.hpp"
+#include "cube.hpp"
+#include "bigcube.hpp"
+
+namespace cube
+{
+    // Palette entries: one per face color (URFDLB), then the core.
+    enum { CORE_COLOR = FACE_COUNT, PALETTE_SIZE = FACE_COUNT + 1 };
+
+    // GPU side of one puzzle: the cubie mesh, per-cubie instance matrices
+    // and the shared camera block. Windowed and headless front ends drive
+    // the same draw path through it.
+    class Renderer
+    {
+    private:
+	GLuint vao;
+	GLuint buffers[2];
+	GLuint instanceBuffer;
+
+	glslu::Std140Layout cameraLayout;
+	size_t projectionOffset;
+	size_t viewOffset;
+	glslu::UniformBuffer cameraBuffer;
+
+	glslu::Std140Layout paletteLayout;
+	size_t paletteOffset;
+	glslu::UniformBuffer paletteBuffer;
+
+	glm::mat4 model;
+	State renderedState;
+	glm::mat4 cubieModels[SLOT_COUNT];
+	uint32_t dirtySlots;
+	uint32_t turningSlots;
+	glslu::RingBuffer* stream;
+
+	// Prevent object copying (declared only; the camera buffer can't be
+	// default constructed)
+	Renderer(const Renderer& other);
+	Renderer& operator=(const Renderer& other);
+
+    public:
+	enum { CAMERA_BINDING = 0, PALETTE_BINDING = 2 };
+
+	// Constructor/Destructor; needs a current GL context.
+	Renderer(void);
+	~Renderer(void);
+
+	// Set the uniforms a colormvp style program needs (model).
+	void setupProgram(glslu::Program& program);
+
+	// Camera, sent with the next draw
+	void setProjection(const glm::mat4& projection);
+	void setView(const glm::mat4& view);
+
+	// Palette entry (a Face, or CORE_COLOR), sent with the next draw
+	void setColor(int index, const glm::vec3& color);
+
+	// Send the camera, palette and instance matrices through this frame's
+	// region of a ring buffer on every draw, instead of updating buffers
+	// the GPU may still be reading; NULL goes back to those. The caller
+	// brackets each frame with the ring's beginFrame() and endFrame().
+	void setStream(glslu::RingBuffer* stream);
+
+	// Rebuild matrices for cubies that moved since the last update, with
+	// move's layer (if any) rotated by turn; see Animator. Without a stream
+	// the changed span is written straight into the mapped instance buffer.
+	void update(const State& state, Move move = MOVE_NONE, const glm::quat& turn = glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	// Draw the puzzle with the program in use.
+	void draw(void);
+    };
+
+    // GPU side of an NxN puzzle, for bigcube.glsl.vert. Cubies are unrotated
+    // cells of the N^3 grid, instanced from a list of byte coordinates, and
+    // color their faces from the sticker array, kept on the GPU one byte
+    // per sticker in a buffer texture and looked up in the palette block.
+    //
+    // Only the 6N^2 - 12N + 8 surface cubies are visible, so the instance
+    // list holds just those, the turning layers' cubies last; the shader
+    // rotates instances from that point on. The list is rebuilt only when
+    // the set of turning layers changes, not every frame of a turn.
+    class BigRenderer
+    {
+    private:
+	GLuint vao;
+	GLuint buffers[2];
+	GLuint instanceBuffer;
+	GLuint stickerBuffer;
+	GLuint stickerTexture;
+
+	glslu::Std140Layout cameraLayout;
+	size_t projectionOffset;
+	size_t viewOffset;
+	glslu::UniformBuffer cameraBuffer;
+
+	glslu::Std140Layout puzzleLayout;
+	size_t turnOffset;
+	size_t sizeOffset;
+	size_t turningFromOffset;
+	glslu::UniformBuffer puzzleBuffer;
+
+	glslu::Std140Layout paletteLayout;
+	size_t paletteOffset;
+	glslu::UniformBuffer paletteBuffer;
+
+	int size;
+	bool culling;
+	std::vector<GLubyte> instances;
+	GLsizei instanceCount;
+	bool instancesDirty;
+	LayerMove turning;
+	std::vector<uint8_t> renderedStickers;
+	glslu::RingBuffer* stream;
+
+	void buildInstances(void);
+
+	// Prevent object copying (declared only; the uniform buffer can't be
+	// default constructed)
+	BigRenderer(const BigRenderer& other);
+	BigRenderer& operator=(const BigRenderer& other);
+
+    public:
+	enum { CAMERA_BINDING = Renderer::CAMERA_BINDING, PUZZLE_BINDING = 1, PALETTE_BINDING = Renderer::PALETTE_BINDING, STICKER_UNIT = 0 };
+
+	// Constructor/Destructor; needs a current GL context.
+	BigRenderer(int size);
+	~BigRenderer(void);
+
+	// Status functions
+	int getSize(void) const { return size; }
+	GLsizei getInstanceCount(void) const { return instanceCount; }
+
+	// Surface culling, on by default; off draws every cell of the grid.
+	void setCulling(bool culling);
+
+	// Camera, sent with the next draw
+	void setProjection(const glm::mat4& projection);
+	void setView(const glm::mat4& view);
+
+	// Palette entry (a Face, or CORE_COLOR), sent with the next draw
+	void setColor(int index, const glm::vec3& color);
+
+	// Send the uniform blocks through a ring buffer; see Renderer.
+	void setStream(glslu::RingBuffer* stream);
+
+	// Take new stickers, and the layers of move (if any) rotated by turn;
+	// see LayerAnimator. Only runs of stickers that changed since the last
+	// update are uploaded.
+	void update(const BigCube& cube, const LayerMove* move = NULL, const glm::quat& turn = glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	// Draw the puzzle with the program in use.
+	void draw(void);
+    };
+
+    // GPU side of a wall of independent 3x3 puzzles, for colormvp style
+    // programs: every cube's 26 instance matrices, with its place on the
+    // wall baked in, packed into one buffer, and one indirect command per
+    // cube pointing at its span through baseInstance. A frame is one
+    // glMultiDrawElementsIndirect however many cubes there are, and one
+    // upload covering the cubes that changed.
+    //
+    // Without GL 4.3 (or its extensions), or with setIndirect(false),
+    // each cube is drawn as its own instanced draw instead.
+    class WallRenderer
+    {
+    private:
+	GLuint vao;
+	GLuint buffers[2];
+	GLuint instanceBuffer;
+	GLuint commandBuffer;
+
+	glslu::Std140Layout cameraLayout;
+	size_t projectionOffset;
+	size_t viewOffset;
+	glslu::UniformBuffer cameraBuffer;
+
+	glslu::Std140Layout paletteLayout;
+	size_t paletteOffset;
+	glslu::UniformBuffer paletteBuffer;
+
+	int count;
+	bool indirect;
+	std::vector<glm::mat4> placements;
+	std::vector<State> renderedStates;
+	std::vector<uint32_t> turningSlots;
+	std::vector<glm::mat4> models;
+	size_t dirtyBegin;
+	size_t dirtyEnd;
+	glslu::RingBuffer* stream;
+
+	// Prevent object copying (declared only; the uniform buffers can't be
+	// default constructed)
+	WallRenderer(const WallRenderer& other);
+	WallRenderer& operator=(const WallRenderer& other);
+
+    public:
+	enum { CAMERA_BINDING = Renderer::CAMERA_BINDING, PALETTE_BINDING = Renderer::PALETTE_BINDING };
+
+	// Needs GL 4.3, or ARB_multi_draw_indirect with ARB_base_instance
+	static bool isIndirectSupported(void);
+
+	// Constructor/Destructor; needs a current GL context. The cubes fill
+	// rows of columns, centered and scaled to a single puzzle's footprint.
+	WallRenderer(int count, int columns);
+	~WallRenderer(void);
+
+	// Status functions
+	int getCount(void) const { return count; }
+	bool isIndirect(void) const { return indirect; }
+	int getDrawCalls(void) const { return indirect ? 1 : count; }
+
+	// Multi-draw-indirect, on by default where supported; off draws the
+	// cubes one instanced call each.
+	void setIndirect(bool indirect);
+
+	// Set the uniforms a colormvp style program needs (model).
+	void setupProgram(glslu::Program& program);
+
+	// Camera, sent with the next draw
+	void setProjection(const glm::mat4& projection);
+	void setView(const glm::mat4& view);
+
+	// Palette entry (a Face, or CORE_COLOR), sent with the next draw
+	void setColor(int index, const glm::vec3& color);
+
+	// Send the uniform blocks and every instance matrix through a ring
+	// buffer; see Renderer. The region needs room for the whole wall
+	// (getCount()*SLOT_COUNT matrices), or the matrices stay in place.
+	void setStream(glslu::RingBuffer* stream);
+
+	// Rebuild one cube's matrices for cubies that moved since its last
+	// update, as Renderer::update; sent with the next draw.
+	void update(int cube, const State& state, Move move = MOVE_NONE, const glm::quat& turn = glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+	// Draw every cube with the program in use.
+	void draw(void);
+    };
+}
+
+#endif
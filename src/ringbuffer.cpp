@@ -0,0 +1,115 @@
+#include "ringbuffer.hpp"
+
+namespace glslu
+{
+    namespace RingBufferInfo {
+	// Region starts are kept on this boundary, which covers the uniform
+	// offset alignment of every implementation about.
+	const size_t REGION_ALIGNMENT = 256;
+    }
+
+    // Core in 4.4, an extension before it. The loader's IsVersionGEQ has
+    // its comparisons backwards, so the version is checked here.
+    bool RingBuffer::isSupported(void)
+    {
+	int major = gl::sys::GetMajorVersion();
+
+	return major > 4 || (major == 4 && gl::sys::GetMinorVersion() >= 4) || gl::sys::HasExtension("GL_ARB_buffer_storage");
+    }
+
+    // Create, and map for good
+    RingBuffer::RingBuffer(size_t regionSize, int regionCount)
+	throw(BufferException):
+	handle(0), mapped(NULL),
+	regionSize((regionSize + RingBufferInfo::REGION_ALIGNMENT - 1) & ~(RingBufferInfo::REGION_ALIGNMENT - 1)),
+	fences(regionCount > 0 ? regionCount : 1, (GLsync)NULL),
+	region(fences.size() - 1), used(0), stalls(0)
+    {
+	const GLbitfield flags = gl::MAP_WRITE_BIT | gl::MAP_PERSISTENT_BIT | gl::MAP_COHERENT_BIT;
+	size_t size = this->regionSize*fences.size();
+
+	if(!isSupported())
+	    throw BufferException("Persistent buffers need OpenGL 4.4 or ARB_buffer_storage.");
+
+	gl::GenBuffers(1, &handle);
+
+	if(handle == 0)
+	    throw BufferException("Could not create ring buffer.");
+
+	// Bound to a target nothing else uses, so no binding is disturbed.
+	gl::BindBuffer(gl::COPY_WRITE_BUFFER, handle);
+	gl::BufferStorage(gl::COPY_WRITE_BUFFER, size, NULL, flags);
+
+	mapped = (unsigned char*)gl::MapBufferRange(gl::COPY_WRITE_BUFFER, 0, size, flags);
+
+	gl::BindBuffer(gl::COPY_WRITE_BUFFER, 0);
+
+	if(mapped == NULL) {
+	    gl::DeleteBuffers(1, &handle);
+	    throw BufferException("Could not map ring buffer.");
+	}
+    }
+
+    // Deconstructor!
+    RingBuffer::~RingBuffer(void)
+    {
+	for(size_t fence = 0; fence < fences.size(); ++fence)
+	    if(fences[fence] != NULL)
+		gl::DeleteSync(fences[fence]);
+
+	// Deleting a buffer unmaps it.
+	gl::DeleteBuffers(1, &handle);
+    }
+
+    // Claim the next region
+    void RingBuffer::beginFrame(void)
+    {
+	region = (region + 1) % fences.size();
+	used = 0;
+
+	GLsync& fence = fences[region];
+
+	if(fence == NULL)
+	    return;
+
+	// Poll first, so only a real wait counts as a stall.
+	if(gl::ClientWaitSync(fence, 0, 0) == gl::TIMEOUT_EXPIRED) {
+	    GLbitfield flags = gl::SYNC_FLUSH_COMMANDS_BIT;
+
+	    ++stalls;
+
+	    while(gl::ClientWaitSync(fence, flags, 1000000000) == gl::TIMEOUT_EXPIRED)
+		flags = 0;
+	}
+
+	gl::DeleteSync(fence);
+	fence = NULL;
+    }
+
+    // Mark the region's readers
+    void RingBuffer::endFrame(void)
+    {
+	if(fences[region] != NULL)
+	    gl::DeleteSync(fences[region]);
+
+	fences[region] = gl::FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    // Bump allocation within the region
+    void* RingBuffer::allocate(size_t length, size_t alignment, size_t& offset)
+    {
+	size_t base = region*regionSize;
+	size_t start = used;
+
+	if(alignment > 1)
+	    start = (base + start + alignment - 1)/alignment*alignment - base;
+
+	if(start + length > regionSize)
+	    return NULL;
+
+	used = start + length;
+	offset = base + start;
+
+	return mapped + offset;
+    }
+}
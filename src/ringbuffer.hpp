@@ -0,0 +1,75 @@
+#ifndef GLSL_UTILITIES_RINGBUFFER
+#define GLSL_UTILITIES_RINGBUFFER
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gl_core_4_4.hpp"
+
+namespace glslu
+{
+    class BufferException: public std::runtime_error
+    {
+    public:
+	BufferException(const std::string &msg): std::runtime_error(msg) {}
+    };
+
+    // Streaming storage for per-frame data: one immutable buffer
+    // (ARB_buffer_storage), mapped persistent and coherent once for its
+    // whole life and split into regions, one per frame in flight. A frame
+    // writes only its own region and fences it at the end; a region is
+    // reused only after its fence signals, which with three regions the
+    // GPU has long since passed. Nothing is ever mapped, reallocated or
+    // orphaned after construction.
+    //
+    // Each frame: beginFrame(), allocate() what it needs and point GL at
+    // getHandle() with the returned offsets, then endFrame() after the
+    // draws that read it.
+    class RingBuffer
+    {
+    private:
+	GLuint handle;
+	unsigned char* mapped;
+	size_t regionSize;
+	std::vector<GLsync> fences;
+	size_t region;
+	size_t used;
+	size_t stalls;
+
+	// Prevent object copying
+	RingBuffer(const RingBuffer& other) {}
+	RingBuffer& operator=(const RingBuffer& other) { return *this; }
+
+    public:
+	// Needs GL 4.4 or ARB_buffer_storage
+	static bool isSupported(void);
+
+	// Constructor/Destructor; regionSize is the most one frame may write.
+	RingBuffer(size_t regionSize, int regionCount = 3) throw (BufferException);
+	~RingBuffer(void);
+
+	// Status functions
+	GLuint getHandle(void) const { return handle; }
+	size_t getRegionSize(void) const { return regionSize; }
+	int getRegionCount(void) const { return (int)fences.size(); }
+	size_t getUsed(void) const { return used; }
+
+	// Frames that found their region still in use and had to wait
+	size_t getStallCount(void) const { return stalls; }
+
+	// Move to the next region, waiting for the GPU only if a draw from
+	// regionCount frames back still reads it.
+	void beginFrame(void);
+
+	// Fence this frame's region behind the commands issued so far.
+	void endFrame(void);
+
+	// Reserve length bytes in this frame's region at a buffer offset
+	// that's a multiple of alignment, and return where to write them;
+	// NULL once the region is full.
+	void* allocate(size_t length, size_t alignment, size_t& offset);
+    };
+}
+
+#endif
@@ -0,0 +1,63 @@
+#version 430
+
+layout (location = 0) in vec3 VertexPosition;
+layout (location = 2) in vec3 VertexNormal;
+layout (location = 3) in uvec3 InstanceCell;
+
+out vec3 color;
+
+#include "camera.glsl"
+
+layout (std140, binding = 1) uniform Puzzle
+{
+	mat4 turn;
+	int size;
+	int turningFrom;
+};
+
+#include "palette.glsl"
+
+// One palette index per sticker; faces without one use the core color (6).
+layout (binding = 0) uniform usamplerBuffer stickers;
+
+// Per face (URFDLB): outward normal, then the net's column and row directions.
+const ivec3 faceAxes[18] = ivec3[18](
+	ivec3( 0,  1,  0), ivec3( 1,  0,  0), ivec3( 0,  0,  1),
+	ivec3( 1,  0,  0), ivec3( 0,  0, -1), ivec3( 0, -1,  0),
+	ivec3( 0,  0,  1), ivec3( 1,  0,  0), ivec3( 0, -1,  0),
+	ivec3( 0, -1,  0), ivec3( 1,  0,  0), ivec3( 0,  0, -1),
+	ivec3(-1,  0,  0), ivec3( 0,  0,  1), ivec3( 0, -1,  0),
+	ivec3( 0,  0, -1), ivec3(-1,  0,  0), ivec3( 0, -1,  0)
+);
+
+// GLSL's dot() is float only.
+int idot(ivec3 a, ivec3 b)
+{
+	return a.x*b.x + a.y*b.y + a.z*b.z;
+}
+
+void main()
+{
+	// Cell center on a doubled grid: -(size-1)..size-1 in steps of two.
+	ivec3 cell = 2*ivec3(InstanceCell) - (size - 1);
+	ivec3 normal = ivec3(round(VertexNormal));
+	uint sticker = 6u;
+
+	for(int face = 0; face < 6; ++face)
+		if(normal == faceAxes[3*face] && idot(cell, normal) == size - 1) {
+			int column = (idot(cell, faceAxes[3*face + 1]) + size - 1)/2;
+			int row = (idot(cell, faceAxes[3*face + 2]) + size - 1)/2;
+
+			sticker = texelFetch(stickers, (face*size + row)*size + column).r;
+		}
+
+	color = palette[sticker];
+
+	// Same spacing as the 3x3, scaled to the same overall size.
+	vec4 position = vec4((3.3/size)*(VertexPosition/1.1 + 0.5*vec3(cell)), 1.0);
+
+	if(gl_InstanceID >= turningFrom)
+		position = turn*position;
+
+	gl_Position = projection*view*position;
+}
@@ -0,0 +1,5 @@
+layout (std140, binding = 0) uniform Camera
+{
+	mat4 projection;
+	mat4 view;
+};
@@ -2,9 +2,9 @@
 
 in vec3 color;
 
-out vec4 gl_FragColor;
+layout (location = 0) out vec4 FragColor;
 
 void main()
 {
-	gl_FragColor = vec4(color, 1.0);
+	FragColor = vec4(color, 1.0);
 }
@@ -2,17 +2,21 @@
 
 layout (location = 0) in vec3 VertexPosition;
 
-layout (location = 1) in vec3 VertexColor;
+layout (location = 1) in uint VertexColor;
+
+layout (location = 3) in mat4 InstanceModel;
 
 out vec3 color;
 
-uniform mat4 projection;
-uniform mat4 view;
+#include "camera.glsl"
+
 uniform mat4 model;
 
+#include "palette.glsl"
+
 void main()
 {
-	color = VertexColor;
+	color = palette[VertexColor];
 
-	gl_Position = projection*view*model*vec4(VertexPosition, 1.0f);
+	gl_Position = projection*view*model*InstanceModel*vec4(VertexPosition, 1.0f);
 }
@@ -4,7 +4,7 @@ in vec3 color;
 in vec3 normal;
 in vec3 light;
 
-out vec4 gl_FragColor;
+layout (location = 0) out vec4 FragColor;
 
 void main()
 {
@@ -19,5 +19,5 @@ void main()
 	else
 		intensity = 0.1f;
 
-	gl_FragColor = vec4(intensity*color, 1.0);
+	FragColor = vec4(intensity*color, 1.0);
 }
@@ -1,8 +1,9 @@
 #version 430
 
 layout (location = 0) in vec3 VertexPosition;
-layout (location = 1) in vec3 VertexColor;
+layout (location = 1) in uint VertexColor;
 layout (location = 2) in vec3 VertexNormal;
+layout (location = 3) in mat4 InstanceModel;
 
 out vec3 color;
 out vec3 normal;
@@ -10,15 +11,17 @@ out vec3 light;
 
 uniform vec3 light_direction;
 
-uniform mat4 projection;
-uniform mat4 view;
+#include "camera.glsl"
+
 uniform mat4 model;
 
+#include "palette.glsl"
+
 void main()
 {
-	color = VertexColor;
+	color = palette[VertexColor];
 	normal = VertexNormal;
 	light = normalize(light_direction);
 
-	gl_Position = projection*view*model*vec4(VertexPosition, 1.0f);
+	gl_Position = projection*view*model*InstanceModel*vec4(VertexPosition, 1.0f);
 }
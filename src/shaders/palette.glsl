@@ -0,0 +1,4 @@
+layout (std140, binding = 2) uniform Palette
+{
+	vec3 palette[7];
+};
@@ -1,8 +1,8 @@
 #version 430
 
-out vec4 gl_FragColor;
+layout (location = 0) out vec4 FragColor;
 
 void main()
 {
-	gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+	FragColor = vec4(1.0, 0.0, 0.0, 1.0);
 }
\ No newline at end of file
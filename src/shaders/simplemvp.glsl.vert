@@ -4,8 +4,8 @@ layout (location = 0) in vec3 VertexPosition;
 
 out vec3 color_position;
 
-uniform mat4 projection;
-uniform mat4 view;
+#include "camera.glsl"
+
 uniform mat4 model;
 
 void main()
@@ -2,9 +2,9 @@
 
 in vec3 color_position;
 
-out vec4 gl_FragColor;
+layout (location = 0) out vec4 FragColor;
 
 void main()
 {
-	gl_FragColor = vec4(color_position.x + 0.5, color_position.y + 0.5, color_position.z + 0.5, 1.0);
+	FragColor = vec4(color_position.x + 0.5, color_position.y + 0.5, color_position.z + 0.5, 1.0);
 }
@@ -0,0 +1,242 @@
+#include "shaderwatcher.hpp"
+
+#include <algorithm>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using std::endl;
+using std::ostream;
+using std::string;
+using std::vector;
+
+namespace glslu
+{
+    namespace WatcherInfo {
+	// Split "dir/name" into its directory ("." if none) and name.
+	void splitPath(const string& path, string& directory, string& name)
+	{
+	    size_t slash = path.find_last_of("/\\");
+
+	    if(slash == string::npos) {
+		directory = ".";
+		name = path;
+	    } else {
+		directory = path.substr(0, slash);
+		name = path.substr(slash + 1);
+	    }
+	}
+
+	long long getModifiedTime(const string& path)
+	{
+	    struct stat info;
+
+	    if(stat(path.c_str(), &info) != 0)
+		return -1;
+
+	    return (long long)info.st_mtime;
+	}
+    }
+
+    // Constructor
+    ShaderWatcher::ShaderWatcher(void):
+	descriptor(-1)
+    {
+#ifdef __linux__
+	descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    // Deconstructor!
+    ShaderWatcher::~ShaderWatcher(void)
+    {
+	for(size_t entry = 0; entry < entries.size(); ++entry)
+	    dropRebuild(entries[entry]);
+
+#ifdef __linux__
+	if(descriptor >= 0)
+	    close(descriptor);
+#endif
+    }
+
+    // Register a program's files
+    void ShaderWatcher::watch(Program& program)
+    {
+	Entry entry;
+
+	entry.program = &program;
+	entry.shadow = NULL;
+	entry.queue = NULL;
+	entry.changed = false;
+
+	collectPaths(entry);
+	entries.push_back(entry);
+    }
+
+    // Gather a program's files with everything they include
+    void ShaderWatcher::collectPaths(Entry& entry)
+    {
+	const vector<ShaderFile>& files = entry.program->getShaderFiles();
+
+	entry.paths.clear();
+	entry.modified.clear();
+
+	for(size_t file = 0; file < files.size(); ++file) {
+	    ShaderSource source;
+
+	    try {
+		SourceCache::getInstance().load(files[file].filename, source);
+	    } catch(ProgramException& exception) {
+		source.files.assign(1, SourceCache::normalizePath(files[file].filename));
+	    }
+
+	    for(size_t path = 0; path < source.files.size(); ++path)
+		if(std::find(entry.paths.begin(), entry.paths.end(), source.files[path]) == entry.paths.end()) {
+		    entry.paths.push_back(source.files[path]);
+		    entry.modified.push_back(WatcherInfo::getModifiedTime(source.files[path]));
+		}
+	}
+
+#ifdef __linux__
+	// Watch directories, not files: editors often save by renaming a new
+	// file over the old one, which would orphan a file watch. Adding a
+	// directory twice just returns its existing watch.
+	if(descriptor >= 0)
+	    for(size_t path = 0; path < entry.paths.size(); ++path) {
+		string directory, name;
+
+		WatcherInfo::splitPath(entry.paths[path], directory, name);
+
+		int watch = inotify_add_watch(descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+		if(watch >= 0)
+		    directories[watch] = directory;
+	    }
+#endif
+    }
+
+    // Drain pending inotify events
+    void ShaderWatcher::readEvents(void)
+    {
+#ifdef __linux__
+	char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	ssize_t length;
+
+	while((length = read(descriptor, buffer, sizeof(buffer))) > 0) {
+	    for(char* position = buffer; position < buffer + length;) {
+		const struct inotify_event* event = (const struct inotify_event*)position;
+
+		position += sizeof(struct inotify_event) + event->len;
+
+		if(event->len == 0 || directories.find(event->wd) == directories.end())
+		    continue;
+
+		string path = directories[event->wd] + "/" + event->name;
+
+		SourceCache::getInstance().invalidate(path);
+
+		for(size_t entry = 0; entry < entries.size(); ++entry)
+		    for(size_t file = 0; file < entries[entry].paths.size(); ++file)
+			if(entries[entry].paths[file] == path)
+			    entries[entry].changed = true;
+	    }
+	}
+#endif
+    }
+
+    // Compare modification times
+    void ShaderWatcher::checkTimes(void)
+    {
+	for(size_t entry = 0; entry < entries.size(); ++entry)
+	    for(size_t file = 0; file < entries[entry].paths.size(); ++file) {
+		long long modified = WatcherInfo::getModifiedTime(entries[entry].paths[file]);
+
+		if(modified != entries[entry].modified[file]) {
+		    entries[entry].modified[file] = modified;
+		    entries[entry].changed = true;
+		}
+	    }
+    }
+
+    // Submit a shadow build of the entry's files
+    void ShaderWatcher::startRebuild(Entry& entry, ostream* log)
+    {
+	const vector<ShaderFile>& files = entry.program->getShaderFiles();
+
+	entry.changed = false;
+	entry.shadow = new Program();
+	entry.queue = new CompileQueue();
+
+	try {
+	    for(size_t file = 0; file < files.size(); ++file)
+		entry.queue->addFile(*entry.shadow, files[file].filename, files[file].type);
+	} catch(ProgramException& exception) {
+	    if(log)
+		*log << "Shader reload failed, keeping the running program:" << endl << exception.what() << endl;
+
+	    dropRebuild(entry);
+	}
+    }
+
+    // Discard a shadow build
+    void ShaderWatcher::dropRebuild(Entry& entry)
+    {
+	delete entry.queue;
+	delete entry.shadow;
+
+	entry.queue = NULL;
+	entry.shadow = NULL;
+    }
+
+    // Per-frame update
+    int ShaderWatcher::poll(ostream* log)
+    {
+	int swapped = 0;
+
+	if(descriptor >= 0)
+	    readEvents();
+	else
+	    checkTimes();
+
+	for(size_t index = 0; index < entries.size(); ++index) {
+	    Entry& entry = entries[index];
+
+	    if(entry.shadow == NULL) {
+		if(entry.changed)
+		    startRebuild(entry, log);
+
+		continue;
+	    }
+
+	    try {
+		// Leave it for a later frame while the driver is still
+		// compiling or linking, so finish() doesn't wait on it.
+		if(!entry.queue->isComplete())
+		    continue;
+
+		entry.queue->finish();
+		entry.program->swap(*entry.shadow);
+		++swapped;
+
+		// The edit may have added or dropped includes.
+		collectPaths(entry);
+
+		if(log)
+		    *log << "Reloaded Program[" << entry.program->getHandle() << "]" << endl;
+	    } catch(ProgramException& exception) {
+		if(log)
+		    *log << "Shader reload failed, keeping the running program:" << endl << exception.what() << endl;
+	    }
+
+	    // The shadow now holds the old program (or the failed one).
+	    dropRebuild(entry);
+	}
+
+	return swapped;
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef GLSL_UTILITIES_SHADER_WATCHER
+#define GLSL_UTILITIES_SHADER_WATCHER
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "glslu.hpp"
+
+namespace glslu
+{
+    // Watches the shader files of registered programs and rebuilds a
+    // program into a shadow copy when one changes. The shadow compiles
+    // through a CompileQueue across frames and is swapped in only once it
+    // links; on failure the running program is left untouched.
+    //
+    // Uses inotify on Linux, and polls modification times elsewhere.
+    class ShaderWatcher
+    {
+    private:
+	struct Entry
+	{
+	    Program* program;
+	    std::vector<std::string> paths;
+	    std::vector<long long> modified;
+	    Program* shadow;
+	    CompileQueue* queue;
+	    bool changed;
+	};
+	
+	int descriptor;
+	std::map<int, std::string> directories;
+	std::vector<Entry> entries;
+	
+	void collectPaths(Entry& entry);
+	void readEvents(void);
+	void checkTimes(void);
+	void startRebuild(Entry& entry, std::ostream* log);
+	void dropRebuild(Entry& entry);
+	
+	// Prevent object copying
+	ShaderWatcher(const ShaderWatcher& other) {}
+	ShaderWatcher& operator=(const ShaderWatcher& other) { return *this; }
+	
+    public:
+	// Constructor/Destructor
+	ShaderWatcher(void);
+	~ShaderWatcher(void);
+	
+	// Watch every file program was built from, and the files they include.
+	void watch(Program& program);
+	
+	// Call once per frame. Starts rebuilds for changed files, finishes the
+	// ones the driver is done with, and returns how many programs were
+	// swapped. Compile errors go to log.
+	//
+	// A swapped program is a new GL program with default uniform values
+	// and its own locations, so when this returns > 0 set the uniforms
+	// again and re-resolve every Uniform handle from getUniform(); old
+	// handles would write to whatever uniform now has that location.
+	int poll(std::ostream* log = NULL);
+	
+	// Status
+	bool isNotifying(void) const { return descriptor >= 0; }
+    };
+}
+
+#endif
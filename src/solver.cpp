@@ -0,0 +1,648 @@
+#include "solver.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using std::ios;
+using std::ofstream;
+using std::string;
+using std::stringstream;
+using std::vector;
+
+namespace cube
+{
+    namespace SolverInfo {
+	const Move phase2Moves[PHASE2_MOVE_COUNT] = {U1, U2, U3, D1, D2, D3, R2, L2, F2, B2};
+
+	// Nodes spent looking for something shorter after the first solution
+	const uint64_t IMPROVE_NODES = 150000;
+
+	// Table file layout: header, then each section aligned to 64 bytes.
+	enum
+	{
+	    TWIST_MOVE, FLIP_MOVE, SLICE_MOVE, CORNER_PERMUTATION_MOVE, EDGE8_PERMUTATION_MOVE, SLICE_PERMUTATION_MOVE,
+	    SLICE_TWIST_PRUNE, SLICE_FLIP_PRUNE, SLICE_CORNER_PRUNE, SLICE_EDGE_PRUNE,
+	    SECTION_COUNT
+	};
+
+	const size_t sectionSizes[SECTION_COUNT] = {
+	    TWIST_COUNT*MOVE_COUNT*sizeof(uint16_t),
+	    FLIP_COUNT*MOVE_COUNT*sizeof(uint16_t),
+	    SLICE_COUNT*MOVE_COUNT*sizeof(uint16_t),
+	    CORNER_PERMUTATION_COUNT*MOVE_COUNT*sizeof(uint16_t),
+	    EDGE8_PERMUTATION_COUNT*PHASE2_MOVE_COUNT*sizeof(uint16_t),
+	    SLICE_PERMUTATION_COUNT*PHASE2_MOVE_COUNT,
+	    SLICE_COUNT*TWIST_COUNT,
+	    SLICE_COUNT*FLIP_COUNT,
+	    SLICE_PERMUTATION_COUNT*CORNER_PERMUTATION_COUNT,
+	    SLICE_PERMUTATION_COUNT*EDGE8_PERMUTATION_COUNT
+	};
+
+	struct TableHeader
+	{
+	    char magic[8];
+	    uint32_t version;
+	    uint32_t sectionCount;
+	    uint64_t fileSize;
+	    uint64_t offsets[SECTION_COUNT];
+	};
+
+	const char tableMagic[8] = {'C', 'U', 'B', 'E', 'T', 'B', 'L', '\0'};
+
+	// Fill in section offsets, returning the total file size.
+	uint64_t layoutHeader(TableHeader& header)
+	{
+	    uint64_t offset = (sizeof(TableHeader) + 63) & ~(uint64_t)63;
+
+	    memset(&header, 0, sizeof(header));
+	    memcpy(header.magic, tableMagic, sizeof(header.magic));
+	    header.version = SolverTables::VERSION;
+	    header.sectionCount = SECTION_COUNT;
+
+	    for(int section = 0; section < SECTION_COUNT; ++section) {
+		header.offsets[section] = offset;
+		offset = (offset + sectionSizes[section] + 63) & ~(uint64_t)63;
+	    }
+
+	    header.fileSize = offset;
+
+	    return offset;
+	}
+
+	// Binomial coefficients up to C(12, 4)
+	int choose(int n, int k)
+	{
+	    if(k > n) return 0;
+
+	    int result = 1;
+
+	    for(int i = 0; i < k; ++i)
+		result = result*(n - i)/(i + 1);
+
+	    return result;
+	}
+
+	// Lehmer code of a sequence of distinct values
+	int rankPermutation(const uint8_t* values, int count)
+	{
+	    int rank = 0;
+
+	    for(int i = 0; i < count; ++i) {
+		int smaller = 0;
+
+		for(int j = i + 1; j < count; ++j)
+		    if(values[j] < values[i])
+			++smaller;
+
+		rank = rank*(count - i) + smaller;
+	    }
+
+	    return rank;
+	}
+
+	// Inverse of rankPermutation over 0 .. count-1
+	void unrankPermutation(int rank, uint8_t* values, int count)
+	{
+	    int digits[12];
+	    uint8_t available[12];
+
+	    for(int i = count - 1; i >= 0; --i) {
+		digits[i] = rank % (count - i);
+		rank /= count - i;
+	    }
+
+	    for(int i = 0; i < count; ++i)
+		available[i] = (uint8_t)i;
+
+	    for(int i = 0; i < count; ++i) {
+		values[i] = available[digits[i]];
+
+		for(int j = digits[i]; j < count - i - 1; ++j)
+		    available[j] = available[j + 1];
+	    }
+	}
+
+	// Representative states for each coordinate, everything else solved.
+	struct Cubie
+	{
+	    uint8_t cp[CORNER_COUNT], co[CORNER_COUNT], ep[EDGE_COUNT], eo[EDGE_COUNT];
+
+	    Cubie(void)
+	    {
+		for(int i = 0; i < CORNER_COUNT; ++i) { cp[i] = (uint8_t)i; co[i] = 0; }
+		for(int i = 0; i < EDGE_COUNT; ++i) { ep[i] = (uint8_t)i; eo[i] = 0; }
+	    }
+
+	    State toState(void) const { return State(cp, co, ep, eo); }
+	};
+
+	State fromTwist(int twist)
+	{
+	    Cubie cubie;
+	    int sum = 0;
+
+	    for(int i = CORNER_COUNT - 2; i >= 0; --i) {
+		cubie.co[i] = (uint8_t)(twist % 3);
+		sum += twist % 3;
+		twist /= 3;
+	    }
+
+	    cubie.co[CORNER_COUNT - 1] = (uint8_t)((3 - sum % 3) % 3);
+
+	    return cubie.toState();
+	}
+
+	State fromFlip(int flip)
+	{
+	    Cubie cubie;
+	    int sum = 0;
+
+	    for(int i = EDGE_COUNT - 2; i >= 0; --i) {
+		cubie.eo[i] = (uint8_t)(flip & 1);
+		sum += flip & 1;
+		flip >>= 1;
+	    }
+
+	    cubie.eo[EDGE_COUNT - 1] = (uint8_t)(sum & 1);
+
+	    return cubie.toState();
+	}
+
+	State fromSlice(int slice)
+	{
+	    Cubie cubie;
+	    bool occupied[EDGE_COUNT] = {false};
+
+	    // Combinatorial number system, largest position first.
+	    for(int k = 3; k >= 0; --k) {
+		int position = k;
+
+		while(choose(position + 1, k + 1) <= slice)
+		    ++position;
+
+		slice -= choose(position, k + 1);
+		cubie.ep[position] = (uint8_t)(FR + k);
+		occupied[position] = true;
+	    }
+
+	    for(int position = 0, edge = 0; position < EDGE_COUNT; ++position)
+		if(!occupied[position])
+		    cubie.ep[position] = (uint8_t)(edge++);
+
+	    return cubie.toState();
+	}
+
+	State fromCornerPermutation(int permutation)
+	{
+	    Cubie cubie;
+
+	    unrankPermutation(permutation, cubie.cp, CORNER_COUNT);
+
+	    return cubie.toState();
+	}
+
+	State fromEdge8Permutation(int permutation)
+	{
+	    Cubie cubie;
+
+	    unrankPermutation(permutation, cubie.ep, 8);
+
+	    return cubie.toState();
+	}
+
+	State fromSlicePermutation(int permutation)
+	{
+	    Cubie cubie;
+
+	    unrankPermutation(permutation, cubie.ep + 8, 4);
+
+	    for(int i = 8; i < EDGE_COUNT; ++i)
+		cubie.ep[i] += 8;
+
+	    return cubie.toState();
+	}
+
+	// Build a move table by moving a representative of every coordinate.
+	template<typename T>
+	void fillMoveTable(T* table, int coordinateCount, State (*represent)(int), int (*measure)(const State&),
+			   const Move* moves, int moveCount)
+	{
+	    for(int coordinate = 0; coordinate < coordinateCount; ++coordinate) {
+		State representative = represent(coordinate);
+
+		for(int move = 0; move < moveCount; ++move) {
+		    State moved = representative;
+		    moved.apply(moves[move]);
+
+		    table[coordinate*moveCount + move] = (T)measure(moved);
+		}
+	    }
+	}
+
+	// Breadth-first distances from the goal over a product coordinate.
+	template<typename Step>
+	void fillPruneTable(uint8_t* table, size_t size, size_t goal, int moveCount, Step step)
+	{
+	    memset(table, 0xFF, size);
+	    table[goal] = 0;
+
+	    size_t filled = 1;
+
+	    for(int depth = 0; filled < size; ++depth) {
+		size_t found = 0;
+
+		for(size_t index = 0; index < size; ++index) {
+		    if(table[index] != depth)
+			continue;
+
+		    for(int move = 0; move < moveCount; ++move) {
+			size_t next = step(index, move);
+
+			if(table[next] == 0xFF) {
+			    table[next] = (uint8_t)(depth + 1);
+			    ++found;
+			}
+		    }
+		}
+
+		if(found == 0) break;
+
+		filled += found;
+	    }
+	}
+
+	inline int max(int a, int b) { return a > b ? a : b; }
+    }
+
+    // Corner twist, base 3 over the first seven corners
+    int getTwist(const State& state)
+    {
+	int twist = 0;
+
+	for(int slot = 0; slot < CORNER_COUNT - 1; ++slot)
+	    twist = 3*twist + state.getCornerTwist(slot);
+
+	return twist;
+    }
+
+    // Edge flip, base 2 over the first eleven edges
+    int getFlip(const State& state)
+    {
+	int flip = 0;
+
+	for(int slot = 0; slot < EDGE_COUNT - 1; ++slot)
+	    flip = 2*flip + state.getEdgeFlip(slot);
+
+	return flip;
+    }
+
+    // Positions of the FR, FL, BL, BR edges as a combination index
+    int getSlice(const State& state)
+    {
+	int slice = 0;
+
+	for(int slot = 0, k = 0; slot < EDGE_COUNT; ++slot)
+	    if(state.getEdge(slot) >= FR)
+		slice += SolverInfo::choose(slot, ++k);
+
+	return slice;
+    }
+
+    // Corner permutation rank
+    int getCornerPermutation(const State& state)
+    {
+	uint8_t corners[CORNER_COUNT];
+
+	for(int slot = 0; slot < CORNER_COUNT; ++slot)
+	    corners[slot] = (uint8_t)state.getCorner(slot);
+
+	return SolverInfo::rankPermutation(corners, CORNER_COUNT);
+    }
+
+    // U/D edge permutation rank, only meaningful inside phase 2
+    int getEdge8Permutation(const State& state)
+    {
+	uint8_t edges[8];
+
+	for(int slot = 0; slot < 8; ++slot)
+	    edges[slot] = (uint8_t)state.getEdge(slot);
+
+	return SolverInfo::rankPermutation(edges, 8);
+    }
+
+    // UD-slice edge permutation rank, only meaningful inside phase 2
+    int getSlicePermutation(const State& state)
+    {
+	uint8_t edges[4];
+
+	for(int slot = 0; slot < 4; ++slot)
+	    edges[slot] = (uint8_t)state.getEdge(FR + slot);
+
+	return SolverInfo::rankPermutation(edges, 4);
+    }
+
+    // Phase 2 move accessor
+    Move getPhase2Move(int index)
+    {
+	return SolverInfo::phase2Moves[index];
+    }
+
+    // Map existing tables or build them
+    SolverTables::SolverTables(const string& filename)
+	throw(CubeException)
+    {
+	if(map(filename)) return;
+
+	generate(filename);
+
+	if(!map(filename)) {
+	    stringstream buffer;
+
+	    buffer << "Could not map solver tables \"" << filename << "\" after generating them.";
+
+	    throw CubeException(buffer.str());
+	}
+    }
+
+    // Map the table file, failing on any header mismatch
+    bool SolverTables::map(const string& filename)
+    {
+	SolverInfo::TableHeader expected;
+	uint64_t size = SolverInfo::layoutHeader(expected);
+
+	try {
+	    file.open(filename);
+	} catch(sysu::SystemException&) {
+	    return false;
+	}
+
+	if(file.size() != size || memcmp(file.data(), &expected, sizeof(expected)) != 0) {
+	    file.close();
+
+	    return false;
+	}
+
+	const char* base = file.data();
+
+	twistMove = (const uint16_t*)(base + expected.offsets[SolverInfo::TWIST_MOVE]);
+	flipMove = (const uint16_t*)(base + expected.offsets[SolverInfo::FLIP_MOVE]);
+	sliceMove = (const uint16_t*)(base + expected.offsets[SolverInfo::SLICE_MOVE]);
+	cornerPermutationMove = (const uint16_t*)(base + expected.offsets[SolverInfo::CORNER_PERMUTATION_MOVE]);
+	edge8PermutationMove = (const uint16_t*)(base + expected.offsets[SolverInfo::EDGE8_PERMUTATION_MOVE]);
+	slicePermutationMove = (const uint8_t*)(base + expected.offsets[SolverInfo::SLICE_PERMUTATION_MOVE]);
+	sliceTwistPrune = (const uint8_t*)(base + expected.offsets[SolverInfo::SLICE_TWIST_PRUNE]);
+	sliceFlipPrune = (const uint8_t*)(base + expected.offsets[SolverInfo::SLICE_FLIP_PRUNE]);
+	sliceCornerPrune = (const uint8_t*)(base + expected.offsets[SolverInfo::SLICE_CORNER_PRUNE]);
+	sliceEdgePrune = (const uint8_t*)(base + expected.offsets[SolverInfo::SLICE_EDGE_PRUNE]);
+
+	return true;
+    }
+
+    // Build all tables and write them out
+    void SolverTables::generate(const string& filename)
+	throw(CubeException)
+    {
+	using namespace SolverInfo;
+
+	TableHeader header;
+	vector<char> image(layoutHeader(header));
+	char* base = &image[0];
+
+	memcpy(base, &header, sizeof(header));
+
+	uint16_t* twistTable = (uint16_t*)(base + header.offsets[TWIST_MOVE]);
+	uint16_t* flipTable = (uint16_t*)(base + header.offsets[FLIP_MOVE]);
+	uint16_t* sliceTable = (uint16_t*)(base + header.offsets[SLICE_MOVE]);
+	uint16_t* cornerTable = (uint16_t*)(base + header.offsets[CORNER_PERMUTATION_MOVE]);
+	uint16_t* edgeTable = (uint16_t*)(base + header.offsets[EDGE8_PERMUTATION_MOVE]);
+	uint8_t* slicePermutationTable = (uint8_t*)(base + header.offsets[SLICE_PERMUTATION_MOVE]);
+	Move allMoves[MOVE_COUNT];
+
+	for(int move = 0; move < MOVE_COUNT; ++move)
+	    allMoves[move] = (Move)move;
+
+	// Move tables
+	fillMoveTable(twistTable, TWIST_COUNT, fromTwist, getTwist, allMoves, MOVE_COUNT);
+	fillMoveTable(flipTable, FLIP_COUNT, fromFlip, getFlip, allMoves, MOVE_COUNT);
+	fillMoveTable(sliceTable, SLICE_COUNT, fromSlice, getSlice, allMoves, MOVE_COUNT);
+	fillMoveTable(cornerTable, CORNER_PERMUTATION_COUNT, fromCornerPermutation, getCornerPermutation, allMoves, MOVE_COUNT);
+	fillMoveTable(edgeTable, EDGE8_PERMUTATION_COUNT, fromEdge8Permutation, getEdge8Permutation, phase2Moves, PHASE2_MOVE_COUNT);
+	fillMoveTable(slicePermutationTable, SLICE_PERMUTATION_COUNT, fromSlicePermutation, getSlicePermutation, phase2Moves, PHASE2_MOVE_COUNT);
+
+	// Phase 1 pruning, distance to twist = flip = 0 with the slice edges home.
+	fillPruneTable((uint8_t*)(base + header.offsets[SLICE_TWIST_PRUNE]), SLICE_COUNT*TWIST_COUNT,
+		       SOLVED_SLICE*TWIST_COUNT, MOVE_COUNT,
+		       [=](size_t index, int move) -> size_t {
+			   return sliceTable[(index/TWIST_COUNT)*MOVE_COUNT + move]*TWIST_COUNT
+			       + twistTable[(index % TWIST_COUNT)*MOVE_COUNT + move]; });
+
+	fillPruneTable((uint8_t*)(base + header.offsets[SLICE_FLIP_PRUNE]), SLICE_COUNT*FLIP_COUNT,
+		       SOLVED_SLICE*FLIP_COUNT, MOVE_COUNT,
+		       [=](size_t index, int move) -> size_t {
+			   return sliceTable[(index/FLIP_COUNT)*MOVE_COUNT + move]*FLIP_COUNT
+			       + flipTable[(index % FLIP_COUNT)*MOVE_COUNT + move]; });
+
+	// Phase 2 pruning, distance to solved using phase 2 moves only.
+	fillPruneTable((uint8_t*)(base + header.offsets[SLICE_CORNER_PRUNE]), SLICE_PERMUTATION_COUNT*CORNER_PERMUTATION_COUNT,
+		       0, PHASE2_MOVE_COUNT,
+		       [=](size_t index, int move) -> size_t {
+			   return slicePermutationTable[(index/CORNER_PERMUTATION_COUNT)*PHASE2_MOVE_COUNT + move]*CORNER_PERMUTATION_COUNT
+			       + cornerTable[(index % CORNER_PERMUTATION_COUNT)*MOVE_COUNT + phase2Moves[move]]; });
+
+	fillPruneTable((uint8_t*)(base + header.offsets[SLICE_EDGE_PRUNE]), SLICE_PERMUTATION_COUNT*EDGE8_PERMUTATION_COUNT,
+		       0, PHASE2_MOVE_COUNT,
+		       [=](size_t index, int move) -> size_t {
+			   return slicePermutationTable[(index/EDGE8_PERMUTATION_COUNT)*PHASE2_MOVE_COUNT + move]*EDGE8_PERMUTATION_COUNT
+			       + edgeTable[(index % EDGE8_PERMUTATION_COUNT)*PHASE2_MOVE_COUNT + move]; });
+
+	// Write beside the target and swap it in whole; see sysu::replaceFile.
+	string temporary = filename + ".tmp";
+	ofstream output(temporary.c_str(), ios::out | ios::binary | ios::trunc);
+
+	output.write(base, image.size());
+	output.close();
+
+	if(!output) {
+	    stringstream buffer;
+
+	    remove(temporary.c_str());
+	    buffer << "Could not write solver tables to \"" << temporary << "\".";
+
+	    throw CubeException(buffer.str());
+	}
+
+	if(!sysu::replaceFile(temporary, filename)) {
+	    stringstream buffer;
+
+	    buffer << "Could not move solver tables into \"" << filename << "\".";
+
+	    throw CubeException(buffer.str());
+	}
+    }
+
+    // Constructor
+    Solver::Solver(const SolverTables& tables):
+	tables(tables), maxLength(0), phase1Length(0), nodes(0), nodeLimit(0) {}
+
+    // Solve, iterating the phase 1 length upwards, then again below each
+    // solution found until the budget runs out
+    vector<Move> Solver::solve(const State& state, int maxLength)
+	throw(CubeException)
+    {
+	if(!state.isValid())
+	    throw CubeException("Cube state is not solvable!");
+
+	int twist = getTwist(state);
+	int flip = getFlip(state);
+	int slice = getSlice(state);
+	int bound = SolverInfo::max(tables.sliceTwistPrune[slice*TWIST_COUNT + twist],
+				    tables.sliceFlipPrune[slice*FLIP_COUNT + flip]);
+
+	this->start = state;
+	this->maxLength = maxLength;
+	this->nodes = 0;
+	this->nodeLimit = UINT64_MAX;
+
+	vector<Move> best;
+	bool solved = false;
+
+	// The first solution often pairs a short phase 1 with a long phase 2,
+	// where a slightly longer phase 1 gives a much shorter whole.
+	for(bool found = true; found;) {
+	    found = false;
+	    path.clear();
+
+	    for(int depth = bound; depth <= this->maxLength && !found; ++depth)
+		found = searchPhase1(twist, flip, slice, 0, depth, -1);
+
+	    if(found) {
+		best = path;
+		solved = true;
+		this->maxLength = (int)best.size() - 1;
+
+		if(nodeLimit == UINT64_MAX)
+		    nodeLimit = nodes + SolverInfo::IMPROVE_NODES;
+	    }
+	}
+
+	if(solved)
+	    return best;
+
+	stringstream buffer;
+
+	buffer << "No solution within " << maxLength << " moves.";
+
+	throw CubeException(buffer.str());
+    }
+
+    // Phase 1 IDA*, reaching <U, D, R2, L2, F2, B2> in exactly togo moves
+    bool Solver::searchPhase1(int twist, int flip, int slice, int depth, int togo, int lastFace)
+    {
+	if(++nodes > nodeLimit)
+	    return false;
+
+	if(togo == 0) {
+	    // Ending on a phase 2 move means a shorter phase 1 already covered this.
+	    if(depth > 0) {
+		Move last = path.back();
+
+		if(getMoveFace(last) == FACE_U || getMoveFace(last) == FACE_D || last % 3 == 1)
+		    return false;
+	    }
+
+	    phase1Length = depth;
+
+	    return startPhase2();
+	}
+
+	for(int move = 0; move < MOVE_COUNT; ++move) {
+	    int face = move/3;
+
+	    // Skip same-face repeats and one order of commuting opposite faces.
+	    if(face == lastFace || (lastFace >= 0 && face % 3 == lastFace % 3 && face < lastFace))
+		continue;
+
+	    int nextTwist = tables.twistMove[twist*MOVE_COUNT + move];
+	    int nextFlip = tables.flipMove[flip*MOVE_COUNT + move];
+	    int nextSlice = tables.sliceMove[slice*MOVE_COUNT + move];
+	    int distance = SolverInfo::max(tables.sliceTwistPrune[nextSlice*TWIST_COUNT + nextTwist],
+					   tables.sliceFlipPrune[nextSlice*FLIP_COUNT + nextFlip]);
+
+	    if(distance >= togo)
+		continue;
+
+	    path.push_back((Move)move);
+
+	    if(searchPhase1(nextTwist, nextFlip, nextSlice, depth + 1, togo - 1, face))
+		return true;
+
+	    path.pop_back();
+	}
+
+	return false;
+    }
+
+    // Set up phase 2 from the end of a phase 1 solution
+    bool Solver::startPhase2(void)
+    {
+	State state = start;
+	state.apply(path);
+
+	int cornerPermutation = getCornerPermutation(state);
+	int edge8Permutation = getEdge8Permutation(state);
+	int slicePermutation = getSlicePermutation(state);
+	int lastFace = path.empty() ? -1 : getMoveFace(path.back());
+	int limit = maxLength - phase1Length;
+	int bound = SolverInfo::max(tables.sliceCornerPrune[slicePermutation*CORNER_PERMUTATION_COUNT + cornerPermutation],
+				    tables.sliceEdgePrune[slicePermutation*EDGE8_PERMUTATION_COUNT + edge8Permutation]);
+
+	// No phase 2 position is more than 18 moves from solved.
+	if(limit > 18)
+	    limit = 18;
+
+	for(int depth = bound; depth <= limit; ++depth)
+	    if(searchPhase2(cornerPermutation, edge8Permutation, slicePermutation, phase1Length, depth, lastFace))
+		return true;
+
+	return false;
+    }
+
+    // Phase 2 IDA*, solving in exactly togo moves
+    bool Solver::searchPhase2(int cornerPermutation, int edge8Permutation, int slicePermutation, int depth, int togo, int lastFace)
+    {
+	if(++nodes > nodeLimit)
+	    return false;
+
+	if(togo == 0)
+	    return cornerPermutation == 0 && edge8Permutation == 0 && slicePermutation == 0;
+
+	for(int index = 0; index < PHASE2_MOVE_COUNT; ++index) {
+	    Move move = SolverInfo::phase2Moves[index];
+	    int face = getMoveFace(move);
+
+	    if(face == lastFace || (lastFace >= 0 && face % 3 == lastFace % 3 && face < lastFace))
+		continue;
+
+	    int nextCorners = tables.cornerPermutationMove[cornerPermutation*MOVE_COUNT + move];
+	    int nextEdges = tables.edge8PermutationMove[edge8Permutation*PHASE2_MOVE_COUNT + index];
+	    int nextSlice = tables.slicePermutationMove[slicePermutation*PHASE2_MOVE_COUNT + index];
+	    int distance = SolverInfo::max(tables.sliceCornerPrune[nextSlice*CORNER_PERMUTATION_COUNT + nextCorners],
+					   tables.sliceEdgePrune[nextSlice*EDGE8_PERMUTATION_COUNT + nextEdges]);
+
+	    if(distance >= togo)
+		continue;
+
+	    path.push_back(move);
+
+	    if(searchPhase2(nextCorners, nextEdges, nextSlice, depth + 1, togo - 1, face))
+		return true;
+
+	    path.pop_back();
+	}
+
+	return false;
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef CUBE_SOLVER
+#define CUBE_SOLVER
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "cube.hpp"
+#include "mappedfile.hpp"
+
+namespace cube
+{
+    // Coordinate sizes for the two-phase search.
+    enum
+    {
+	TWIST_COUNT = 2187,                // 3^7 corner twists
+	FLIP_COUNT = 2048,                 // 2^11 edge flips
+	SLICE_COUNT = 495,                 // C(12,4) positions of the UD-slice edges
+	CORNER_PERMUTATION_COUNT = 40320,  // 8! corner permutations
+	EDGE8_PERMUTATION_COUNT = 40320,   // 8! U/D edge permutations (phase 2)
+	SLICE_PERMUTATION_COUNT = 24,      // 4! UD-slice permutations (phase 2)
+	PHASE2_MOVE_COUNT = 10,            // U, D and half turns of R, F, L, B
+	SOLVED_SLICE = 494
+    };
+
+    // Coordinates of a state
+    int getTwist(const State& state);
+    int getFlip(const State& state);
+    int getSlice(const State& state);
+    int getCornerPermutation(const State& state);
+    int getEdge8Permutation(const State& state);
+    int getSlicePermutation(const State& state);
+
+    // Phase 2 move set, indexed 0 .. PHASE2_MOVE_COUNT-1.
+    Move getPhase2Move(int index);
+
+    // Move and pruning tables, generated once into a versioned file and
+    // memory-mapped afterwards.
+    class SolverTables
+    {
+    private:
+	sysu::MappedFile file;
+
+	// Prevent object copying
+	SolverTables(const SolverTables& other) {}
+	SolverTables& operator=(const SolverTables& other) { return *this; }
+
+	bool map(const std::string& filename);
+
+    public:
+	enum { VERSION = 1 };
+
+	// Move tables, [coordinate][move]
+	const uint16_t* twistMove;              // TWIST_COUNT x MOVE_COUNT
+	const uint16_t* flipMove;               // FLIP_COUNT x MOVE_COUNT
+	const uint16_t* sliceMove;              // SLICE_COUNT x MOVE_COUNT
+	const uint16_t* cornerPermutationMove;  // CORNER_PERMUTATION_COUNT x MOVE_COUNT
+	const uint16_t* edge8PermutationMove;   // EDGE8_PERMUTATION_COUNT x PHASE2_MOVE_COUNT
+	const uint8_t* slicePermutationMove;    // SLICE_PERMUTATION_COUNT x PHASE2_MOVE_COUNT
+
+	// Pruning tables, distance to the phase goal
+	const uint8_t* sliceTwistPrune;         // [slice*TWIST_COUNT + twist]
+	const uint8_t* sliceFlipPrune;          // [slice*FLIP_COUNT + flip]
+	const uint8_t* sliceCornerPrune;        // [slicePermutation*CORNER_PERMUTATION_COUNT + cornerPermutation]
+	const uint8_t* sliceEdgePrune;          // [slicePermutation*EDGE8_PERMUTATION_COUNT + edge8Permutation]
+
+	// Map the table file, generating and writing it first if it is
+	// missing or from another version.
+	SolverTables(const std::string& filename) throw (CubeException);
+
+	// Build the tables and write them to a file.
+	static void generate(const std::string& filename) throw (CubeException);
+    };
+
+    // Kociemba two-phase solver: reduce to <U, D, R2, L2, F2, B2>, then solve
+    // within it. After the first solution within the length limit, it keeps
+    // searching below that length for a fixed node budget and returns the
+    // shortest found; not necessarily optimal (see OptimalSolver).
+    class Solver
+    {
+    private:
+	const SolverTables& tables;
+	std::vector<Move> path;
+	State start;
+	int maxLength;
+	int phase1Length;
+	uint64_t nodes;
+	uint64_t nodeLimit;
+
+	bool searchPhase1(int twist, int flip, int slice, int depth, int togo, int lastFace);
+	bool startPhase2(void);
+	bool searchPhase2(int cornerPermutation, int edge8Permutation, int slicePermutation, int depth, int togo, int lastFace);
+
+    public:
+	Solver(const SolverTables& tables);
+
+	// Solve a state in at most maxLength moves.
+	std::vector<Move> solve(const State& state, int maxLength = 22) throw (CubeException);
+
+	// Nodes visited by the last solve
+	uint64_t getNodeCount(void) const { return nodes; }
+    };
+}
+
+#endif
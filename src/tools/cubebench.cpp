@@ -0,0 +1,202 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include <chrono>
+
+#include "../cube.hpp"
+#include "../cubies.hpp"
+#include "../batch.hpp"
+#include "../bigcube.hpp"
+
+#define DEFAULT_STREAM_LENGTH (1 << 20)
+#define DEFAULT_PASSES        64
+#define BATCH_CUBES           4096
+#define BATCH_MOVES           256
+#define BIG_MOVES             (1 << 16)
+
+using namespace std;
+using cube::Move;
+using cube::Kernel;
+using cube::Cubies;
+
+typedef chrono::steady_clock bench_clock;
+
+// Random scramble stream, never turning the same face twice in a row.
+static vector<Move> makeStream(size_t length, unsigned int seed)
+{
+  vector<Move> stream;
+  int lastFace = -1;
+
+  srand(seed);
+  stream.reserve(length);
+
+  while(stream.size() < length) {
+    Move move = (Move)(rand() % cube::MOVE_COUNT);
+
+    if(cube::getMoveFace(move) == lastFace)
+      continue;
+
+    lastFace = cube::getMoveFace(move);
+    stream.push_back(move);
+  }
+
+  return stream;
+}
+
+int main(int argc, char* argv[])
+{
+  size_t streamLength = (argc > 1) ? (size_t)atol(argv[1]) : DEFAULT_STREAM_LENGTH;
+  int passes = (argc > 2) ? atoi(argv[2]) : DEFAULT_PASSES;
+
+  vector<Move> stream = makeStream(streamLength, 1234);
+
+  // Packed state is the reference every kernel has to agree with.
+  cube::State reference;
+
+  bench_clock::time_point start = bench_clock::now();
+  for(int pass = 0; pass < passes; ++pass)
+    reference.apply(stream);
+  double referenceSeconds = chrono::duration<double>(bench_clock::now() - start).count();
+
+  cerr << "MOVE KERNEL BENCHMARK" << endl
+       << "---------------------" << endl
+       << "\tStream: " << streamLength << " moves x " << passes << " passes" << endl
+       << "\tBest kernel: " << cube::getKernelName(cube::getBestKernel()) << endl << endl;
+
+  cerr << setw(10) << "packed" << setw(12) << fixed << setprecision(1)
+       << (streamLength*passes)/referenceSeconds/1e6 << " Mmoves/s" << endl;
+
+  int status = 0;
+
+  for(int kernel = 0; kernel < cube::KERNEL_COUNT; ++kernel) {
+    if(!cube::isKernelSupported((Kernel)kernel)) {
+      cerr << setw(10) << cube::getKernelName((Kernel)kernel) << "  unsupported" << endl;
+      continue;
+    }
+
+    Cubies cubies;
+
+    start = bench_clock::now();
+    for(int pass = 0; pass < passes; ++pass)
+      cube::applyMoves((Kernel)kernel, cubies, &stream[0], stream.size());
+    double seconds = chrono::duration<double>(bench_clock::now() - start).count();
+
+    bool matches = (cubies.toState() == reference);
+
+    cerr << setw(10) << cube::getKernelName((Kernel)kernel) << setw(12)
+         << (streamLength*passes)/seconds/1e6 << " Mmoves/s"
+         << (matches ? "" : "  MISMATCH") << endl;
+
+    if(!matches)
+      status = 1;
+  }
+
+  // Batched cubes, the same and different sequences in lockstep.
+  vector<Move> sequence(stream.begin(), stream.begin() + min(stream.size(), (size_t)BATCH_MOVES));
+  vector<vector<Move> > sequences(BATCH_CUBES);
+
+  for(size_t index = 0; index < sequences.size(); ++index)
+    sequences[index] = makeStream(sequence.size(), (unsigned int)index);
+
+  cerr << endl << "\tBatch: " << BATCH_CUBES << " cubes x " << sequence.size() << " moves" << endl << endl;
+
+  for(int kernel = 0; kernel < cube::KERNEL_COUNT; ++kernel) {
+    if(!cube::isKernelSupported((Kernel)kernel))
+      continue;
+
+    cube::Batch batch(BATCH_CUBES);
+    batch.setKernel((Kernel)kernel);
+
+    start = bench_clock::now();
+    batch.apply(sequence);
+    double sameSeconds = chrono::duration<double>(bench_clock::now() - start).count();
+
+    start = bench_clock::now();
+    batch.apply(sequences);
+    double lockstepSeconds = chrono::duration<double>(bench_clock::now() - start).count();
+
+    // One more lockstep step, with bytes past MOVE_NONE idling their lanes.
+    vector<uint8_t> step(BATCH_CUBES);
+
+    for(size_t lane = 0; lane < step.size(); ++lane)
+      step[lane] = (uint8_t)(lane*7 % 256);
+
+    batch.apply(&step[0]);
+
+    // Every lane against a packed state given the same moves.
+    cube::State same;
+    bool matches = true;
+
+    same.apply(sequence);
+
+    for(size_t lane = 0; lane < sequences.size() && matches; ++lane) {
+      cube::State expected = same;
+
+      expected.apply(sequences[lane]);
+
+      if(step[lane] < cube::MOVE_COUNT)
+        expected.apply((Move)step[lane]);
+
+      matches = (batch.get(lane) == expected);
+    }
+
+    cerr << setw(10) << cube::getKernelName((Kernel)kernel)
+         << setw(12) << (BATCH_CUBES*sequence.size())/sameSeconds/1e6 << " Mmoves/s same,"
+         << setw(10) << (BATCH_CUBES*sequence.size())/lockstepSeconds/1e6 << " Mmoves/s lockstep"
+         << (matches ? "" : "  MISMATCH") << endl;
+
+    if(!matches)
+      status = 1;
+  }
+
+  // Sticker engine: must agree with the packed state as a 3x3, then
+  // random single layer turns at growing sizes.
+  {
+    cube::BigCube big(3);
+    uint8_t facelets[cube::FACELET_COUNT];
+
+    for(int pass = 0; pass < passes; ++pass)
+      for(size_t move = 0; move < stream.size(); ++move) {
+        cube::LayerMove layerMove = { cube::getMoveFace(stream[move]), 0, 1, stream[move] % 3 + 1 };
+
+        big.apply(layerMove);
+      }
+
+    reference.getFacelets(facelets);
+
+    bool matches = equal(facelets, facelets + cube::FACELET_COUNT, big.getStickers().begin());
+
+    cerr << endl << "\tNxN stickers: " << stream.size()*passes << " layer turns checked as a 3x3" << (matches ? "" : "  MISMATCH") << endl
+         << "\t" << BIG_MOVES << " layer turns per size" << endl << endl;
+
+    if(!matches)
+      status = 1;
+  }
+
+  const int bigSizes[] = { 3, 4, 10, 33, 100 };
+
+  for(size_t index = 0; index < sizeof(bigSizes)/sizeof(bigSizes[0]); ++index) {
+    int size = bigSizes[index];
+    cube::BigCube big(size);
+    vector<cube::LayerMove> moves(BIG_MOVES);
+
+    srand(size);
+
+    for(size_t move = 0; move < moves.size(); ++move) {
+      cube::LayerMove layerMove = { (cube::Face)(rand() % cube::FACE_COUNT), rand() % size, 1, rand() % 3 + 1 };
+
+      moves[move] = layerMove;
+    }
+
+    start = bench_clock::now();
+    big.apply(moves);
+    double seconds = chrono::duration<double>(bench_clock::now() - start).count();
+
+    cerr << setw(6) << size << "x" << left << setw(3) << size << right << setw(12)
+         << moves.size()/seconds/1e6 << " Mturns/s, " << big.getStickers().size() << " bytes" << endl;
+  }
+
+  return status;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "../cube.hpp"
+
+#define RANDOM_STATES 1000
+#define SCRAMBLE_LENGTH 25
+
+using namespace std;
+using cube::Move;
+using cube::State;
+
+// Known facelet strings (URFDLB order) from the solved cube.
+struct FaceletCase
+{
+  const char* moves;
+  const char* facelets;
+};
+
+static const FaceletCase faceletCases[] = {
+  { "", "UUUUUUUUURRRRRRRRRFFFFFFFFFDDDDDDDDDLLLLLLLLLBBBBBBBBB" },
+  { "R", "UUFUUFUUFRRRRRRRRRFFDFFDFFDDDBDDBDDBLLLLLLLLLUBBUBBUBB" },
+  { "U", "UUUUUUUUUBBBRRRRRRRRRFFFFFFDDDDDDDDDFFFLLLLLLLLLBBBBBB" },
+  { "F", "UUUUUULLLURRURRURRFFFFFFFFFRRRDDDDDDLLDLLDLLDBBBBBBBBB" },
+  // Superflip: every edge flipped in place
+  { "U R2 F B R B2 R U2 L B2 R U' D' R2 F R' L B2 U2 F2", "UBULURUFURURFRBRDRFUFLFRFDFDFDLDRDBDLULBLFLDLBUBRBLBDB" }
+};
+
+static State randomState(unsigned int seed)
+{
+  State state;
+
+  srand(seed);
+
+  for(int move = 0; move < SCRAMBLE_LENGTH; ++move)
+    state.apply((Move)(rand() % cube::MOVE_COUNT));
+
+  return state;
+}
+
+static string faceletString(const State& state)
+{
+  static const char faceNames[] = "URFDLB";
+  uint8_t facelets[cube::FACELET_COUNT];
+  string result;
+
+  state.getFacelets(facelets);
+
+  for(int facelet = 0; facelet < cube::FACELET_COUNT; ++facelet)
+    result += faceNames[facelets[facelet]];
+
+  return result;
+}
+
+static int report(const char* name, int failures)
+{
+  cerr << "\t" << name << (failures == 0 ? " ... OK" : " ... FAILED") << endl;
+
+  return failures == 0 ? 0 : 1;
+}
+
+int main(void)
+{
+  int status = 0;
+  int failures;
+
+  cerr << "CUBE STATE CHECKS" << endl
+       << "-----------------" << endl;
+
+  // Four quarter turns, or a move and its inverse, change nothing, from
+  // any starting state.
+  failures = 0;
+
+  for(unsigned int seed = 0; seed < RANDOM_STATES; ++seed) {
+    State start = randomState(seed);
+
+    for(int move = 0; move < cube::MOVE_COUNT; ++move) {
+      State turned = start;
+      State undone = start;
+
+      for(int turn = 0; turn < 4; ++turn)
+        turned.apply((Move)move);
+
+      undone.apply((Move)move);
+      undone.apply(cube::getInverse((Move)move));
+
+      if(turned != start || undone != start || !undone.isValid())
+        ++failures;
+    }
+  }
+
+  status |= report("move^4 and move + inverse", failures);
+
+  // Move strings survive parseMoves/toString both ways.
+  failures = 0;
+
+  {
+    string all = "U U2 U' R R2 R' F F2 F' D D2 D' L L2 L' B B2 B'";
+
+    if(cube::toString(cube::parseMoves(all)) != all)
+      ++failures;
+
+    for(unsigned int seed = 0; seed < RANDOM_STATES; ++seed) {
+      vector<Move> moves;
+
+      srand(seed);
+
+      for(int move = 0; move < SCRAMBLE_LENGTH; ++move)
+        moves.push_back((Move)(rand() % cube::MOVE_COUNT));
+
+      if(cube::parseMoves(cube::toString(moves)) != moves)
+        ++failures;
+    }
+
+    try {
+      cube::parseMoves("R U X");
+      ++failures;
+    } catch(cube::CubeException&) {
+    }
+  }
+
+  status |= report("parseMoves/toString round trip", failures);
+
+  // Facelets of known scrambles, and back again.
+  failures = 0;
+
+  for(size_t index = 0; index < sizeof(faceletCases)/sizeof(faceletCases[0]); ++index) {
+    State state;
+
+    state.apply(cube::parseMoves(faceletCases[index].moves));
+
+    if(faceletString(state) != faceletCases[index].facelets) {
+      cerr << "\t\"" << faceletCases[index].moves << "\": " << faceletString(state) << endl
+           << "\t  expected " << faceletCases[index].facelets << endl;
+      ++failures;
+    }
+  }
+
+  for(unsigned int seed = 0; seed < RANDOM_STATES; ++seed) {
+    State state = randomState(seed);
+
+    if(cube::parseFacelets(faceletString(state)) != state)
+      ++failures;
+  }
+
+  status |= report("getFacelets on known scrambles", failures);
+
+  return status;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <chrono>
+
+#include "../cube.hpp"
+#include "../solver.hpp"
+#include "../cornerdb.hpp"
+
+#define DEFAULT_TABLE_FILE "cubetables.bin"
+#define DEFAULT_DATABASE_FILE "cornerdb.bin"
+
+#define ERRLOG(errstr) std::cerr << "ERR [" << __FILE__ << ":" << __LINE__ << "] " << errstr << std::endl;
+
+using namespace std;
+
+typedef chrono::steady_clock pdb_clock;
+
+static void usage(const char* program)
+{
+  cerr << "Usage: " << program << " [--tables FILE] [--threads N] [--verify] [DATABASE]" << endl
+       << "\tGenerates the corner pattern database into DATABASE (default: " << DEFAULT_DATABASE_FILE << ")." << endl
+       << "\t--verify checks the checksum of an existing DATABASE instead." << endl;
+}
+
+int main(int argc, char* argv[])
+{
+  string tableFile = DEFAULT_TABLE_FILE;
+  string databaseFile = DEFAULT_DATABASE_FILE;
+  int threads = 0;
+  bool verify = false;
+
+  for(int arg = 1; arg < argc; ++arg) {
+    string option = argv[arg];
+
+    if(option == "--tables" && arg + 1 < argc)
+      tableFile = argv[++arg];
+    else if(option == "--threads" && arg + 1 < argc)
+      threads = atoi(argv[++arg]);
+    else if(option == "--verify")
+      verify = true;
+    else if(option == "--help" || option == "-h") {
+      usage(argv[0]);
+      return 0;
+    } else
+      databaseFile = option;
+  }
+
+  pdb_clock::time_point start = pdb_clock::now();
+
+  try {
+    if(verify) {
+      cube::CornerDatabase database(databaseFile);
+
+      if(!database.verify()) {
+        ERRLOG("\"" << databaseFile << "\" failed its checksum.");
+        return 1;
+      }
+
+      cerr << "\"" << databaseFile << "\" verified in " << chrono::duration<double>(pdb_clock::now() - start).count() << " s" << endl;
+      return 0;
+    }
+
+    cube::SolverTables tables(tableFile);
+
+    cerr << "Generating \"" << databaseFile << "\"" << endl;
+    cube::CornerDatabase::generate(tables, databaseFile, threads, &cerr);
+    cerr << "Done in " << chrono::duration<double>(pdb_clock::now() - start).count() << " s" << endl;
+  } catch(cube::CubeException& exception) {
+    ERRLOG(exception.what());
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,366 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "../gl_core_4_4.hpp"
+#include <GLFW/glfw3.h>
+
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../glslu.hpp"
+#include "../headless.hpp"
+#include "../renderer.hpp"
+#include "../cube.hpp"
+#include "../png.hpp"
+#include "../mappedfile.hpp"
+
+#define DEFAULT_SIZE 256
+#define DEFAULT_RING_DEPTH 3
+#define DEFAULT_OUTPUT_DIRECTORY "."
+#define DEFAULT_PREFIX "cube_"
+#define DEFAULT_SHADER_DIRECTORY "src/shaders"
+
+#define SHADER_CACHE_DIRECTORY "shadercache"
+
+#define ERRLOG(errstr) std::cerr << "ERR [" << __FILE__ << ":" << __LINE__ << "] " << errstr << std::endl;
+
+using namespace std;
+using glm::vec3;
+using glm::mat4;
+
+typedef chrono::steady_clock render_clock;
+
+// A read-back image waiting for a worker to encode and write it.
+struct Image
+{
+  string filename;
+  vector<unsigned char> pixels;
+};
+
+// Bounded hand-off from the GL thread to the encoders, so a slow disk
+// holds the renderer back instead of growing memory without limit.
+class ImageQueue
+{
+private:
+  deque<Image*> images;
+  size_t capacity;
+  bool closed;
+  mutex lock;
+  condition_variable notEmpty;
+  condition_variable notFull;
+
+public:
+  ImageQueue(size_t capacity): capacity(capacity), closed(false) {}
+
+  void push(Image* image)
+  {
+    unique_lock<mutex> guard(lock);
+
+    notFull.wait(guard, [this]() { return images.size() < capacity; });
+    images.push_back(image);
+    notEmpty.notify_one();
+  }
+
+  // NULL once closed and drained.
+  Image* pop(void)
+  {
+    unique_lock<mutex> guard(lock);
+
+    notEmpty.wait(guard, [this]() { return closed || !images.empty(); });
+
+    if(images.empty())
+      return NULL;
+
+    Image* image = images.front();
+    images.pop_front();
+    notFull.notify_one();
+
+    return image;
+  }
+
+  void close(void)
+  {
+    lock_guard<mutex> guard(lock);
+
+    closed = true;
+    notEmpty.notify_all();
+  }
+};
+
+static void encodeImages(ImageQueue& queue, int width, int height, atomic<int>& failures)
+{
+  vector<unsigned char> png;
+
+  while(Image* image = queue.pop()) {
+    sysu::encodePNG(&image->pixels[0], width, height, png);
+
+    // Write beside the target, so a viewer never opens half an image.
+    string temporary = image->filename + ".tmp";
+    ofstream output(temporary.c_str(), ios::out | ios::binary | ios::trunc);
+
+    output.write((const char*)&png[0], png.size());
+    output.close();
+
+    if(!output) {
+      ERRLOG("Could not write \"" << temporary << "\".");
+      remove(temporary.c_str());
+      ++failures;
+    } else if(!sysu::replaceFile(temporary, image->filename)) {
+      ERRLOG("Could not move image into \"" << image->filename << "\".");
+      ++failures;
+    }
+
+    delete image;
+  }
+}
+
+static void usage(const char* program)
+{
+  cerr << "Usage: " << program << " [--size WIDTHxHEIGHT] [--threads N] [--ring N] [--output-dir DIR] [--prefix NAME] [--shaders DIR] [FILE]" << endl
+       << "\tRenders one PNG per line of FILE (or stdin), each line a scramble applied" << endl
+       << "\tto the solved cube or a state as " << cube::FACELET_COUNT << " facelet letters (URFDLB order)," << endl
+       << "\tas DIR/NAME000000.png numbered by line." << endl
+       << "\t--ring sets how many frames the GPU may run ahead of readback (default " << DEFAULT_RING_DEPTH << ")," << endl
+       << "\t--threads how many PNG encoders run alongside it (default: all cores)." << endl;
+}
+
+int main(int argc, char* argv[])
+{
+  int width = DEFAULT_SIZE;
+  int height = DEFAULT_SIZE;
+  int threads = 0;
+  int ringDepth = DEFAULT_RING_DEPTH;
+  string outputDirectory = DEFAULT_OUTPUT_DIRECTORY;
+  string prefix = DEFAULT_PREFIX;
+  string shaderDirectory = DEFAULT_SHADER_DIRECTORY;
+  string inputFile;
+
+  for(int arg = 1; arg < argc; ++arg) {
+    string option = argv[arg];
+
+    if(option == "--size" && arg + 1 < argc)
+      sscanf(argv[++arg], "%dx%d", &width, &height);
+    else if(option == "--threads" && arg + 1 < argc)
+      threads = atoi(argv[++arg]);
+    else if(option == "--ring" && arg + 1 < argc)
+      ringDepth = atoi(argv[++arg]);
+    else if(option == "--output-dir" && arg + 1 < argc)
+      outputDirectory = argv[++arg];
+    else if(option == "--prefix" && arg + 1 < argc)
+      prefix = argv[++arg];
+    else if(option == "--shaders" && arg + 1 < argc)
+      shaderDirectory = argv[++arg];
+    else if(option == "--help" || option == "-h") {
+      usage(argv[0]);
+      return 0;
+    } else
+      inputFile = option;
+  }
+
+  if(threads <= 0)
+    threads = (int)thread::hardware_concurrency();
+
+  if(threads <= 0)
+    threads = 1;
+
+  if(ringDepth < 1)
+    ringDepth = 1;
+
+  // Scrambles first, so a bad file fails before any GL setup.
+  vector<string> scrambles;
+
+  if(inputFile.empty())
+    for(string line; getline(cin, line);)
+      scrambles.push_back(line);
+  else {
+    ifstream input(inputFile.c_str());
+
+    if(!input) {
+      ERRLOG("Could not open \"" << inputFile << "\".");
+      return -1;
+    }
+
+    for(string line; getline(input, line);)
+      scrambles.push_back(line);
+  }
+
+  // EGL where available; otherwise a hidden window's context does the job.
+  glslu::HeadlessContext* headlessContext = NULL;
+  GLFWwindow* hWindow = NULL;
+
+  try {
+    headlessContext = new glslu::HeadlessContext();
+  } catch(glslu::ContextException& exception) {
+    if(!glfwInit()) {
+      ERRLOG(exception.what());
+      return -1;
+    }
+
+    glfwWindowHint(GLFW_VISIBLE, 0);
+    hWindow = glfwCreateWindow(16, 16, "CubeRender", NULL, NULL);
+
+    if(!hWindow) {
+      ERRLOG(exception.what());
+      glfwTerminate();
+      return -1;
+    }
+
+    glfwMakeContextCurrent(hWindow);
+  }
+
+  auto shutdown = [&]() -> void {
+    if(hWindow) {
+      glfwDestroyWindow(hWindow);
+      glfwTerminate();
+    }
+
+    delete headlessContext;
+  };
+
+  if(!gl::sys::LoadFunctionsLazy()) {
+    ERRLOG("Could not load OpenGL!");
+
+    shutdown();
+    return -1;
+  }
+
+  render_clock::time_point start = render_clock::now();
+  atomic<int> failures(0);
+  int skipped = 0;
+
+  {
+    glslu::Framebuffer* framebuffer;
+
+    try {
+      framebuffer = new glslu::Framebuffer(width, height);
+    } catch(glslu::ContextException& exception) {
+      ERRLOG(exception.what());
+
+      shutdown();
+      return -1;
+    }
+
+    framebuffer->bind();
+
+    // Same program the interactive view uses.
+    glslu::Program program;
+    glslu::ProgramCache programCache(SHADER_CACHE_DIRECTORY);
+    vector<string> shaders;
+
+    shaders.push_back(shaderDirectory + "/colormvp.glsl.vert");
+    shaders.push_back(shaderDirectory + "/color.glsl.frag");
+
+    try {
+      programCache.build(program, shaders);
+    } catch(glslu::ProgramException& exception) {
+      ERRLOG(exception.what());
+    }
+
+    if(!program.isLinked()) {
+      ERRLOG("Could not link shader program.");
+
+      delete framebuffer;
+      shutdown();
+      return -1;
+    }
+
+    gl::ClearColor(0.95f, 0.95f, 0.95f, 1.0f);
+    gl::Enable(gl::DEPTH_TEST);
+
+    // Three-quarter view showing the U, F and R faces.
+    cube::Renderer* renderer = new cube::Renderer();
+
+    renderer->setProjection(glm::perspective(glm::radians(45.0f), (float)width/height, 0.1f, 100.0f));
+    renderer->setView(glm::lookAt(vec3(4.5f, 4.5f, 6.5f), vec3(0.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f)));
+    renderer->setupProgram(program);
+
+    glslu::PixelReadback readback(width, height, ringDepth);
+    deque<string> pending;
+    ImageQueue queue(2*threads);
+    vector<thread> workers;
+
+    for(int worker = 0; worker < threads; ++worker)
+      workers.push_back(thread(encodeImages, ref(queue), width, height, ref(failures)));
+
+    // Hand the oldest finished frame to the encoders.
+    auto collect = [&]() -> void {
+      Image* image = new Image();
+
+      image->filename = pending.front();
+      readback.collect(image->pixels);
+      pending.pop_front();
+
+      queue.push(image);
+    };
+
+    for(size_t index = 0; index < scrambles.size(); ++index) {
+      cube::State state;
+      stringstream tokens(scrambles[index]);
+      string first, rest;
+
+      tokens >> first >> rest;
+
+      // A single token of facelet length is a state; moves are short tokens.
+      try {
+        if(first.size() == cube::FACELET_COUNT && rest.empty())
+          state = cube::parseFacelets(first);
+        else
+          state.apply(cube::parseMoves(scrambles[index]));
+      } catch(cube::CubeException& exception) {
+        ERRLOG("line " << (index + 1) << ": " << exception.what());
+        ++skipped;
+        continue;
+      }
+
+      // Keep at most ringDepth frames in flight on the GPU.
+      if(readback.isFull())
+        collect();
+
+      renderer->update(state);
+
+      gl::Clear(gl::COLOR_BUFFER_BIT | gl::DEPTH_BUFFER_BIT);
+      renderer->draw();
+
+      stringstream filename;
+
+      filename << outputDirectory << "/" << prefix << setw(6) << setfill('0') << index << ".png";
+      pending.push_back(filename.str());
+
+      readback.request(*framebuffer);
+    }
+
+    while(!readback.isEmpty())
+      collect();
+
+    queue.close();
+
+    for(size_t worker = 0; worker < workers.size(); ++worker)
+      workers[worker].join();
+
+    delete renderer;
+    delete framebuffer;
+  }
+
+  double elapsed = chrono::duration<double>(render_clock::now() - start).count();
+  int rendered = (int)scrambles.size() - skipped;
+
+  cerr << rendered << " images in " << elapsed << " s (" << (elapsed > 0 ? rendered/elapsed : 0.0) << " images/s, "
+       << threads << " encoders, ring of " << ringDepth << ")" << endl;
+
+  shutdown();
+
+  return (failures.load() > 0 || skipped > 0) ? 1 : 0;
+}
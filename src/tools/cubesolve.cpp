@@ -0,0 +1,123 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <chrono>
+
+#include "../cube.hpp"
+#include "../solver.hpp"
+#include "../optimal.hpp"
+#include "../cornerdb.hpp"
+
+#define DEFAULT_TABLE_FILE "cubetables.bin"
+#define DEFAULT_MAX_LENGTH 22
+
+#define ERRLOG(errstr) std::cerr << "ERR [" << __FILE__ << ":" << __LINE__ << "] " << errstr << std::endl;
+
+using namespace std;
+
+typedef chrono::steady_clock solve_clock;
+
+static void usage(const char* program)
+{
+  cerr << "Usage: " << program << " [--tables FILE] [--max-length N] [--optimal [--threads N] [--corners FILE]] [SCRAMBLE]" << endl
+       << "\tSolves SCRAMBLE (e.g. \"R U R' F2\"), or one scramble per line of stdin." << endl
+       << "\t--optimal searches for a shortest solution using N threads (default: all)." << endl
+       << "\t--corners adds a corner pattern database (see CubePDB) to the optimal search." << endl;
+}
+
+int main(int argc, char* argv[])
+{
+  string tableFile = DEFAULT_TABLE_FILE;
+  int maxLength = DEFAULT_MAX_LENGTH;
+  bool optimal = false;
+  int threads = 0;
+  string cornerFile;
+  string scramble;
+
+  for(int arg = 1; arg < argc; ++arg) {
+    string option = argv[arg];
+
+    if(option == "--tables" && arg + 1 < argc)
+      tableFile = argv[++arg];
+    else if(option == "--max-length" && arg + 1 < argc)
+      maxLength = atoi(argv[++arg]);
+    else if(option == "--optimal")
+      optimal = true;
+    else if(option == "--threads" && arg + 1 < argc)
+      threads = atoi(argv[++arg]);
+    else if(option == "--corners" && arg + 1 < argc)
+      cornerFile = argv[++arg];
+    else if(option == "--help" || option == "-h") {
+      usage(argv[0]);
+      return 0;
+    } else
+      scramble += (scramble.empty() ? "" : " ") + option;
+  }
+
+  // Mapping is a page-fault; generating only happens on first run.
+  solve_clock::time_point start = solve_clock::now();
+  cube::SolverTables* tables;
+  cube::CornerDatabase* corners = NULL;
+
+  try {
+    tables = new cube::SolverTables(tableFile);
+
+    if(!cornerFile.empty())
+      corners = new cube::CornerDatabase(cornerFile);
+  } catch(cube::CubeException& exception) {
+    ERRLOG(exception.what());
+    return -1;
+  }
+
+  cerr << "Tables ready in " << chrono::duration<double, milli>(solve_clock::now() - start).count() << " ms" << endl;
+
+  cube::Solver solver(*tables);
+  cube::OptimalSolver optimalSolver(*tables, threads);
+  optimalSolver.setCornerDatabase(corners);
+  vector<string> scrambles;
+
+  if(!scramble.empty())
+    scrambles.push_back(scramble);
+  else
+    for(string line; getline(cin, line);)
+      scrambles.push_back(line);
+
+  int status = 0;
+
+  for(size_t index = 0; index < scrambles.size(); ++index) {
+    try {
+      cube::State state;
+      state.apply(cube::parseMoves(scrambles[index]));
+
+      start = solve_clock::now();
+      vector<cube::Move> solution = optimal ? optimalSolver.solve(state, maxLength) : solver.solve(state, maxLength);
+      double elapsed = chrono::duration<double, milli>(solve_clock::now() - start).count();
+
+      cout << cube::toString(solution) << endl;
+
+      if(!optimal) {
+        cerr << "\t" << solution.size() << " moves, " << elapsed << " ms, " << solver.getNodeCount() << " nodes" << endl;
+        continue;
+      }
+
+      // Per-thread throughput shows how evenly stealing spread the work.
+      const vector<cube::ThreadStats>& stats = optimalSolver.getThreadStats();
+
+      cerr << "\t" << solution.size() << " moves (optimal), " << elapsed << " ms" << endl;
+
+      for(size_t thread = 0; thread < stats.size(); ++thread)
+        cerr << "\t\tthread " << thread << ": " << stats[thread].nodes << " nodes, "
+             << stats[thread].getNodesPerSecond()/1e6 << " Mnodes/s, "
+             << stats[thread].tasks << " tasks, " << stats[thread].steals << " steals" << endl;
+    } catch(cube::CubeException& exception) {
+      ERRLOG(exception.what());
+      status = 1;
+    }
+  }
+
+  delete corners;
+  delete tables;
+
+  return status;
+}